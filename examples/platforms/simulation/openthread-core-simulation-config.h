@@ -137,6 +137,66 @@
  */
 #define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 1
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+ *
+ * Define to 1 to use an intrusive pairing heap for the running timers in the timer schedulers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to keep the expanded AES key schedules of the MAC keys for software frame security.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE
+ *
+ * Define to 1 to use the host CPU AES instructions when available.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE
+#define OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HDLC_FCS_SLICING_ENABLE
+ *
+ * Define to 1 to compute the HDLC FCS eight bytes at a time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HDLC_FCS_SLICING_ENABLE
+#define OPENTHREAD_CONFIG_HDLC_FCS_SLICING_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+ *
+ * Define to 1 to keep a lookup table compiled from the Leader Network Data.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
  *
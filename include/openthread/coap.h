@@ -418,6 +418,11 @@ typedef struct otCoapResource
     otCoapRequestHandler   mHandler; ///< The callback for handling a received request
     void *                 mContext; ///< Application-specific context
     struct otCoapResource *mNext;    ///< The next CoAP resource in the list
+
+    // The fields below are used/managed internally by OpenThread core. Caller does not need to set them.
+
+    uint32_t mUriPathHash; ///< Internal: URI Path hash. Set by OpenThread core, MUST NOT be set by the caller.
+    uint32_t mHitCount;    ///< Internal: requests dispatched. Set by OpenThread core, MUST NOT be set by the caller.
 } otCoapResource;
 
 /**
@@ -442,6 +447,11 @@ typedef struct otCoapBlockwiseResource
     otCoapBlockwiseTransmitHook     mTransmitHook;
     void *                          mContext; ///< Application-specific context
     struct otCoapBlockwiseResource *mNext;    ///< The next CoAP resource in the list
+
+    // The fields below are used/managed internally by OpenThread core. Caller does not need to set them.
+
+    uint32_t mUriPathHash; ///< Internal: URI Path hash. Set by OpenThread core, MUST NOT be set by the caller.
+    uint32_t mHitCount;    ///< Internal: requests dispatched. Set by OpenThread core, MUST NOT be set by the caller.
 } otCoapBlockwiseResource;
 
 /**
@@ -1014,6 +1024,18 @@ void otCoapAddResource(otInstance *aInstance, otCoapResource *aResource);
  */
 void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource);
 
+/**
+ * This function gets the number of requests dispatched to a CoAP resource.
+ *
+ * The counter is reset when the resource is added to a CoAP server.
+ *
+ * @param[in]  aResource  A pointer to the resource.
+ *
+ * @returns The number of requests dispatched to @p aResource.
+ *
+ */
+uint32_t otCoapResourceGetHitCount(const otCoapResource *aResource);
+
 /**
  * This function adds a block-wise resource to the CoAP server.
  *
@@ -1032,6 +1054,18 @@ void otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *
  */
 void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
 
+/**
+ * This function gets the number of requests dispatched to a block-wise CoAP resource.
+ *
+ * The counter is reset when the resource is added to a CoAP server.
+ *
+ * @param[in]  aResource  A pointer to the resource.
+ *
+ * @returns The number of requests dispatched to @p aResource.
+ *
+ */
+uint32_t otCoapBlockWiseResourceGetHitCount(const otCoapBlockwiseResource *aResource);
+
 /**
  * This function sets the default handler for unhandled CoAP requests.
  *
@@ -136,6 +136,41 @@ const otDnsQueryConfig *otDnsClientGetDefaultConfig(otInstance *aInstance);
  */
 void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *aConfig);
 
+/**
+ * This structure represents the DNS client response cache counters.
+ *
+ */
+typedef struct otDnsClientCacheCounters
+{
+    uint32_t mHits;      ///< The number of queries answered from the cache.
+    uint32_t mMisses;    ///< The number of queries sent to the server.
+    uint32_t mCoalesced; ///< The number of queries attached to an identical query already in flight.
+} otDnsClientCacheCounters;
+
+/**
+ * This function gets the DNS client response cache counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the cache counters.
+ *
+ */
+const otDnsClientCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function removes all responses from the DNS client response cache.
+ *
+ * Queries issued after this call are sent to the server. The cache counters are not changed.
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientFlushCache(otInstance *aInstance);
+
 /**
  * This type is an opaque representation of a response to an address resolution DNS query.
  *
@@ -730,6 +730,36 @@ typedef bool (*otIp6SlaacPrefixFilter)(otInstance *aInstance, const otIp6Prefix
  */
 void otIp6SetSlaacPrefixFilter(otInstance *aInstance, otIp6SlaacPrefixFilter aFilter);
 
+/**
+ * This structure represents the MPL counters.
+ *
+ */
+typedef struct otIp6MplCounters
+{
+    uint32_t mDuplicates;      ///< The number of received MPL Data Messages dropped as already seen (Seed Set hit).
+    uint32_t mSeedSetFull;     ///< The number of received MPL Data Messages dropped as the Seed Set was full.
+    uint32_t mNotBuffered;     ///< The number of new MPL Data Messages not buffered for forwarding (no buffers).
+    uint32_t mBufferedEvicted; ///< The number of buffered MPL Data Messages evicted to buffer a newer one.
+} otIp6MplCounters;
+
+/**
+ * This function gets the MPL counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the MPL counters.
+ *
+ */
+const otIp6MplCounters *otIp6GetMplCounters(otInstance *aInstance);
+
+/**
+ * This function resets the MPL counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otIp6ResetMplCounters(otInstance *aInstance);
+
 /**
  * This function pointer is called with results of `otIp6RegisterMulticastListeners`.
  *
@@ -84,6 +84,7 @@ typedef struct otBufferInfo
     uint16_t mCoapSecureBuffers;       ///< The number of buffers in the CoAP secure send queue.
     uint16_t mApplicationCoapMessages; ///< The number of messages in the application CoAP send queue.
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
+    uint16_t mSavedBuffers;            ///< The number of buffers saved by sharing them between messages.
 } otBufferInfo;
 
 /**
@@ -277,7 +278,8 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
  * @param[in]  aBuf      A pointer to a buffer that message bytes are written from.
  * @param[in]  aLength   Number of bytes to write.
  *
- * @returns The number of bytes written.
+ * @returns The number of bytes written, or zero if there were not enough buffers to copy message data shared with
+ *          another message.
  *
  * @sa otMessageFree
  * @sa otMessageAppend
@@ -916,6 +916,125 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance);
  */
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance);
 
+/**
+ * Add a list of short addresses to the source address match table.
+ *
+ * This function is optional. The default implementation adds the entries one at a time using
+ * `otPlatRadioAddSrcMatchShortEntry()`. A platform where each update is costly (e.g., a radio connected over a bus)
+ * can implement it to apply all the entries in one operation.
+ *
+ * If the entries cannot all be added, the content of the source address match table is unspecified.
+ *
+ * @param[in]  aInstance        The OpenThread instance structure.
+ * @param[in]  aShortAddresses  A pointer to an array of short addresses to be added.
+ * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all the short addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchShortEntries(otInstance *          aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries);
+
+/**
+ * Add a list of extended addresses to the source address match table.
+ *
+ * This function is optional. The default implementation adds the entries one at a time using
+ * `otPlatRadioAddSrcMatchExtEntry()`.
+ *
+ * If the entries cannot all be added, the content of the source address match table is unspecified.
+ *
+ * @param[in]  aInstance     The OpenThread instance structure.
+ * @param[in]  aExtAddresses A pointer to an array of extended addresses to be added stored in little-endian byte order.
+ * @param[in]  aNumEntries   The number of entries in @p aExtAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all the extended addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchExtEntries(otInstance *        aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint16_t            aNumEntries);
+
+/**
+ * Remove a list of short addresses from the source address match table.
+ *
+ * This function is optional. The default implementation removes the entries one at a time using
+ * `otPlatRadioClearSrcMatchShortEntry()`. All the entries are removed even when some of them are not in the table.
+ *
+ * @param[in]  aInstance        The OpenThread instance structure.
+ * @param[in]  aShortAddresses  A pointer to an array of short addresses to be removed.
+ * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+ *
+ * @retval OT_ERROR_NONE        Successfully removed all the short addresses from the source match table.
+ * @retval OT_ERROR_NO_ADDRESS  At least one of the short addresses is not in source address match table.
+ *
+ */
+otError otPlatRadioRemoveSrcMatchShortEntries(otInstance *          aInstance,
+                                              const otShortAddress *aShortAddresses,
+                                              uint16_t              aNumEntries);
+
+/**
+ * Remove a list of extended addresses from the source address match table.
+ *
+ * This function is optional. The default implementation removes the entries one at a time using
+ * `otPlatRadioClearSrcMatchExtEntry()`. All the entries are removed even when some of them are not in the table.
+ *
+ * @param[in]  aInstance     The OpenThread instance structure.
+ * @param[in]  aExtAddresses A pointer to an array of extended addresses to be removed stored in little-endian byte
+ *                           order.
+ * @param[in]  aNumEntries   The number of entries in @p aExtAddresses.
+ *
+ * @retval OT_ERROR_NONE        Successfully removed all the extended addresses from the source match table.
+ * @retval OT_ERROR_NO_ADDRESS  At least one of the extended addresses is not in source address match table.
+ *
+ */
+otError otPlatRadioRemoveSrcMatchExtEntries(otInstance *        aInstance,
+                                            const otExtAddress *aExtAddresses,
+                                            uint16_t            aNumEntries);
+
+/**
+ * Replace all the short addresses in the source address match table with a given list.
+ *
+ * This function is optional. The default implementation uses `otPlatRadioClearSrcMatchShortEntries()` followed by
+ * `otPlatRadioAddSrcMatchShortEntries()`.
+ *
+ * If the entries cannot all be added, the content of the source address match table is unspecified.
+ *
+ * @param[in]  aInstance        The OpenThread instance structure.
+ * @param[in]  aShortAddresses  A pointer to an array of short addresses (may be NULL if @p aNumEntries is zero).
+ * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully replaced the short addresses in the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioSetSrcMatchShortEntries(otInstance *          aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries);
+
+/**
+ * Replace all the extended addresses in the source address match table with a given list.
+ *
+ * This function is optional. The default implementation uses `otPlatRadioClearSrcMatchExtEntries()` followed by
+ * `otPlatRadioAddSrcMatchExtEntries()`.
+ *
+ * If the entries cannot all be added, the content of the source address match table is unspecified.
+ *
+ * @param[in]  aInstance     The OpenThread instance structure.
+ * @param[in]  aExtAddresses A pointer to an array of extended addresses stored in little-endian byte order (may be
+ *                           NULL if @p aNumEntries is zero).
+ * @param[in]  aNumEntries   The number of entries in @p aExtAddresses.
+ *
+ * @retval OT_ERROR_NONE      Successfully replaced the extended addresses in the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioSetSrcMatchExtEntries(otInstance *        aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint16_t            aNumEntries);
+
 /**
  * Get the radio supported channel mask that the device is allowed to be on.
  *
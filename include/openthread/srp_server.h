@@ -143,6 +143,18 @@ typedef struct otSrpServerLeaseConfig
     uint32_t mMaxKeyLease; ///< The maximum KEY-LEASE interval in seconds.
 } otSrpServerLeaseConfig;
 
+/**
+ * This structure includes SRP server lease processing counters.
+ *
+ */
+typedef struct otSrpServerLeaseCounters
+{
+    uint32_t mHostLeaseExpirations;       ///< The number of hosts whose LEASE expired (name retained).
+    uint32_t mHostKeyLeaseExpirations;    ///< The number of hosts whose KEY-LEASE expired (fully removed).
+    uint32_t mServiceLeaseExpirations;    ///< The number of services whose LEASE expired (name retained).
+    uint32_t mServiceKeyLeaseExpirations; ///< The number of services whose KEY-LEASE expired (fully removed).
+} otSrpServerLeaseCounters;
+
 /**
  * This function returns the domain authorized to the SRP server.
  *
@@ -208,6 +220,26 @@ void otSrpServerGetLeaseConfig(otInstance *aInstance, otSrpServerLeaseConfig *aL
  */
 otError otSrpServerSetLeaseConfig(otInstance *aInstance, const otSrpServerLeaseConfig *aLeaseConfig);
 
+/**
+ * This function returns the SRP server lease processing counters.
+ *
+ * The counters are updated whenever the SRP server processes an expired LEASE or KEY-LEASE of a host or a service.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the SRP server lease processing counters.
+ *
+ */
+const otSrpServerLeaseCounters *otSrpServerGetLeaseCounters(otInstance *aInstance);
+
+/**
+ * This function resets the SRP server lease processing counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otSrpServerResetLeaseCounters(otInstance *aInstance);
+
 /**
  * This function handles SRP service updates.
  *
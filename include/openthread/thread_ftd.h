@@ -537,6 +537,22 @@ uint8_t otThreadGetMaxRouterId(otInstance *aInstance);
  */
 otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRouterInfo *aRouterInfo);
 
+/**
+ * This function gets the next hop and path cost towards a given RLOC16 destination.
+ *
+ * Both @p aNextHopRloc16 and @p aPathCost can be NULL, in which case the corresponding value is not provided.
+ *
+ * @param[in]  aInstance       A pointer to an OpenThread instance.
+ * @param[in]  aDestRloc16     The RLOC16 of the destination.
+ * @param[out] aNextHopRloc16  A pointer to output the RLOC16 of the next hop, 0xfffe if there is no next hop.
+ * @param[out] aPathCost       A pointer to output the path cost towards the destination.
+ *
+ */
+void otThreadGetNextHopAndPathCost(otInstance *aInstance,
+                                   uint16_t    aDestRloc16,
+                                   uint16_t *  aNextHopRloc16,
+                                   uint8_t *   aPathCost);
+
 /**
  * This function gets the next EID cache entry (using an iterator).
  *
@@ -668,6 +668,7 @@ otError Interpreter::ProcessBufferInfo(Arg aArgs[])
 
     OutputLine("total: %d", bufferInfo.mTotalBuffers);
     OutputLine("free: %d", bufferInfo.mFreeBuffers);
+    OutputLine("saved: %d", bufferInfo.mSavedBuffers);
 
     for (const BufferInfoName &info : kBufferInfoNames)
     {
@@ -1120,6 +1121,7 @@ otError Interpreter::ProcessCounters(Arg aArgs[])
         OutputLine("ip");
         OutputLine("mac");
         OutputLine("mle");
+        OutputLine("mpl");
     }
     else if (aArgs[0] == "mac")
     {
@@ -1262,6 +1264,26 @@ otError Interpreter::ProcessCounters(Arg aArgs[])
             ExitNow(error = OT_ERROR_INVALID_ARGS);
         }
     }
+    else if (aArgs[0] == "mpl")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            const otIp6MplCounters *mplCounters = otIp6GetMplCounters(mInstance);
+
+            OutputLine("Duplicates: %u", mplCounters->mDuplicates);
+            OutputLine("SeedSetFull: %u", mplCounters->mSeedSetFull);
+            OutputLine("NotBuffered: %u", mplCounters->mNotBuffered);
+            OutputLine("BufferedEvicted: %u", mplCounters->mBufferedEvicted);
+        }
+        else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
+        {
+            otIp6ResetMplCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
     else
     {
         ExitNow(error = OT_ERROR_INVALID_ARGS);
@@ -1451,6 +1473,24 @@ otError Interpreter::ProcessDns(Arg aArgs[])
             otDnsClientSetDefaultConfig(mInstance, config);
         }
     }
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    else if (aArgs[0] == "cache")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            const otDnsClientCacheCounters *counters = otDnsClientGetCacheCounters(mInstance);
+
+            OutputLine("Hits: %u", counters->mHits);
+            OutputLine("Misses: %u", counters->mMisses);
+            OutputLine("Coalesced: %u", counters->mCoalesced);
+        }
+        else
+        {
+            VerifyOrExit(aArgs[1] == "flush", error = OT_ERROR_INVALID_COMMAND);
+            otDnsClientFlushCache(mInstance);
+        }
+    }
+#endif
     else if (aArgs[0] == "resolve")
     {
         VerifyOrExit(!aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
@@ -3012,6 +3052,53 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 
+#if OPENTHREAD_FTD
+otError Interpreter::ProcessNextHop(Arg aArgs[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t destRloc16;
+    uint16_t nextHopRloc16;
+    uint8_t  pathCost;
+
+    if (aArgs[0].IsEmpty())
+    {
+        static const char *const kNextHopTableTitles[] = {"ID", "RLOC16", "Next Hop", "Path Cost"};
+        static const uint8_t     kNextHopTableColumnWidths[] = {4, 8, 10, 11};
+
+        otRouterInfo routerInfo;
+        uint8_t      maxRouterId = otThreadGetMaxRouterId(mInstance);
+
+        OutputTableHeader(kNextHopTableTitles, kNextHopTableColumnWidths);
+
+        for (uint8_t i = 0; i <= maxRouterId; i++)
+        {
+            if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
+            {
+                continue;
+            }
+
+            otThreadGetNextHopAndPathCost(mInstance, routerInfo.mRloc16, &nextHopRloc16, &pathCost);
+
+            OutputFormat("| %2d ", routerInfo.mRouterId);
+            OutputFormat("| 0x%04x ", routerInfo.mRloc16);
+            OutputFormat("|   0x%04x ", nextHopRloc16);
+            OutputLine("| %9d |", pathCost);
+        }
+
+        ExitNow();
+    }
+
+    SuccessOrExit(error = aArgs[0].ParseAsUint16(destRloc16));
+    VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    otThreadGetNextHopAndPathCost(mInstance, destRloc16, &nextHopRloc16, &pathCost);
+    OutputLine("0x%04x cost:%d", nextHopRloc16, pathCost);
+
+exit:
+    return error;
+}
+#endif
+
 otError Interpreter::ProcessPanId(Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -557,6 +557,9 @@ private:
     otError ProcessNetworkName(Arg aArgs[]);
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     otError ProcessNetworkTime(Arg aArgs[]);
+#endif
+#if OPENTHREAD_FTD
+    otError ProcessNextHop(Arg aArgs[]);
 #endif
     otError ProcessPanId(Arg aArgs[]);
     otError ProcessParent(Arg aArgs[]);
@@ -826,6 +829,9 @@ private:
         {"networkname", &Interpreter::ProcessNetworkName},
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         {"networktime", &Interpreter::ProcessNetworkTime},
+#endif
+#if OPENTHREAD_FTD
+        {"nexthop", &Interpreter::ProcessNextHop},
 #endif
         {"panid", &Interpreter::ProcessPanId},
         {"parent", &Interpreter::ProcessParent},
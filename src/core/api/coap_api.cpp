@@ -294,6 +294,11 @@ void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResourc
 
     instance.GetApplicationCoap().RemoveBlockWiseResource(*static_cast<Coap::ResourceBlockWise *>(aResource));
 }
+
+uint32_t otCoapBlockWiseResourceGetHitCount(const otCoapBlockwiseResource *aResource)
+{
+    return static_cast<const Coap::ResourceBlockWise *>(aResource)->GetHitCount();
+}
 #endif
 
 void otCoapAddResource(otInstance *aInstance, otCoapResource *aResource)
@@ -310,6 +315,11 @@ void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource)
     instance.GetApplicationCoap().RemoveResource(*static_cast<Coap::Resource *>(aResource));
 }
 
+uint32_t otCoapResourceGetHitCount(const otCoapResource *aResource)
+{
+    return static_cast<const Coap::Resource *>(aResource)->GetHitCount();
+}
+
 void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandler, void *aContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -87,6 +87,22 @@ void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+const otDnsClientCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Dns::Client>().GetCacheCounters();
+}
+
+void otDnsClientFlushCache(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Dns::Client>().FlushCache();
+}
+#endif
+
 otError otDnsClientResolveAddress(otInstance *            aInstance,
                                   const char *            aHostName,
                                   otDnsAddressCallback    aCallback,
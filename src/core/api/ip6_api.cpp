@@ -323,6 +323,20 @@ void otIp6SetSlaacPrefixFilter(otInstance *aInstance, otIp6SlaacPrefixFilter aFi
 
 #endif // OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
 
+const otIp6MplCounters *otIp6GetMplCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Ip6::Mpl>().GetCounters();
+}
+
+void otIp6ResetMplCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Ip6::Mpl>().ResetCounters();
+}
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 
 otError otIp6SetMeshLocalIid(otInstance *aInstance, const otIp6InterfaceIdentifier *aIid)
@@ -110,9 +110,8 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
     Message &message = *static_cast<Message *>(aMessage);
-    message.WriteBytes(aOffset, aBuf, aLength);
 
-    return aLength;
+    return (message.WriteBytes(aOffset, aBuf, aLength) == kErrorNone) ? aLength : 0;
 }
 
 void otMessageQueueInit(otMessageQueue *aQueue)
@@ -178,6 +177,8 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
     aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
 
+    aBufferInfo->mSavedBuffers = instance.Get<MessagePool>().GetSavedBufferCount();
+
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
 
     instance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
@@ -325,6 +325,28 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
     return instance.Get<RouterTable>().GetRouterInfo(aRouterId, *static_cast<Router::Info *>(aRouterInfo));
 }
 
+void otThreadGetNextHopAndPathCost(otInstance *aInstance,
+                                   uint16_t    aDestRloc16,
+                                   uint16_t *  aNextHopRloc16,
+                                   uint8_t *   aPathCost)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+    uint16_t  nextHopRloc16;
+    uint8_t   pathCost;
+
+    instance.Get<Mle::MleRouter>().GetNextHopAndPathCost(aDestRloc16, nextHopRloc16, pathCost);
+
+    if (aNextHopRloc16 != nullptr)
+    {
+        *aNextHopRloc16 = nextHopRloc16;
+    }
+
+    if (aPathCost != nullptr)
+    {
+        *aPathCost = pathCost;
+    }
+}
+
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
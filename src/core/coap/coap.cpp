@@ -48,6 +48,7 @@ namespace Coap {
 
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
+    , mNumUnindexedRequests(0)
     , mMessageId(Random::NonCrypto::GetUint16())
     , mRetransmissionTimer(aInstance, Coap::HandleRetransmissionTimer, this)
     , mContext(nullptr)
@@ -94,24 +95,32 @@ void CoapBase::ClearRequests(const Ip6::Address *aAddress)
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 void CoapBase::AddBlockWiseResource(ResourceBlockWise &aResource)
 {
-    IgnoreError(mBlockWiseResources.Add(aResource));
+    SuccessOrExit(mBlockWiseResources.Add(aResource));
+    aResource.mHitCount = 0;
+
+exit:
+    return;
 }
 
 void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
 {
-    IgnoreError(mBlockWiseResources.Remove(aResource));
+    mBlockWiseResources.Remove(aResource);
     aResource.SetNext(nullptr);
 }
 #endif
 
 void CoapBase::AddResource(Resource &aResource)
 {
-    IgnoreError(mResources.Add(aResource));
+    SuccessOrExit(mResources.Add(aResource));
+    aResource.mHitCount = 0;
+
+exit:
+    return;
 }
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    IgnoreError(mResources.Remove(aResource));
+    mResources.Remove(aResource);
     aResource.SetNext(nullptr);
 }
 
@@ -414,69 +423,127 @@ void CoapBase::HandleRetransmissionTimer(Timer &aTimer)
 
 void CoapBase::HandleRetransmissionTimer(void)
 {
-    TimeMilli        now      = TimerMilli::GetNow();
-    TimeMilli        nextTime = now.GetDistantFuture();
-    Metadata         metadata;
-    Message *        nextMessage;
-    Ip6::MessageInfo messageInfo;
+    TimeMilli                now      = TimerMilli::GetNow();
+    TimeMilli                nextTime = now.GetDistantFuture();
+    TransactionTable::Entry *entry;
+    Metadata                 metadata;
 
-    for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
+    // Only the indexed pending requests whose timer expired are
+    // visited, in the order of their expiry. A request that is
+    // finalized or rescheduled (possibly from a response handler)
+    // leaves the top of the heap.
+
+    while (((entry = mPendingRequestTable.GetEarliest()) != nullptr) && (entry->GetTime() <= now))
     {
-        nextMessage = message->GetNextCoapMessage();
+        Message &message = entry->GetMessage();
 
-        metadata.ReadFrom(*message);
+        metadata.ReadFrom(message);
 
-        if (now >= metadata.mNextTimerShot)
+        if (IsSubscription(message, metadata))
         {
-#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
-            if (message->IsRequest() && metadata.mObserve && metadata.mAcknowledged)
+            // This is a RFC7641 subscription.  Do not time out.
+            mPendingRequestTable.Unschedule(*entry);
+            continue;
+        }
+
+        if (ProcessRetransmission(message, metadata, now))
+        {
+            mPendingRequestTable.Schedule(*entry, metadata.mNextTimerShot);
+        }
+    }
+
+    // The pending requests which did not fit in the table are found by
+    // scanning the queue.
+
+    if (mNumUnindexedRequests > 0)
+    {
+        Message *nextMessage;
+
+        for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
+        {
+            nextMessage = message->GetNextCoapMessage();
+
+            if (mPendingRequestTable.Find(*message) != nullptr)
             {
-                // This is a RFC7641 subscription.  Do not time out.
                 continue;
             }
-#endif
 
-            if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
+            metadata.ReadFrom(*message);
+
+            if (IsSubscription(*message, metadata))
             {
-                // No expected response or acknowledgment.
-                FinalizeCoapTransaction(*message, metadata, nullptr, nullptr, kErrorResponseTimeout);
                 continue;
             }
 
-            // Increment retransmission counter and timer.
-            metadata.mRetransmissionsRemaining--;
-            metadata.mRetransmissionTimeout *= 2;
-            metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(*message);
-
-            // Retransmit
-            if (!metadata.mAcknowledged)
+            if ((metadata.mNextTimerShot <= now) && !ProcessRetransmission(*message, metadata, now))
             {
-                messageInfo.SetPeerAddr(metadata.mDestinationAddress);
-                messageInfo.SetPeerPort(metadata.mDestinationPort);
-                messageInfo.SetSockAddr(metadata.mSourceAddress);
-#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-                messageInfo.SetHopLimit(metadata.mHopLimit);
-                messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
-#endif
-                messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
-
-                SendCopy(*message, messageInfo);
+                continue;
             }
-        }
 
-        if (nextTime > metadata.mNextTimerShot)
-        {
-            nextTime = metadata.mNextTimerShot;
+            nextTime = OT_MIN(nextTime, metadata.mNextTimerShot);
         }
     }
 
+    if ((entry = mPendingRequestTable.GetEarliest()) != nullptr)
+    {
+        nextTime = OT_MIN(nextTime, entry->GetTime());
+    }
+
     if (nextTime < now.GetDistantFuture())
     {
         mRetransmissionTimer.FireAt(nextTime);
     }
 }
 
+bool CoapBase::ProcessRetransmission(Message &aMessage, Metadata &aMetadata, TimeMilli aNow)
+{
+    // This method handles the expired retransmission timer of a pending
+    // request. It returns whether the request is still pending (with
+    // `aMetadata.mNextTimerShot` updated), or was finalized.
+
+    bool             isPending = false;
+    Ip6::MessageInfo messageInfo;
+
+    if (!aMetadata.mConfirmable || (aMetadata.mRetransmissionsRemaining == 0))
+    {
+        // No expected response or acknowledgment.
+        FinalizeCoapTransaction(aMessage, aMetadata, nullptr, nullptr, kErrorResponseTimeout);
+        ExitNow();
+    }
+
+    // Increment retransmission counter and timer.
+    aMetadata.mRetransmissionsRemaining--;
+    aMetadata.mRetransmissionTimeout *= 2;
+    aMetadata.mNextTimerShot = aNow + aMetadata.mRetransmissionTimeout;
+
+    if (aMetadata.UpdateIn(aMessage) != kErrorNone)
+    {
+        // The retransmission counter could not be saved.
+        FinalizeCoapTransaction(aMessage, aMetadata, nullptr, nullptr, kErrorNoBufs);
+        ExitNow();
+    }
+
+    isPending = true;
+
+    // Retransmit
+    if (!aMetadata.mAcknowledged)
+    {
+        messageInfo.SetPeerAddr(aMetadata.mDestinationAddress);
+        messageInfo.SetPeerPort(aMetadata.mDestinationPort);
+        messageInfo.SetSockAddr(aMetadata.mSourceAddress);
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        messageInfo.SetHopLimit(aMetadata.mHopLimit);
+        messageInfo.SetIsHostInterface(aMetadata.mIsHostInterface);
+#endif
+        messageInfo.SetMulticastLoop(aMetadata.mMulticastLoop);
+
+        SendCopy(aMessage, messageInfo);
+    }
+
+exit:
+    return isPending;
+}
+
 void CoapBase::FinalizeCoapTransaction(Message &               aRequest,
                                        const Metadata &        aMetadata,
                                        Message *               aResponse,
@@ -521,9 +588,10 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
 
     SuccessOrExit(error = aMetadata.AppendTo(*messageCopy));
 
-    mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
-
     mPendingRequests.Enqueue(*messageCopy);
+    IndexRequest(*messageCopy, aMetadata);
+
+    mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
 
 exit:
     FreeAndNullMessageOnError(messageCopy, error);
@@ -532,9 +600,23 @@ exit:
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+    TransactionTable::Entry *entry = mPendingRequestTable.Find(aMessage);
+
     mPendingRequests.Dequeue(aMessage);
 
-    if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
+    if (entry != nullptr)
+    {
+        mPendingRequestTable.Remove(*entry);
+        IndexNextUnindexedRequest();
+    }
+    else
+    {
+        OT_ASSERT(mNumUnindexedRequests > 0);
+        mNumUnindexedRequests--;
+    }
+
+    if (mRetransmissionTimer.IsRunning() && (mPendingRequestTable.GetEarliest() == nullptr) &&
+        (mNumUnindexedRequests == 0))
     {
         mRetransmissionTimer.Stop();
     }
@@ -545,6 +627,45 @@ void CoapBase::DequeueMessage(Message &aMessage)
     // the timer would just shoot earlier and then it'd be setup again.
 }
 
+void CoapBase::IndexRequest(Message &aMessage, const Metadata &aMetadata)
+{
+    // A request which does not fit in the table stays only in
+    // `mPendingRequests`. It is then found by scanning the queue,
+    // until an entry is freed for it.
+
+    TransactionTable::Entry *entry = mPendingRequestTable.Add(aMessage);
+
+    if (entry == nullptr)
+    {
+        mNumUnindexedRequests++;
+    }
+    else if (!IsSubscription(aMessage, aMetadata))
+    {
+        mPendingRequestTable.Schedule(*entry, aMetadata.mNextTimerShot);
+    }
+}
+
+void CoapBase::IndexNextUnindexedRequest(void)
+{
+    Metadata metadata;
+
+    VerifyOrExit(mNumUnindexedRequests > 0);
+
+    for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    {
+        if (mPendingRequestTable.Find(*message) == nullptr)
+        {
+            mNumUnindexedRequests--;
+            metadata.ReadFrom(*message);
+            IndexRequest(*message, metadata);
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 void CoapBase::FreeLastBlockResponse(void)
 {
@@ -946,7 +1067,7 @@ void CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessag
     Message *messageCopy = nullptr;
 
     // Create a message copy for lower layers.
-    messageCopy = aMessage.Clone(aMessage.GetLength() - sizeof(Metadata));
+    messageCopy = aMessage.CloneShared(aMessage.GetLength() - sizeof(Metadata));
     VerifyOrExit(messageCopy != nullptr, error = kErrorNoBufs);
 
     SuccessOrExit(error = Send(*messageCopy, aMessageInfo));
@@ -964,37 +1085,45 @@ Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       Metadata &              aMetadata)
 {
-    Message *message;
+    // Reset and Acknowledgment messages are matched by Message ID,
+    // others by Token. Candidates are found through the pending
+    // request table, so the metadata is only read from the messages
+    // that can match.
 
-    for (message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    bool                     matchMessageId = (aResponse.GetType() == kTypeReset) || (aResponse.GetType() == kTypeAck);
+    Message *                message        = nullptr;
+    TransactionTable::Entry *entry;
+
+    entry = matchMessageId ? mPendingRequestTable.FindWithMessageId(aResponse.GetMessageId())
+                           : mPendingRequestTable.FindWithToken(aResponse);
+
+    while (entry != nullptr)
     {
-        aMetadata.ReadFrom(*message);
+        aMetadata.ReadFrom(entry->GetMessage());
 
-        if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aMetadata.mDestinationAddress.IsMulticast() ||
-             aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
-            (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+        if (IsRelatedRequest(entry->GetMessage(), aMetadata, aResponse, aMessageInfo))
         {
-            switch (aResponse.GetType())
-            {
-            case kTypeReset:
-            case kTypeAck:
-                if (aResponse.GetMessageId() == message->GetMessageId())
-                {
-                    ExitNow();
-                }
+            ExitNow(message = &entry->GetMessage());
+        }
 
-                break;
+        entry = matchMessageId ? mPendingRequestTable.FindNextWithMessageId(*entry)
+                               : mPendingRequestTable.FindNextWithToken(*entry, aResponse);
+    }
 
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aResponse.IsTokenEqual(*message))
-                {
-                    ExitNow();
-                }
+    VerifyOrExit(mNumUnindexedRequests > 0);
 
-                break;
-            }
+    for (message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    {
+        if (mPendingRequestTable.Find(*message) != nullptr)
+        {
+            continue;
+        }
+
+        aMetadata.ReadFrom(*message);
+
+        if (IsRelatedRequest(*message, aMetadata, aResponse, aMessageInfo))
+        {
+            break;
         }
     }
 
@@ -1002,6 +1131,35 @@ exit:
     return message;
 }
 
+bool CoapBase::IsRelatedRequest(const Message &         aRequest,
+                                const Metadata &        aMetadata,
+                                const Message &         aResponse,
+                                const Ip6::MessageInfo &aMessageInfo)
+{
+    bool isRelated = false;
+
+    VerifyOrExit(((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
+                  aMetadata.mDestinationAddress.IsMulticast() ||
+                  aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
+                 (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()));
+
+    switch (aResponse.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        isRelated = (aResponse.GetMessageId() == aRequest.GetMessageId());
+        break;
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        isRelated = aResponse.IsTokenEqual(aRequest);
+        break;
+    }
+
+exit:
+    return isRelated;
+}
+
 void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Message &message = static_cast<Message &>(aMessage);
@@ -1087,7 +1245,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 if (metadata.mConfirmable)
                 {
                     metadata.mAcknowledged = true;
-                    metadata.UpdateIn(*request);
+                    IgnoreError(metadata.UpdateIn(*request));
                 }
 
                 // Remove the message if response is not expected, otherwise await
@@ -1112,7 +1270,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
 
                 // Consider the message acknowledged at this point.
                 metadata.mAcknowledged = true;
-                metadata.UpdateIn(*request);
+                IgnoreError(metadata.UpdateIn(*request));
             }
             else
 #endif
@@ -1247,14 +1405,14 @@ exit:
 
 void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    char     uriPath[Message::kMaxReceivedUriPath + 1];
-    Message *cachedResponse = nullptr;
-    Error    error          = kErrorNotFound;
-#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    Message *        cachedResponse = nullptr;
+    Error            error          = kErrorNotFound;
     Option::Iterator iterator;
-    char *           curUriPath         = uriPath;
-    uint8_t          blockOptionType    = 0;
-    uint32_t         totalTransfereSize = 0;
+    uint32_t         uriPathHash   = kUriPathHashInit;
+    uint16_t         uriPathLength = 0;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    uint8_t  blockOptionType    = 0;
+    uint32_t totalTransfereSize = 0;
 #endif
 
     if (mInterceptor != nullptr)
@@ -1286,15 +1444,7 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
         switch (iterator.GetOption()->GetNumber())
         {
         case kOptionUriPath:
-            if (curUriPath != uriPath)
-            {
-                *curUriPath++ = '/';
-            }
-
-            VerifyOrExit(curUriPath + iterator.GetOption()->GetLength() < OT_ARRAY_END(uriPath), error = kErrorParse);
-
-            IgnoreError(iterator.ReadOptionValue(curUriPath));
-            curUriPath += iterator.GetOption()->GetLength();
+            SuccessOrExit(error = UpdateUriPathHash(uriPathHash, uriPathLength, iterator));
             break;
 
         case kOptionBlock1:
@@ -1317,15 +1467,16 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
         SuccessOrExit(error = iterator.Advance());
     }
 
-    curUriPath[0] = '\0';
-
-    for (const ResourceBlockWise *resource = mBlockWiseResources.GetHead(); resource; resource = resource->GetNext())
+    for (ResourceBlockWise *resource = mBlockWiseResources.GetFirstInBucket(uriPathHash); resource != nullptr;
+         resource                    = ResourceList<ResourceBlockWise>::GetNextInBucket(*resource))
     {
-        if (strcmp(resource->GetUriPath(), uriPath) != 0)
+        if ((resource->mUriPathHash != uriPathHash) || !MatchesUriPath(aMessage, resource->GetUriPath()))
         {
             continue;
         }
 
+        resource->mHitCount++;
+
         if ((resource->mReceiveHook != nullptr || resource->mTransmitHook != nullptr) && blockOptionType != 0)
         {
             switch (blockOptionType)
@@ -1377,13 +1528,26 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
         }
     }
 #else
-    SuccessOrExit(error = aMessage.ReadUriPathOptions(uriPath));
+    SuccessOrExit(error = iterator.Init(aMessage, kOptionUriPath));
+
+    while (!iterator.IsDone())
+    {
+        SuccessOrExit(error = UpdateUriPathHash(uriPathHash, uriPathLength, iterator));
+        SuccessOrExit(error = iterator.Advance(kOptionUriPath));
+    }
 #endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 
-    for (const Resource *resource = mResources.GetHead(); resource; resource = resource->GetNext())
+    // The URI path of the request is never assembled. Resources are
+    // looked up in the bucket of the hash computed from the Uri-Path
+    // options while they are parsed, and a hash match is confirmed by
+    // comparing the option values in place in the message.
+
+    for (Resource *resource = mResources.GetFirstInBucket(uriPathHash); resource != nullptr;
+         resource           = ResourceList<Resource>::GetNextInBucket(*resource))
     {
-        if (strcmp(resource->mUriPath, uriPath) == 0)
+        if ((resource->mUriPathHash == uriPathHash) && MatchesUriPath(aMessage, resource->GetUriPath()))
         {
+            resource->mHitCount++;
             resource->HandleRequest(aMessage, aMessageInfo);
             error = kErrorNone;
             ExitNow();
@@ -1411,6 +1575,97 @@ exit:
     }
 }
 
+uint32_t CoapBase::HashUriPath(const char *aUriPath)
+{
+    uint32_t hash = kUriPathHashInit;
+
+    for (; *aUriPath != '\0'; aUriPath++)
+    {
+        hash = UpdateUriPathHash(hash, static_cast<uint8_t>(*aUriPath));
+    }
+
+    return hash;
+}
+
+uint32_t CoapBase::UpdateUriPathHash(uint32_t aHash, uint8_t aByte)
+{
+    // FNV-1a
+
+    return (aHash ^ aByte) * kUriPathHashPrime;
+}
+
+Error CoapBase::UpdateUriPathHash(uint32_t &aHash, uint16_t &aLength, const Option::Iterator &aIterator)
+{
+    // Hashes the value of the Uri-Path option the iterator points to,
+    // preceded by a '/' separator for all but the first segment. The
+    // result is then the same as `HashUriPath()` of the full path.
+
+    Error    error        = kErrorNone;
+    uint16_t optionLength = aIterator.GetOption()->GetLength();
+    uint16_t offset       = aIterator.GetOptionValueMessageOffset();
+    uint8_t  buffer[kUriPathReadSize];
+
+    if (aLength != 0)
+    {
+        aHash = UpdateUriPathHash(aHash, static_cast<uint8_t>('/'));
+        aLength++;
+    }
+
+    VerifyOrExit(aLength + optionLength <= Message::kMaxReceivedUriPath, error = kErrorParse);
+    aLength += optionLength;
+
+    while (optionLength > 0)
+    {
+        uint16_t readLength = OT_MIN(optionLength, static_cast<uint16_t>(sizeof(buffer)));
+
+        aIterator.GetMessage().ReadBytes(offset, buffer, readLength);
+
+        for (uint16_t i = 0; i < readLength; i++)
+        {
+            aHash = UpdateUriPathHash(aHash, buffer[i]);
+        }
+
+        offset += readLength;
+        optionLength -= readLength;
+    }
+
+exit:
+    return error;
+}
+
+bool CoapBase::MatchesUriPath(const Message &aMessage, const char *aUriPath)
+{
+    bool             matches = false;
+    Option::Iterator iterator;
+
+    SuccessOrExit(iterator.Init(aMessage, kOptionUriPath));
+
+    while (!iterator.IsDone())
+    {
+        const char *segmentEnd = strchr(aUriPath, '/');
+        uint16_t    segmentLength;
+
+        segmentLength = static_cast<uint16_t>((segmentEnd != nullptr) ? (segmentEnd - aUriPath) : strlen(aUriPath));
+
+        VerifyOrExit(segmentLength == iterator.GetOption()->GetLength());
+        VerifyOrExit(aMessage.CompareBytes(iterator.GetOptionValueMessageOffset(), aUriPath, segmentLength));
+        aUriPath += segmentLength;
+
+        SuccessOrExit(iterator.Advance(kOptionUriPath));
+
+        if (!iterator.IsDone())
+        {
+            VerifyOrExit(*aUriPath == '/');
+            aUriPath++;
+        }
+    }
+
+    matches = (*aUriPath == '\0');
+
+exit:
+    return matches;
+}
+
 void CoapBase::Metadata::ReadFrom(const Message &aMessage)
 {
     uint16_t length = aMessage.GetLength();
@@ -1419,9 +1674,9 @@ void CoapBase::Metadata::ReadFrom(const Message &aMessage)
     IgnoreError(aMessage.Read(length - sizeof(*this), *this));
 }
 
-void CoapBase::Metadata::UpdateIn(Message &aMessage) const
+Error CoapBase::Metadata::UpdateIn(Message &aMessage) const
 {
-    aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
+    return aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
 }
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
@@ -1439,30 +1694,29 @@ Error ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
     cacheResponse = FindMatchedResponse(aRequest, aMessageInfo);
     VerifyOrExit(cacheResponse != nullptr, error = kErrorNotFound);
 
-    *aResponse = cacheResponse->Clone(cacheResponse->GetLength() - sizeof(ResponseMetadata));
+    *aResponse = cacheResponse->CloneShared(cacheResponse->GetLength() - sizeof(ResponseMetadata));
     VerifyOrExit(*aResponse != nullptr, error = kErrorNoBufs);
 
 exit:
     return error;
 }
 
-const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
 {
-    Message *message;
+    const Message *message = nullptr;
 
-    for (message = mQueue.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    for (TransactionTable::Entry *entry = mTable.FindWithMessageId(aRequest.GetMessageId()); entry != nullptr;
+         entry                          = mTable.FindNextWithMessageId(*entry))
     {
-        if (message->GetMessageId() == aRequest.GetMessageId())
-        {
-            ResponseMetadata metadata;
+        ResponseMetadata metadata;
 
-            metadata.ReadFrom(*message);
+        metadata.ReadFrom(entry->GetMessage());
 
-            if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
-                (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
-            {
-                break;
-            }
+        if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
+            (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
+        {
+            message = &entry->GetMessage();
+            break;
         }
     }
 
@@ -1475,8 +1729,8 @@ void ResponsesQueue::EnqueueResponse(Message &               aMessage,
 {
     Message *        responseCopy;
     ResponseMetadata metadata;
+    TimeMilli        dequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
 
-    metadata.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
     metadata.mMessageInfo = aMessageInfo;
 
     VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == nullptr);
@@ -1487,9 +1741,10 @@ void ResponsesQueue::EnqueueResponse(Message &               aMessage,
 
     VerifyOrExit(metadata.AppendTo(*responseCopy) == kErrorNone, responseCopy->Free());
 
+    mTable.Schedule(*mTable.Add(*responseCopy), dequeueTime);
     mQueue.Enqueue(*responseCopy);
 
-    mTimer.FireAtIfEarlier(metadata.mDequeueTime);
+    mTimer.FireAtIfEarlier(dequeueTime);
 
 exit:
     return;
@@ -1497,37 +1752,22 @@ exit:
 
 void ResponsesQueue::UpdateQueue(void)
 {
-    uint16_t  msgCount    = 0;
-    Message * earliestMsg = nullptr;
-    TimeMilli earliestDequeueTime(0);
-
-    // Check the number of messages in the queue and if number is at
-    // `kMaxCachedResponses` remove the one with earliest dequeue
-    // time.
+    // If the number of messages in the queue is at `kMaxCachedResponses`
+    // remove the one with earliest dequeue time.
 
-    for (Message *message = mQueue.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    if (mTable.IsFull())
     {
-        ResponseMetadata metadata;
-
-        metadata.ReadFrom(*message);
-
-        if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
-        {
-            earliestMsg         = message;
-            earliestDequeueTime = metadata.mDequeueTime;
-        }
-
-        msgCount++;
-    }
-
-    if (msgCount >= kMaxCachedResponses)
-    {
-        DequeueResponse(*earliestMsg);
+        DequeueResponse(mTable.GetEarliest()->GetMessage());
     }
 }
 
 void ResponsesQueue::DequeueResponse(Message &aMessage)
 {
+    TransactionTable::Entry *entry = mTable.Find(aMessage);
+
+    OT_ASSERT(entry != nullptr);
+    mTable.Remove(*entry);
+
     mQueue.Dequeue(aMessage);
     aMessage.Free();
 }
@@ -1538,8 +1778,11 @@ void ResponsesQueue::DequeueAllResponses(void)
 
     while ((message = mQueue.GetHead()) != nullptr)
     {
-        DequeueResponse(*message);
+        mQueue.Dequeue(*message);
+        message->Free();
     }
+
+    mTable.Clear();
 }
 
 void ResponsesQueue::HandleTimer(Timer &aTimer)
@@ -1549,33 +1792,17 @@ void ResponsesQueue::HandleTimer(Timer &aTimer)
 
 void ResponsesQueue::HandleTimer(void)
 {
-    TimeMilli now             = TimerMilli::GetNow();
-    TimeMilli nextDequeueTime = now.GetDistantFuture();
-    Message * nextMessage;
+    TimeMilli                now = TimerMilli::GetNow();
+    TransactionTable::Entry *entry;
 
-    for (Message *message = mQueue.GetHead(); message != nullptr; message = nextMessage)
+    while (((entry = mTable.GetEarliest()) != nullptr) && (entry->GetTime() <= now))
     {
-        ResponseMetadata metadata;
-
-        nextMessage = message->GetNextCoapMessage();
-
-        metadata.ReadFrom(*message);
-
-        if (now >= metadata.mDequeueTime)
-        {
-            DequeueResponse(*message);
-            continue;
-        }
-
-        if (metadata.mDequeueTime < nextDequeueTime)
-        {
-            nextDequeueTime = metadata.mDequeueTime;
-        }
+        DequeueResponse(entry->GetMessage());
     }
 
-    if (nextDequeueTime < now.GetDistantFuture())
+    if (entry != nullptr)
     {
-        mTimer.FireAt(nextDequeueTime);
+        mTimer.FireAt(entry->GetTime());
     }
 }
 
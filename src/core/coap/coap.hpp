@@ -31,9 +31,12 @@
 
 #include "openthread-core-config.h"
 
+#include <string.h>
+
 #include <openthread/coap.h>
 
 #include "coap/coap_message.hpp"
+#include "coap/coap_transaction_table.hpp"
 #include "common/debug.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
@@ -155,10 +158,12 @@ public:
      */
     Resource(const char *aUriPath, RequestHandler aHandler, void *aContext)
     {
-        mUriPath = aUriPath;
-        mHandler = aHandler;
-        mContext = aContext;
-        mNext    = nullptr;
+        mUriPath     = aUriPath;
+        mHandler     = aHandler;
+        mContext     = aContext;
+        mNext        = nullptr;
+        mUriPathHash = 0;
+        mHitCount    = 0;
     }
 
     /**
@@ -169,6 +174,14 @@ public:
      */
     const char *GetUriPath(void) const { return mUriPath; }
 
+    /**
+     * This method returns the number of requests dispatched to the resource since it was added.
+     *
+     * @returns The number of requests dispatched to the resource.
+     *
+     */
+    uint32_t GetHitCount(void) const { return mHitCount; }
+
 protected:
     void HandleRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
     {
@@ -209,6 +222,8 @@ public:
         mReceiveHook  = aReceiveHook;
         mTransmitHook = aTransmitHook;
         mNext         = nullptr;
+        mUriPathHash  = 0;
+        mHitCount     = 0;
     }
 
     Error HandleBlockReceive(const uint8_t *aBlock,
@@ -263,6 +278,14 @@ public:
      */
     const char *GetUriPath(void) const { return mUriPath; }
 
+    /**
+     * This method returns the number of requests dispatched to the resource since it was added.
+     *
+     * @returns The number of requests dispatched to the resource.
+     *
+     */
+    uint32_t GetHitCount(void) const { return mHitCount; }
+
 protected:
     void HandleRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
     {
@@ -340,19 +363,19 @@ private:
         Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void  ReadFrom(const Message &aMessage);
 
-        TimeMilli        mDequeueTime;
         Ip6::MessageInfo mMessageInfo;
     };
 
-    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
     void           DequeueResponse(Message &aMessage);
     void           UpdateQueue(void);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    MessageQueue      mQueue;
-    TimerMilliContext mTimer;
+    MessageQueue                                mQueue;
+    TransactionTableArray<kMaxCachedResponses> mTable;
+    TimerMilliContext                           mTimer;
 };
 
 /**
@@ -693,11 +716,102 @@ protected:
     void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    enum : uint8_t
+    {
+        kMaxPendingRequests = OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS,
+    };
+
+    enum : uint32_t
+    {
+        kUriPathHashInit  = 2166136261u, // FNV-1a 32-bit offset basis.
+        kUriPathHashPrime = 16777619u,   // FNV-1a 32-bit prime.
+    };
+
+    enum : uint8_t
+    {
+        kUriPathReadSize    = 16, // Number of Uri-Path option bytes read from message at a time (for hashing).
+        kNumResourceBuckets = 8,  // Number of URI path hash buckets indexing the resources.
+    };
+
+    // The resources are kept in a single linked list in which the
+    // resources in the same URI path hash bucket are contiguous. Each
+    // bucket points to its first resource, so a lookup only visits the
+    // resources of one bucket. Resources are caller-owned, so the index
+    // needs no storage in them beyond the URI path hash.
+    template <typename ResourceType> class ResourceList : private LinkedList<ResourceType>
+    {
+    public:
+        ResourceList(void) { memset(mBuckets, 0, sizeof(mBuckets)); }
+
+        Error Add(ResourceType &aResource)
+        {
+            Error         error = kErrorNone;
+            ResourceType *prev  = nullptr;
+
+            VerifyOrExit(!this->Contains(aResource), error = kErrorAlready);
+
+            aResource.mUriPathHash = HashUriPath(aResource.GetUriPath());
+
+            {
+                ResourceType *&bucket = mBuckets[GetBucket(aResource)];
+
+                // The new resource is placed first in its bucket.
+                if ((bucket != nullptr) && (this->Find(*bucket, prev) == kErrorNone) && (prev != nullptr))
+                {
+                    this->PushAfter(aResource, *prev);
+                }
+                else
+                {
+                    this->Push(aResource);
+                }
+
+                bucket = &aResource;
+            }
+
+        exit:
+            return error;
+        }
+
+        void Remove(ResourceType &aResource)
+        {
+            ResourceType *prev;
+
+            SuccessOrExit(this->Find(aResource, prev));
+
+            if (mBuckets[GetBucket(aResource)] == &aResource)
+            {
+                mBuckets[GetBucket(aResource)] = GetNextInBucket(aResource);
+            }
+
+            this->PopAfter(prev);
+
+        exit:
+            return;
+        }
+
+        ResourceType *GetFirstInBucket(uint32_t aUriPathHash) { return mBuckets[aUriPathHash % kNumResourceBuckets]; }
+
+        static ResourceType *GetNextInBucket(ResourceType &aResource)
+        {
+            ResourceType *next = aResource.GetNext();
+
+            return ((next != nullptr) && (GetBucket(*next) == GetBucket(aResource))) ? next : nullptr;
+        }
+
+    private:
+        static uint8_t GetBucket(const ResourceType &aResource)
+        {
+            return static_cast<uint8_t>(aResource.mUriPathHash % kNumResourceBuckets);
+        }
+
+        ResourceType *mBuckets[kNumResourceBuckets];
+    };
+
     struct Metadata
     {
         Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void  ReadFrom(const Message &aMessage);
-        void  UpdateIn(Message &aMessage) const;
+        Error UpdateIn(Message &aMessage) const;
 
         Ip6::Address    mSourceAddress;            // IPv6 address of the message source.
         Ip6::Address    mDestinationAddress;       // IPv6 address of the message destination.
@@ -728,9 +842,13 @@ private:
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
+    bool ProcessRetransmission(Message &aMessage, Metadata &aMetadata, TimeMilli aNow);
+
     void     ClearRequests(const Ip6::Address *aAddress);
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata);
     void     DequeueMessage(Message &aMessage);
+    void     IndexRequest(Message &aMessage, const Metadata &aMetadata);
+    void     IndexNextUnindexedRequest(void);
     Message *FindRelatedRequest(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo, Metadata &aMetadata);
     void     FinalizeCoapTransaction(Message &               aRequest,
                                      const Metadata &        aMetadata,
@@ -738,6 +856,19 @@ private:
                                      const Ip6::MessageInfo *aMessageInfo,
                                      Error                   aResult);
 
+    static bool IsRelatedRequest(const Message &         aRequest,
+                                 const Metadata &        aMetadata,
+                                 const Message &         aResponse,
+                                 const Ip6::MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    static bool IsSubscription(const Message &aMessage, const Metadata &aMetadata)
+    {
+        return aMessage.IsRequest() && aMetadata.mObserve && aMetadata.mAcknowledged;
+    }
+#else
+    static bool IsSubscription(const Message &, const Metadata &) { return false; }
+#endif
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     void  FreeLastBlockResponse(void);
     Error CacheLastBlockResponse(Message *aResponse);
@@ -758,6 +889,11 @@ private:
     void ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    static uint32_t HashUriPath(const char *aUriPath);
+    static uint32_t UpdateUriPathHash(uint32_t aHash, uint8_t aByte);
+    static Error    UpdateUriPathHash(uint32_t &aHash, uint16_t &aLength, const Option::Iterator &aIterator);
+    static bool     MatchesUriPath(const Message &aMessage, const char *aUriPath);
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     Error SendNextBlock1Request(Message &               aRequest,
                                 Message &               aMessage,
@@ -775,11 +911,13 @@ private:
 
     Error Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    MessageQueue      mPendingRequests;
-    uint16_t          mMessageId;
-    TimerMilliContext mRetransmissionTimer;
+    MessageQueue                               mPendingRequests;
+    TransactionTableArray<kMaxPendingRequests> mPendingRequestTable;
+    uint16_t                                   mNumUnindexedRequests;
+    uint16_t                                   mMessageId;
+    TimerMilliContext                          mRetransmissionTimer;
 
-    LinkedList<Resource> mResources;
+    ResourceList<Resource> mResources;
 
     void *         mContext;
     Interceptor    mInterceptor;
@@ -791,8 +929,8 @@ private:
     const Sender mSender;
 
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
-    LinkedList<ResourceBlockWise> mBlockWiseResources;
-    Message *                     mLastResponse;
+    ResourceList<ResourceBlockWise> mBlockWiseResources;
+    Message *                       mLastResponse;
 #endif
 };
 
@@ -125,7 +125,7 @@ void Message::Finish(void)
         IgnoreError(SetLength(GetLength() - 1));
     }
 
-    WriteBytes(0, &GetHelpData().mHeader, GetOptionStart());
+    IgnoreError(WriteBytes(0, &GetHelpData().mHeader, GetOptionStart()));
 }
 
 uint8_t Message::WriteExtendedOptionField(uint16_t aValue, uint8_t *&aBuffer)
@@ -436,6 +436,18 @@ exit:
     return message;
 }
 
+Message *Message::CloneShared(uint16_t aLength) const
+{
+    Message *message = static_cast<Message *>(ot::Message::CloneShared(aLength));
+
+    VerifyOrExit(message != nullptr);
+
+    message->GetHelpData() = GetHelpData();
+
+exit:
+    return message;
+}
+
 #if OPENTHREAD_CONFIG_COAP_API_ENABLE
 const char *Message::CodeToString(void) const
 {
@@ -831,6 +831,18 @@ public:
      */
     Message *Clone(void) const { return Clone(GetLength()); }
 
+    /**
+     * This method creates a copy of this CoAP message which shares the payload buffers with the original one.
+     *
+     * @sa ot::Message::CloneShared(uint16_t aLength)
+     *
+     * @param[in] aLength  Number of payload bytes to share.
+     *
+     * @returns A pointer to the message or nullptr if insufficient message buffers are available.
+     *
+     */
+    Message *CloneShared(uint16_t aLength) const;
+
     /**
      * This method returns the minimal reserved bytes required for CoAP message.
      *
@@ -1179,6 +1191,16 @@ public:
          */
         Error ReadOptionValue(uint64_t &aUintValue) const;
 
+        /**
+         * This method gets the offset of the current option value in the message.
+         *
+         * This method MUST be used when the iterator is not done (i.e. it points to an option).
+         *
+         * @returns The offset of the current option value in the message.
+         *
+         */
+        uint16_t GetOptionValueMessageOffset(void) const { return mNextOptionOffset - mOption.mLength; }
+
         /**
          * This method gets the offset of beginning of the CoAP message payload (after the CoAP header).
          *
@@ -0,0 +1,223 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the CoAP transaction table.
+ */
+
+#include "coap_transaction_table.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+namespace ot {
+namespace Coap {
+
+TransactionTable::TransactionTable(Entry *aEntries, uint8_t *aBuckets, uint8_t aMaxEntries)
+    : mEntries(aEntries)
+    , mBuckets(aBuckets)
+    , mMaxEntries(aMaxEntries)
+    , mNumEntries(0)
+    , mFreeHead(kInvalidIndex)
+{
+}
+
+void TransactionTable::Clear(void)
+{
+    // Free entries are chained through `mNextWithMessageId`.
+
+    for (uint8_t index = 0; index < mMaxEntries; index++)
+    {
+        mEntries[index].mMessage           = nullptr;
+        mEntries[index].mNextWithMessageId = (index + 1 < mMaxEntries) ? index + 1 : kInvalidIndex;
+        mEntries[index].mIsScheduled       = false;
+    }
+
+    for (uint16_t bucket = 0; bucket < 2 * mMaxEntries; bucket++)
+    {
+        mBuckets[bucket] = kInvalidIndex;
+    }
+
+    mSchedule   = PairingHeap<Entry, TimeCompare>();
+    mNumEntries = 0;
+    mFreeHead   = 0;
+}
+
+TransactionTable::Entry *TransactionTable::Add(Message &aMessage)
+{
+    Entry * entry = nullptr;
+    uint8_t index = mFreeHead;
+
+    VerifyOrExit(index != kInvalidIndex);
+
+    entry     = &mEntries[index];
+    mFreeHead = entry->mNextWithMessageId;
+
+    entry->mMessage           = &aMessage;
+    entry->mNextWithMessageId = kInvalidIndex;
+    entry->mNextWithToken     = kInvalidIndex;
+    entry->mIsScheduled       = false;
+
+    AddToBucket(mBuckets[aMessage.GetMessageId() % mMaxEntries], &Entry::mNextWithMessageId, index);
+    AddToBucket(mBuckets[mMaxEntries + HashToken(aMessage)], &Entry::mNextWithToken, index);
+
+    mNumEntries++;
+
+exit:
+    return entry;
+}
+
+void TransactionTable::Remove(Entry &aEntry)
+{
+    uint8_t index = GetIndexOf(aEntry);
+
+    OT_ASSERT(aEntry.mMessage != nullptr);
+
+    Unschedule(aEntry);
+
+    RemoveFromBucket(mBuckets[aEntry.mMessage->GetMessageId() % mMaxEntries], &Entry::mNextWithMessageId, index);
+    RemoveFromBucket(mBuckets[mMaxEntries + HashToken(*aEntry.mMessage)], &Entry::mNextWithToken, index);
+
+    aEntry.mMessage           = nullptr;
+    aEntry.mNextWithMessageId = mFreeHead;
+    mFreeHead                 = index;
+
+    mNumEntries--;
+}
+
+TransactionTable::Entry *TransactionTable::Find(const Message &aMessage)
+{
+    Entry *entry;
+
+    for (entry = FindWithMessageId(aMessage.GetMessageId()); entry != nullptr; entry = FindNextWithMessageId(*entry))
+    {
+        if (entry->mMessage == &aMessage)
+        {
+            break;
+        }
+    }
+
+    return entry;
+}
+
+TransactionTable::Entry *TransactionTable::GetNextWithMessageId(uint8_t aIndex, uint16_t aMessageId)
+{
+    Entry *entry = nullptr;
+
+    for (; aIndex != kInvalidIndex; aIndex = mEntries[aIndex].mNextWithMessageId)
+    {
+        if (mEntries[aIndex].mMessage->GetMessageId() == aMessageId)
+        {
+            entry = &mEntries[aIndex];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+TransactionTable::Entry *TransactionTable::GetNextWithToken(uint8_t aIndex, const Message &aMessage)
+{
+    Entry *entry = nullptr;
+
+    for (; aIndex != kInvalidIndex; aIndex = mEntries[aIndex].mNextWithToken)
+    {
+        if (mEntries[aIndex].mMessage->IsTokenEqual(aMessage))
+        {
+            entry = &mEntries[aIndex];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+uint8_t TransactionTable::HashToken(const Message &aMessage) const
+{
+    const uint8_t *token = aMessage.GetToken();
+    uint16_t       hash  = aMessage.GetTokenLength();
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        hash = static_cast<uint16_t>((hash << 3) ^ (hash >> 13) ^ token[i]);
+    }
+
+    return static_cast<uint8_t>(hash % mMaxEntries);
+}
+
+void TransactionTable::AddToBucket(uint8_t &aHead, uint8_t Entry::*aNext, uint8_t aIndex)
+{
+    // The new entry is appended at the tail so that the bucket stays
+    // ordered from the oldest to the newest entry.
+
+    uint8_t *next = &aHead;
+
+    while (*next != kInvalidIndex)
+    {
+        next = &(mEntries[*next].*aNext);
+    }
+
+    *next = aIndex;
+}
+
+void TransactionTable::RemoveFromBucket(uint8_t &aHead, uint8_t Entry::*aNext, uint8_t aIndex)
+{
+    uint8_t *next = &aHead;
+
+    while (*next != aIndex)
+    {
+        OT_ASSERT(*next != kInvalidIndex);
+        next = &(mEntries[*next].*aNext);
+    }
+
+    *next = mEntries[aIndex].*aNext;
+}
+
+void TransactionTable::Schedule(Entry &aEntry, TimeMilli aTime)
+{
+    Unschedule(aEntry);
+
+    aEntry.mTime        = aTime;
+    aEntry.mIsScheduled = true;
+    mSchedule.Add(aEntry);
+}
+
+void TransactionTable::Unschedule(Entry &aEntry)
+{
+    VerifyOrExit(aEntry.IsScheduled());
+
+    mSchedule.Remove(aEntry);
+    aEntry.mIsScheduled = false;
+
+exit:
+    return;
+}
+
+} // namespace Coap
+} // namespace ot
@@ -0,0 +1,299 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the CoAP transaction table.
+ */
+
+#ifndef COAP_TRANSACTION_TABLE_HPP_
+#define COAP_TRANSACTION_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#include "coap/coap_message.hpp"
+#include "common/non_copyable.hpp"
+#include "common/pairing_heap.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+namespace Coap {
+
+/**
+ * This class implements an in-RAM index of CoAP messages held in a message queue (pending requests or cached
+ * responses).
+ *
+ * Every entry refers to a message and can be looked up by the message's Message ID or Token, without reading from
+ * the message buffers beyond the CoAP header. Entries can also be scheduled at a given time, and the entry with the
+ * earliest time is kept at the top of a `PairingHeap`.
+ *
+ * The table does not own the messages. The user is responsible for keeping it in sync with the message queue.
+ *
+ */
+class TransactionTable : private NonCopyable
+{
+public:
+    /**
+     * This class represents an entry in the table.
+     *
+     */
+    class Entry
+    {
+        friend class TransactionTable;
+        template <typename, typename> friend class ot::PairingHeap;
+
+    public:
+        /**
+         * This method returns the message associated with the entry.
+         *
+         * @returns A reference to the message.
+         *
+         */
+        Message &GetMessage(void) const { return *mMessage; }
+
+        /**
+         * This method indicates whether the entry is scheduled.
+         *
+         * @retval TRUE   If the entry is scheduled.
+         * @retval FALSE  If the entry is not scheduled.
+         *
+         */
+        bool IsScheduled(void) const { return mIsScheduled; }
+
+        /**
+         * This method returns the time the entry is scheduled at.
+         *
+         * This method MUST be used only when the entry is scheduled.
+         *
+         * @returns The time the entry is scheduled at.
+         *
+         */
+        TimeMilli GetTime(void) const { return mTime; }
+
+    private:
+        Message * mMessage;
+        TimeMilli mTime;
+        Entry *   mHeapChild;
+        Entry *   mHeapNext;
+        Entry *   mHeapPrev;
+        uint8_t   mNextWithMessageId;
+        uint8_t   mNextWithToken;
+        bool      mIsScheduled;
+    };
+
+    /**
+     * This method adds a message to the table.
+     *
+     * The entry is not scheduled.
+     *
+     * @param[in]  aMessage  The message to add. Its CoAP header MUST be valid.
+     *
+     * @returns A pointer to the new entry, or nullptr if the table is full.
+     *
+     */
+    Entry *Add(Message &aMessage);
+
+    /**
+     * This method removes an entry from the table.
+     *
+     * @param[in]  aEntry  The entry to remove.
+     *
+     */
+    void Remove(Entry &aEntry);
+
+    /**
+     * This method removes all entries from the table.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method indicates whether the table is full.
+     *
+     * @retval TRUE   If the table is full.
+     * @retval FALSE  If the table is not full.
+     *
+     */
+    bool IsFull(void) const { return mNumEntries == mMaxEntries; }
+
+    /**
+     * This method finds the entry associated with a given message.
+     *
+     * @param[in]  aMessage  The message.
+     *
+     * @returns A pointer to the entry, or nullptr if @p aMessage is not in the table.
+     *
+     */
+    Entry *Find(const Message &aMessage);
+
+    /**
+     * This method finds the first (oldest) entry whose message has a given Message ID.
+     *
+     * @param[in]  aMessageId  The Message ID.
+     *
+     * @returns A pointer to the entry, or nullptr if no match was found.
+     *
+     */
+    Entry *FindWithMessageId(uint16_t aMessageId)
+    {
+        return GetNextWithMessageId(GetMessageIdBucket(aMessageId), aMessageId);
+    }
+
+    /**
+     * This method finds the next entry after a given one whose message has the same Message ID.
+     *
+     * @param[in]  aEntry  An entry previously returned by `FindWithMessageId()` or `FindNextWithMessageId()`.
+     *
+     * @returns A pointer to the entry, or nullptr if no other match was found.
+     *
+     */
+    Entry *FindNextWithMessageId(const Entry &aEntry)
+    {
+        return GetNextWithMessageId(aEntry.mNextWithMessageId, aEntry.mMessage->GetMessageId());
+    }
+
+    /**
+     * This method finds the first (oldest) entry whose message has the same Token as a given message.
+     *
+     * @param[in]  aMessage  The message containing the Token.
+     *
+     * @returns A pointer to the entry, or nullptr if no match was found.
+     *
+     */
+    Entry *FindWithToken(const Message &aMessage) { return GetNextWithToken(GetTokenBucket(aMessage), aMessage); }
+
+    /**
+     * This method finds the next entry after a given one whose message has the same Token as a given message.
+     *
+     * @param[in]  aEntry    An entry previously returned by `FindWithToken()` or `FindNextWithToken()`.
+     * @param[in]  aMessage  The message containing the Token.
+     *
+     * @returns A pointer to the entry, or nullptr if no other match was found.
+     *
+     */
+    Entry *FindNextWithToken(const Entry &aEntry, const Message &aMessage)
+    {
+        return GetNextWithToken(aEntry.mNextWithToken, aMessage);
+    }
+
+    /**
+     * This method schedules (or re-schedules) an entry at a given time.
+     *
+     * @param[in]  aEntry  The entry.
+     * @param[in]  aTime   The time.
+     *
+     */
+    void Schedule(Entry &aEntry, TimeMilli aTime);
+
+    /**
+     * This method unschedules an entry.
+     *
+     * @param[in]  aEntry  The entry.
+     *
+     */
+    void Unschedule(Entry &aEntry);
+
+    /**
+     * This method returns the scheduled entry with the earliest time.
+     *
+     * @returns A pointer to the earliest scheduled entry, or nullptr if no entry is scheduled.
+     *
+     */
+    Entry *GetEarliest(void) { return mSchedule.GetTop(); }
+
+protected:
+    enum : uint8_t
+    {
+        kInvalidIndex = 0xff,
+    };
+
+    /**
+     * This constructor initializes the table.
+     *
+     * @param[in]  aEntries     An array of @p aMaxEntries entries.
+     * @param[in]  aBuckets     An array of 2 * @p aMaxEntries bucket heads.
+     * @param[in]  aMaxEntries  The maximum number of entries.
+     *
+     */
+    TransactionTable(Entry *aEntries, uint8_t *aBuckets, uint8_t aMaxEntries);
+
+private:
+    struct TimeCompare
+    {
+        bool operator()(const Entry &aFirst, const Entry &aSecond) const { return aFirst.mTime < aSecond.mTime; }
+    };
+
+    uint8_t GetIndexOf(const Entry &aEntry) const { return static_cast<uint8_t>(&aEntry - mEntries); }
+    uint8_t GetMessageIdBucket(uint16_t aMessageId) const { return mBuckets[aMessageId % mMaxEntries]; }
+    uint8_t GetTokenBucket(const Message &aMessage) const { return mBuckets[mMaxEntries + HashToken(aMessage)]; }
+    uint8_t HashToken(const Message &aMessage) const;
+
+    Entry *GetNextWithMessageId(uint8_t aIndex, uint16_t aMessageId);
+    Entry *GetNextWithToken(uint8_t aIndex, const Message &aMessage);
+
+    void AddToBucket(uint8_t &aHead, uint8_t Entry::*aNext, uint8_t aIndex);
+    void RemoveFromBucket(uint8_t &aHead, uint8_t Entry::*aNext, uint8_t aIndex);
+
+    Entry *                         mEntries;
+    uint8_t *                       mBuckets;
+    PairingHeap<Entry, TimeCompare> mSchedule;
+    const uint8_t                   mMaxEntries;
+    uint8_t                         mNumEntries;
+    uint8_t                         mFreeHead;
+};
+
+/**
+ * This template class implements a `TransactionTable` with a given maximum number of entries.
+ *
+ * @tparam kMaxEntries  The maximum number of entries.
+ *
+ */
+template <uint8_t kMaxEntries> class TransactionTableArray : public TransactionTable
+{
+    static_assert(kMaxEntries > 0 && kMaxEntries < kInvalidIndex, "kMaxEntries is out of range");
+
+public:
+    /**
+     * This constructor initializes the table.
+     *
+     */
+    TransactionTableArray(void)
+        : TransactionTable(mEntries, mBuckets, kMaxEntries)
+    {
+        Clear();
+    }
+
+private:
+    Entry   mEntries[kMaxEntries];
+    uint8_t mBuckets[2 * kMaxEntries];
+};
+
+} // namespace Coap
+} // namespace ot
+
+#endif // COAP_TRANSACTION_TABLE_HPP_
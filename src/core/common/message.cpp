@@ -57,6 +57,7 @@ MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     , mNumFreeBuffers(kNumBuffers)
+    , mNumSavedBuffers(0)
 #endif
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -106,7 +107,7 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(aMessage->Next() == nullptr && aMessage->Prev() == nullptr);
 
-    FreeBuffers(static_cast<Buffer *>(aMessage));
+    FreeBuffers(static_cast<Buffer *>(aMessage), aMessage->GetBufferCount());
 }
 
 Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
@@ -128,6 +129,8 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     mNumFreeBuffers--;
+    mBufferRefCounts[mBufferPool.GetIndexOf(*buffer)]     = 1;
+    mBufferSharedLengths[mBufferPool.GetIndexOf(*buffer)] = 0;
 #endif
 
     buffer->SetNextBuffer(nullptr);
@@ -141,9 +144,12 @@ exit:
     return buffer;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+void MessagePool::FreeBuffers(Buffer *aBuffer, uint16_t aNumBuffers)
 {
-    while (aBuffer != nullptr)
+    // Releases the first `aNumBuffers` buffers of the chain. A buffer
+    // shared with other messages is freed by its last user only.
+
+    for (; aNumBuffers > 0 && aBuffer != nullptr; aNumBuffers--)
     {
         Buffer *next = aBuffer->GetNextBuffer();
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
@@ -151,13 +157,76 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         otPlatMessagePoolFree(&GetInstance(), aBuffer);
 #else
-        mBufferPool.Free(*aBuffer);
-        mNumFreeBuffers++;
+        uint16_t index = mBufferPool.GetIndexOf(*aBuffer);
+
+        OT_ASSERT(mBufferRefCounts[index] > 0);
+
+        if (--mBufferRefCounts[index] == 0)
+        {
+            mBufferPool.Free(*aBuffer);
+            mNumFreeBuffers++;
+        }
+        else
+        {
+            mNumSavedBuffers--;
+
+            if (mBufferRefCounts[index] == 1)
+            {
+                mBufferSharedLengths[index] = 0;
+            }
+        }
 #endif
         aBuffer = next;
     }
 }
 
+void MessagePool::ShareBuffer(Buffer &aBuffer, uint16_t aLength)
+{
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    uint16_t index = mBufferPool.GetIndexOf(aBuffer);
+
+    mBufferRefCounts[index]++;
+    mNumSavedBuffers++;
+
+    if (mBufferSharedLengths[index] < aLength)
+    {
+        mBufferSharedLengths[index] = aLength;
+    }
+#else
+    OT_UNUSED_VARIABLE(aBuffer);
+    OT_UNUSED_VARIABLE(aLength);
+#endif
+}
+
+bool MessagePool::IsBufferShared(const Buffer &aBuffer, uint16_t aOffset) const
+{
+    // Only the message which owned the buffer before it got shared may
+    // use the bytes past the shared length, so it can write to them in
+    // place.
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    uint16_t index = mBufferPool.GetIndexOf(aBuffer);
+
+    return (mBufferRefCounts[index] > 1) && (aOffset < mBufferSharedLengths[index]);
+#else
+    OT_UNUSED_VARIABLE(aBuffer);
+    OT_UNUSED_VARIABLE(aOffset);
+
+    return false;
+#endif
+}
+
+bool MessagePool::IsBufferShared(const Buffer &aBuffer) const
+{
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    return mBufferRefCounts[mBufferPool.GetIndexOf(aBuffer)] > 1;
+#else
+    OT_UNUSED_VARIABLE(aBuffer);
+
+    return false;
+#endif
+}
+
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
 {
     return Get<MeshForwarder>().EvictMessage(aPriority);
@@ -178,6 +247,15 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
     return rval;
 }
 
+uint16_t MessagePool::GetSavedBufferCount(void) const
+{
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    return mNumSavedBuffers;
+#else
+    return 0;
+#endif
+}
+
 uint16_t MessagePool::GetTotalBufferCount(void) const
 {
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
@@ -201,33 +279,154 @@ Message::Settings::Settings(const otMessageSettings *aSettings)
 {
 }
 
-Error Message::ResizeMessage(uint16_t aLength)
+uint16_t Message::CalculateTailBufferCount(uint16_t aLength)
 {
-    Error error = kErrorNone;
+    // Returns the number of buffers (after the first one) needed to
+    // hold `aLength` bytes (including the reserved header bytes).
 
-    // add buffers
-    Buffer * curBuffer = this;
-    Buffer * lastBuffer;
-    uint16_t curLength = kHeadBufferDataSize;
+    return (aLength > kHeadBufferDataSize) ? (aLength - kHeadBufferDataSize + kBufferDataSize - 1) / kBufferDataSize
+                                           : 0;
+}
+
+Buffer *Message::GetBuffer(uint16_t aIndex)
+{
+    Buffer *buffer = this;
 
-    while (curLength < aLength)
+    for (; aIndex > 0; aIndex--)
     {
-        if (curBuffer->GetNextBuffer() == nullptr)
+        buffer = buffer->GetNextBuffer();
+    }
+
+    return buffer;
+}
+
+Error Message::UnshareBuffer(uint16_t aIndex)
+{
+    // Replaces the buffer at `aIndex` by a private copy. The shared
+    // buffers right before it are also copied since the next pointer
+    // of the buffer preceding the copy needs to be updated.
+
+    Error    error      = kErrorNone;
+    Buffer * prevBuffer = this;
+    Buffer * curBuffer  = this;
+    uint16_t firstIndex = 1;
+
+    for (uint16_t index = 1; index <= aIndex; index++)
+    {
+        curBuffer = curBuffer->GetNextBuffer();
+
+        if (!GetMessagePool()->IsBufferShared(*curBuffer))
         {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
-            VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
+            prevBuffer = curBuffer;
+            firstIndex = index + 1;
         }
+    }
 
-        curBuffer = curBuffer->GetNextBuffer();
-        curLength += kBufferDataSize;
+    ClearCachedBuffer();
+
+    for (uint16_t index = firstIndex; index <= aIndex; index++)
+    {
+        Buffer *newBuffer = GetMessagePool()->NewBuffer(GetPriority());
+
+        VerifyOrExit(newBuffer != nullptr, error = kErrorNoBufs);
+
+        curBuffer = prevBuffer->GetNextBuffer();
+        memcpy(newBuffer->GetData(), curBuffer->GetData(), kBufferDataSize);
+        newBuffer->SetNextBuffer(curBuffer->GetNextBuffer());
+        prevBuffer->SetNextBuffer(newBuffer);
+        GetMessagePool()->FreeBuffers(curBuffer, 1);
+
+        prevBuffer = newBuffer;
     }
 
-    // remove buffers
-    lastBuffer = curBuffer;
-    curBuffer  = curBuffer->GetNextBuffer();
-    lastBuffer->SetNextBuffer(nullptr);
+exit:
+    return error;
+}
+
+Error Message::PrepareToWrite(uint16_t aOffset, uint16_t aLength)
+{
+    // Makes sure the bytes `[aOffset, aOffset + aLength)` (offsets
+    // including the reserved header bytes) can be written without
+    // changing the content of other messages sharing the buffers.
+
+    Error          error       = kErrorNone;
+    uint16_t       endOffset   = aOffset + aLength;
+    uint16_t       bufferStart = kHeadBufferDataSize;
+    uint16_t       index       = 1;
+    const Buffer * buffer;
+
+    VerifyOrExit(endOffset > kHeadBufferDataSize);
 
-    GetMessagePool()->FreeBuffers(curBuffer);
+    buffer = GetNextBuffer();
+
+    for (; bufferStart < endOffset; bufferStart += kBufferDataSize, index++)
+    {
+        uint16_t offsetInBuffer = (aOffset > bufferStart) ? aOffset - bufferStart : 0;
+
+        if ((offsetInBuffer < kBufferDataSize) && GetMessagePool()->IsBufferShared(*buffer, offsetInBuffer))
+        {
+            SuccessOrExit(error = UnshareBuffer(index));
+            buffer = GetBuffer(index);
+        }
+
+        if (bufferStart + kBufferDataSize < endOffset)
+        {
+            buffer = buffer->GetNextBuffer();
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Message::ResizeMessage(uint16_t aLength)
+{
+    // Only the buffers covering the current message bytes (including
+    // the reserved header bytes) belong to the message. The next buffer
+    // pointer of the last one may refer to buffers of another message
+    // sharing them (see `CloneShared()`).
+
+    Error    error    = kErrorNone;
+    uint16_t curCount = GetBufferCount() - 1;
+    uint16_t newCount = CalculateTailBufferCount(aLength);
+    Buffer * lastBuffer;
+
+    if (aLength > GetReserved() + GetLength())
+    {
+        // The last buffer is written to or linked to new buffers.
+        SuccessOrExit(error = UnshareBuffer(curCount));
+    }
+
+    lastBuffer = GetBuffer(OT_MIN(curCount, newCount));
+
+    if (newCount > curCount)
+    {
+        Buffer *curBuffer = lastBuffer;
+
+        for (uint16_t count = curCount; count < newCount; count++)
+        {
+            Buffer *newBuffer = GetMessagePool()->NewBuffer(GetPriority());
+
+            if (newBuffer == nullptr)
+            {
+                GetMessagePool()->FreeBuffers(lastBuffer->GetNextBuffer(), count - curCount);
+                ExitNow(error = kErrorNoBufs);
+            }
+
+            curBuffer->SetNextBuffer(newBuffer);
+            curBuffer = newBuffer;
+        }
+    }
+    else if (newCount < curCount)
+    {
+        ClearCachedBuffer();
+        GetMessagePool()->FreeBuffers(lastBuffer->GetNextBuffer(), curCount - newCount);
+
+        if (!GetMessagePool()->IsBufferShared(*lastBuffer))
+        {
+            lastBuffer->SetNextBuffer(nullptr);
+        }
+    }
 
 exit:
     return error;
@@ -284,9 +483,11 @@ exit:
 
 uint8_t Message::GetBufferCount(void) const
 {
-    uint8_t rval = 1;
+    uint8_t  rval      = 1;
+    uint16_t tailCount = CalculateTailBufferCount(GetReserved() + GetLength());
 
-    for (const Buffer *curBuffer = GetNextBuffer(); curBuffer; curBuffer = curBuffer->GetNextBuffer())
+    for (const Buffer *curBuffer = GetNextBuffer(); curBuffer && (rval <= tailCount);
+         curBuffer               = curBuffer->GetNextBuffer())
     {
         rval++;
     }
@@ -382,7 +583,7 @@ Error Message::AppendBytes(const void *aBuf, uint16_t aLength)
     uint16_t oldLength = GetLength();
 
     SuccessOrExit(error = SetLength(GetLength() + aLength));
-    WriteBytes(oldLength, aBuf, aLength);
+    error = WriteBytes(oldLength, aBuf, aLength);
 
 exit:
     return error;
@@ -401,7 +602,7 @@ Error Message::AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset,
 
     while (chunk.GetLength() > 0)
     {
-        WriteBytes(writeOffset, chunk.GetData(), chunk.GetLength());
+        SuccessOrExit(error = WriteBytes(writeOffset, chunk.GetData(), chunk.GetLength()));
         writeOffset += chunk.GetLength();
         aMessage.GetNextChunk(aLength, chunk);
     }
@@ -421,6 +622,7 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
+        ClearCachedBuffer();
 
         if (GetReserved() < sizeof(mBuffer.mHead.mData))
         {
@@ -432,13 +634,15 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
         SetReserved(GetReserved() + kBufferDataSize);
     }
 
+    SuccessOrExit(error = PrepareToWrite(GetReserved() - aLength, aLength));
+
     SetReserved(GetReserved() - aLength);
     GetMetadata().mLength += aLength;
     SetOffset(GetOffset() + aLength);
 
     if (aBuf != nullptr)
     {
-        WriteBytes(0, aBuf, aLength);
+        error = WriteBytes(0, aBuf, aLength);
     }
 
 exit:
@@ -471,6 +675,8 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
     // its length. The `aLength` is also decreased by the chunk
     // length.
 
+    uint16_t bufferOffset;
+
     VerifyOrExit(aOffset < GetLength(), aChunk.mLength = 0);
 
     if (aOffset + aLength >= GetLength())
@@ -491,24 +697,33 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
         ExitNow();
     }
 
-    aOffset -= kHeadBufferDataSize;
+    // Find the `Buffer` matching the offset. The search starts from
+    // the buffer accessed last when it is before the offset, so that
+    // sequential reads (e.g., parsing TLVs) do not walk the buffer
+    // chain from the start.
 
-    // Find the `Buffer` matching the offset
+    aChunk.mBuffer = GetNextBuffer();
+    bufferOffset   = kHeadBufferDataSize;
 
-    while (true)
+    if ((GetMetadata().mCachedBuffer != nullptr) && (aOffset >= GetMetadata().mCachedBufferOffset))
+    {
+        aChunk.mBuffer = GetMetadata().mCachedBuffer;
+        bufferOffset   = GetMetadata().mCachedBufferOffset;
+    }
+
+    while (aOffset - bufferOffset >= kBufferDataSize)
     {
         aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
-        OT_ASSERT(aChunk.mBuffer != nullptr);
+        bufferOffset += kBufferDataSize;
+    }
 
-        if (aOffset < kBufferDataSize)
-        {
-            aChunk.mData   = aChunk.mBuffer->GetData() + aOffset;
-            aChunk.mLength = kBufferDataSize - aOffset;
-            ExitNow();
-        }
+    OT_ASSERT(aChunk.mBuffer != nullptr);
 
-        aOffset -= kBufferDataSize;
-    }
+    GetMetadata().mCachedBuffer       = aChunk.mBuffer;
+    GetMetadata().mCachedBufferOffset = bufferOffset;
+
+    aChunk.mData   = aChunk.mBuffer->GetData() + (aOffset - bufferOffset);
+    aChunk.mLength = kBufferDataSize - (aOffset - bufferOffset);
 
 exit:
     if (aChunk.mLength > aLength)
@@ -529,6 +744,17 @@ void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 
     VerifyOrExit(aLength > 0, aChunk.mLength = 0);
 
+    if (aChunk.mBuffer == this)
+    {
+        GetMetadata().mCachedBuffer       = aChunk.mBuffer->GetNextBuffer();
+        GetMetadata().mCachedBufferOffset = kHeadBufferDataSize;
+    }
+    else if (aChunk.mBuffer == GetMetadata().mCachedBuffer)
+    {
+        GetMetadata().mCachedBuffer = aChunk.mBuffer->GetNextBuffer();
+        GetMetadata().mCachedBufferOffset += kBufferDataSize;
+    }
+
     aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
     OT_ASSERT(aChunk.mBuffer != nullptr);
 
@@ -610,13 +836,16 @@ exit:
     return (bytesToCompare == 0);
 }
 
-void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
+Error Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
+    Error          error  = kErrorNone;
     const uint8_t *bufPtr = reinterpret_cast<const uint8_t *>(aBuf);
     WritableChunk  chunk;
 
     OT_ASSERT(aOffset + aLength <= GetLength());
 
+    SuccessOrExit(error = PrepareToWrite(GetReserved() + aOffset, aLength));
+
     GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
@@ -625,6 +854,9 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
         bufPtr += chunk.GetLength();
         GetNextChunk(aLength, chunk);
     }
+
+exit:
+    return error;
 }
 
 uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
@@ -643,12 +875,13 @@ uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, ui
 
     while (chunk.GetLength() > 0)
     {
-        aMessage.WriteBytes(aDestinationOffset, chunk.GetData(), chunk.GetLength());
+        SuccessOrExit(aMessage.WriteBytes(aDestinationOffset, chunk.GetData(), chunk.GetLength()));
         aDestinationOffset += chunk.GetLength();
         bytesCopied += chunk.GetLength();
         GetNextChunk(aLength, chunk);
     }
 
+exit:
     return bytesCopied;
 }
 
@@ -678,6 +911,65 @@ exit:
     return messageCopy;
 }
 
+Message *Message::CloneShared(uint16_t aLength) const
+{
+    Message *messageCopy;
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    Error    error       = kErrorNone;
+    uint16_t totalLength = GetReserved() + aLength;
+    uint16_t tailCount   = CalculateTailBufferCount(totalLength);
+    Buffer * buffer      = const_cast<Buffer *>(GetNextBuffer());
+
+    VerifyOrExit(aLength <= GetLength(), messageCopy = Clone(aLength));
+
+    VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), 0, GetPriority())) != nullptr, error = kErrorNoBufs);
+
+    memcpy(messageCopy->mBuffer.mHead.mData, mBuffer.mHead.mData, sizeof(mBuffer.mHead.mData));
+
+    // Share the buffers after the first one, the last one being read
+    // by the copy only up to its end.
+
+    messageCopy->SetNextBuffer((tailCount > 0) ? buffer : nullptr);
+
+    for (uint16_t index = 1; index <= tailCount; index++)
+    {
+        uint16_t sharedLength = kBufferDataSize;
+
+        if (index == tailCount)
+        {
+            sharedLength = totalLength - kHeadBufferDataSize - (tailCount - 1) * kBufferDataSize;
+        }
+
+        GetMessagePool()->ShareBuffer(*buffer, sharedLength);
+        buffer = buffer->GetNextBuffer();
+    }
+
+    messageCopy->SetReserved(GetReserved());
+    messageCopy->GetMetadata().mLength = aLength;
+
+    // Copy selected message information.
+    messageCopy->SetOffset(GetOffset() < aLength ? GetOffset() : aLength);
+
+    messageCopy->SetSubType(GetSubType());
+    messageCopy->SetLinkSecurityEnabled(IsLinkSecurityEnabled());
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    messageCopy->SetTimeSync(IsTimeSync());
+#endif
+
+    // The bytes before the offset usually hold the headers which are
+    // updated by the lower layers, so they are copied right away.
+    error = messageCopy->PrepareToWrite(messageCopy->GetReserved(), messageCopy->GetOffset());
+
+exit:
+    FreeAndNullMessageOnError(messageCopy, error);
+#else
+    messageCopy = Clone(aLength);
+#endif
+
+    return messageCopy;
+}
+
 bool Message::GetChildMask(uint16_t aChildIndex) const
 {
     return GetMetadata().mChildMask.Get(aChildIndex);
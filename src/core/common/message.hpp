@@ -140,6 +140,7 @@ enum
     kBufferSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
 };
 
+class Buffer;
 class Message;
 class MessagePool;
 class MessageQueue;
@@ -161,6 +162,9 @@ struct MessageMetadata
         PriorityQueue *mPriority; ///< Identifies the priority queue (if any) where this message is queued.
     } mQueue;                     ///< Identifies the queue (if any) where this message is queued.
 
+    mutable const Buffer *mCachedBuffer;       ///< The buffer accessed last (nullptr if none since last resize).
+    mutable uint16_t      mCachedBufferOffset; ///< The offset (including reserved bytes) of `mCachedBuffer` data.
+
     uint32_t mDatagramTag;    ///< The datagram tag used for 6LoWPAN fragmentation or identification used for IPv6
                               ///< fragmentation.
     uint16_t    mReserved;    ///< Number of header bytes reserved for the message.
@@ -805,12 +809,18 @@ public:
      * This method will not resize the message. The given data to write (with @p aLength bytes) MUST fit within the
      * existing message buffer (from the given offset @p aOffset up to the message's length).
      *
+     * Writing to bytes shared with another message (see `CloneShared()`) first copies the shared buffers, which can
+     * fail. Nothing is written in that case.
+     *
      * @param[in]  aOffset  Byte offset within the message to begin writing.
      * @param[in]  aBuf     A pointer to a data buffer.
      * @param[in]  aLength  Number of bytes to write.
      *
+     * @retval kErrorNone    Successfully wrote the bytes to the message.
+     * @retval kErrorNoBufs  Insufficient available buffers to copy the shared message buffers.
+     *
      */
-    void WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength);
+    Error WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength);
 
     /**
      * This methods writes an object to the message.
@@ -823,12 +833,15 @@ public:
      * @param[in]  aOffset      Byte offset within the message to begin writing.
      * @param[in]  aObject      A reference to the object to write.
      *
+     * @retval kErrorNone    Successfully wrote the object to the message.
+     * @retval kErrorNoBufs  Insufficient available buffers to copy the message buffers shared with another message.
+     *
      */
-    template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
+    template <typename ObjectType> Error Write(uint16_t aOffset, const ObjectType &aObject)
     {
         static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
 
-        WriteBytes(aOffset, &aObject, sizeof(ObjectType));
+        return WriteBytes(aOffset, &aObject, sizeof(ObjectType));
     }
 
     /**
@@ -843,7 +856,8 @@ public:
      * @param[in] aLength             Number of bytes to copy.
      * @param[in] aMessage            Message to copy to.
      *
-     * @returns The number of bytes copied.
+     * @returns The number of bytes copied. Copying stops early if bytes shared with another message (see
+     *          `CloneShared()`) in @p aMessage cannot be written.
      *
      */
     uint16_t CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const;
@@ -874,6 +888,37 @@ public:
      */
     Message *Clone(void) const { return Clone(GetLength()); }
 
+    /**
+     * This method creates a copy of the message which shares the payload buffers with the original one.
+     *
+     * The copy gets its own first buffer (holding the message metadata) while the remaining buffers are shared with
+     * the original message and reference counted. A shared buffer is copied when either message writes to the bytes
+     * of the buffer which are used by both of them (copy-on-write). The buffers covering the bytes before the message
+     * offset (usually headers updated by the lower layers) are copied right away.
+     *
+     * When the message buffers are not allocated from the OpenThread buffer pool (i.e., allocated from heap or by the
+     * platform), or when @p aLength is larger than the message length, this method behaves as `Clone()`.
+     *
+     * The `Type`, `SubType`, `LinkSecurity`, `Offset`, `InterfaceId`, and `Priority` fields on the cloned message are
+     * also copied from the original one.
+     *
+     * @param[in] aLength  Number of payload bytes to share.
+     *
+     * @returns A pointer to the message or nullptr if insufficient message buffers are available.
+     *
+     */
+    Message *CloneShared(uint16_t aLength) const;
+
+    /**
+     * This method creates a copy of the message which shares the entire payload with the original one.
+     *
+     * @sa CloneShared(uint16_t aLength)
+     *
+     * @returns A pointer to the message or nullptr if insufficient message buffers are available.
+     *
+     */
+    Message *CloneShared(void) const { return CloneShared(GetLength()); }
+
     /**
      * This method returns the datagram tag used for 6LoWPAN fragmentation or the identification used for IPv6
      * fragmentation.
@@ -1356,6 +1401,13 @@ private:
     Error ResizeMessage(uint16_t aLength);
 
 private:
+    static uint16_t CalculateTailBufferCount(uint16_t aLength);
+
+    Buffer *GetBuffer(uint16_t aIndex);
+    void    ClearCachedBuffer(void) { GetMetadata().mCachedBuffer = nullptr; }
+    Error   UnshareBuffer(uint16_t aIndex);
+    Error   PrepareToWrite(uint16_t aOffset, uint16_t aLength);
+
     struct Chunk
     {
         const uint8_t *GetData(void) const { return mData; }
@@ -1640,13 +1692,30 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method returns the number of buffers saved by sharing message buffers between messages.
+     *
+     * This is the number of additional buffers which would be in use if every message sharing a buffer (see
+     * `Message::CloneShared()`) had its own copy of it.
+     *
+     * @returns The number of saved buffers.
+     *
+     */
+    uint16_t GetSavedBufferCount(void) const;
+
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
+    void    FreeBuffers(Buffer *aBuffer, uint16_t aNumBuffers);
     Error   ReclaimBuffers(Message::Priority aPriority);
+    void    ShareBuffer(Buffer &aBuffer, uint16_t aLength);
+    bool    IsBufferShared(const Buffer &aBuffer, uint16_t aOffset) const;
+    bool    IsBufferShared(const Buffer &aBuffer) const;
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     uint16_t                  mNumFreeBuffers;
+    uint16_t                  mNumSavedBuffers;
+    uint16_t                  mBufferRefCounts[kNumBuffers];     // Number of messages using each buffer.
+    uint16_t                  mBufferSharedLengths[kNumBuffers]; // Number of leading bytes read by several messages.
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
 };
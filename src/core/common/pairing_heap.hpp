@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic intrusive pairing heap.
+ */
+
+#ifndef PAIRING_HEAP_HPP_
+#define PAIRING_HEAP_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stddef.h>
+
+namespace ot {
+
+/**
+ * @addtogroup core-pairing-heap
+ *
+ * @brief
+ *   This module includes definitions for OpenThread Pairing Heap.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This template class represents an intrusive pairing heap (a min-heap).
+ *
+ * Adding an entry takes O(1), removing any entry (including the top one) takes O(log n) amortized time.
+ *
+ * The template type `Type` should contain `mHeapChild`, `mHeapNext` and `mHeapPrev` member variables of type `Type *`
+ * which are accessible to `PairingHeap` (e.g., by declaring it as a friend). When an entry is in the heap, `mHeapChild`
+ * is its first child, `mHeapNext` its next sibling, and `mHeapPrev` its previous sibling (or its parent if the entry
+ * is the first child). These members are owned by the heap while the entry is in it.
+ *
+ * The template type `Compare` orders the entries. It should provide the following method which returns TRUE if
+ * `aFirst` is strictly before `aSecond` (i.e., it should be closer to the top of the heap):
+ *
+ *     bool Compare::operator()(const Type &aFirst, const Type &aSecond) const
+ *
+ * A `Compare` object is passed to every method that changes the heap, so that the ordering can depend on a context
+ * (e.g., the current time when comparing wrapping timestamps). The same ordering should be used for all of them.
+ *
+ */
+template <typename Type, typename Compare> class PairingHeap
+{
+public:
+    /**
+     * This constructor initializes the pairing heap as empty.
+     *
+     */
+    PairingHeap(void)
+        : mRoot(nullptr)
+    {
+    }
+
+    /**
+     * This method indicates whether the heap is empty or not.
+     *
+     * @retval TRUE   If the heap is empty.
+     * @retval FALSE  If the heap is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return (mRoot == nullptr); }
+
+    /**
+     * This method returns the entry at the top of the heap (the one ordered before all others).
+     *
+     * @returns A pointer to the top entry, or nullptr if the heap is empty.
+     *
+     */
+    Type *GetTop(void) { return mRoot; }
+
+    /**
+     * This method returns the entry at the top of the heap (the one ordered before all others).
+     *
+     * @returns A pointer to the top entry, or nullptr if the heap is empty.
+     *
+     */
+    const Type *GetTop(void) const { return mRoot; }
+
+    /**
+     * This method indicates whether the heap contains a given entry.
+     *
+     * @param[in] aEntry   A reference to an entry.
+     *
+     * @retval TRUE   The heap contains @p aEntry.
+     * @retval FALSE  The heap does not contain @p aEntry.
+     *
+     */
+    bool Contains(const Type &aEntry) const { return (&aEntry == mRoot) || (aEntry.mHeapPrev != nullptr); }
+
+    /**
+     * This method adds an entry to the heap.
+     *
+     * The entry MUST NOT be already in the heap.
+     *
+     * @param[in] aEntry     A reference to the entry to add.
+     * @param[in] aCompare   The comparator ordering the entries.
+     *
+     */
+    void Add(Type &aEntry, const Compare &aCompare = Compare())
+    {
+        aEntry.mHeapChild = nullptr;
+        aEntry.mHeapNext  = nullptr;
+        aEntry.mHeapPrev  = nullptr;
+
+        mRoot = Meld(mRoot, &aEntry, aCompare);
+    }
+
+    /**
+     * This method removes an entry from the heap.
+     *
+     * The entry MUST be in the heap.
+     *
+     * @param[in] aEntry     A reference to the entry to remove.
+     * @param[in] aCompare   The comparator ordering the entries.
+     *
+     */
+    void Remove(Type &aEntry, const Compare &aCompare = Compare())
+    {
+        Type *subHeap = MergePairs(aEntry.mHeapChild, aCompare);
+
+        if (&aEntry == mRoot)
+        {
+            mRoot = subHeap;
+        }
+        else
+        {
+            // Unlink `aEntry` from its parent (if it is the first child)
+            // or from its previous sibling.
+
+            if (aEntry.mHeapPrev->mHeapChild == &aEntry)
+            {
+                aEntry.mHeapPrev->mHeapChild = aEntry.mHeapNext;
+            }
+            else
+            {
+                aEntry.mHeapPrev->mHeapNext = aEntry.mHeapNext;
+            }
+
+            if (aEntry.mHeapNext != nullptr)
+            {
+                aEntry.mHeapNext->mHeapPrev = aEntry.mHeapPrev;
+            }
+
+            mRoot = Meld(mRoot, subHeap, aCompare);
+        }
+
+        aEntry.mHeapChild = nullptr;
+        aEntry.mHeapNext  = nullptr;
+        aEntry.mHeapPrev  = nullptr;
+    }
+
+private:
+    static Type *Meld(Type *aFirst, Type *aSecond, const Compare &aCompare)
+    {
+        // Melds two heaps (given their roots) and returns the new root.
+        // The root ordered later becomes the first child of the other.
+
+        Type *root  = aFirst;
+        Type *child = aSecond;
+
+        if (aFirst == nullptr)
+        {
+            root = aSecond;
+        }
+        else if (aSecond != nullptr)
+        {
+            if (aCompare(*aSecond, *aFirst))
+            {
+                root  = aSecond;
+                child = aFirst;
+            }
+
+            child->mHeapPrev = root;
+            child->mHeapNext = root->mHeapChild;
+
+            if (root->mHeapChild != nullptr)
+            {
+                root->mHeapChild->mHeapPrev = child;
+            }
+
+            root->mHeapChild = child;
+        }
+
+        return root;
+    }
+
+    static Type *MergePairs(Type *aFirstSibling, const Compare &aCompare)
+    {
+        // Two-pass pairing: siblings are first melded in pairs from left to
+        // right (collecting the results in a reversed list linked through
+        // `mHeapNext`), then the pairs are melded from right to left.
+
+        Type *pairs = nullptr;
+        Type *heap  = nullptr;
+
+        while (aFirstSibling != nullptr)
+        {
+            Type *first  = aFirstSibling;
+            Type *second = first->mHeapNext;
+            Type *pair;
+
+            first->mHeapNext = nullptr;
+            first->mHeapPrev = nullptr;
+
+            if (second != nullptr)
+            {
+                aFirstSibling     = second->mHeapNext;
+                second->mHeapNext = nullptr;
+                second->mHeapPrev = nullptr;
+            }
+            else
+            {
+                aFirstSibling = nullptr;
+            }
+
+            pair            = Meld(first, second, aCompare);
+            pair->mHeapNext = pairs;
+            pairs           = pair;
+        }
+
+        while (pairs != nullptr)
+        {
+            Type *next = pairs->mHeapNext;
+
+            pairs->mHeapNext = nullptr;
+            heap             = Meld(heap, pairs, aCompare);
+            pairs            = next;
+        }
+
+        return heap;
+    }
+
+    Type *mRoot;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // PAIRING_HEAP_HPP_
@@ -100,42 +100,32 @@ void TimerMilli::Stop(void)
 
 void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
-    Timer *prev = nullptr;
-    Time   now(aAlarmApi.AlarmGetNow());
-
     Remove(aTimer, aAlarmApi);
+    Insert(aTimer, Time(aAlarmApi.AlarmGetNow()));
 
-    for (Timer *cur = mTimerList.GetHead(); cur; prev = cur, cur = cur->GetNext())
-    {
-        if (aTimer.DoesFireBefore(*cur, now))
-        {
-            break;
-        }
-    }
-
-    if (prev == nullptr)
+    if (GetEarliest() == &aTimer)
     {
-        mTimerList.Push(aTimer);
         SetAlarm(aAlarmApi);
     }
-    else
-    {
-        mTimerList.PushAfter(aTimer, *prev);
-    }
 }
 
 void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     VerifyOrExit(aTimer.IsRunning());
 
-    if (mTimerList.GetHead() == &aTimer)
-    {
-        mTimerList.Pop();
-        SetAlarm(aAlarmApi);
-    }
-    else
+    // A running timer is either in `mExpiredList` (expired and waiting
+    // to be fired by `ProcessTimers()`) or in the scheduler's list/heap.
+
+    if (mExpiredList.Remove(aTimer) != kErrorNone)
     {
-        IgnoreError(mTimerList.Remove(aTimer));
+        bool isEarliest = (GetEarliest() == &aTimer);
+
+        Extract(aTimer, Time(aAlarmApi.AlarmGetNow()));
+
+        if (isEarliest)
+        {
+            SetAlarm(aAlarmApi);
+        }
     }
 
     aTimer.SetNext(&aTimer);
@@ -146,13 +136,14 @@ exit:
 
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *timer = GetEarliest();
+
+    if (timer == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer *  timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -164,26 +155,110 @@ void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer;
+
+    // All expired timers are first moved to `mExpiredList` and then
+    // fired in order. This ensures that a timer re-started from a timer
+    // handler (e.g., with zero delay) is not fired again in the same
+    // pass, so the number of handlers invoked is bounded.
+
+    MoveExpiredTimers(Time(aAlarmApi.AlarmGetNow()));
+
+    while ((timer = mExpiredList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+        timer->Fired();
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+void TimerScheduler::MoveExpiredTimers(Time aNow)
+{
+    Timer *tail = mExpiredList.GetTail();
+    Timer *timer;
 
-    if (timer)
+    while (((timer = GetEarliest()) != nullptr) && (aNow >= timer->mFireTime))
     {
-        Time now(aAlarmApi.AlarmGetNow());
+        Extract(*timer, aNow);
 
-        if (now >= timer->mFireTime)
+        if (tail == nullptr)
+        {
+            mExpiredList.Push(*timer);
+        }
+        else
         {
-            Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
-            timer->Fired();
-            ExitNow();
+            mExpiredList.PushAfter(*timer, *tail);
         }
+
+        tail = timer;
     }
+}
 
-    SetAlarm(aAlarmApi);
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
 
-exit:
-    return;
+Timer *TimerScheduler::GetEarliest(void)
+{
+    return mTimerHeap.GetTop();
+}
+
+void TimerScheduler::Insert(Timer &aTimer, Time aNow)
+{
+    aTimer.mNext = nullptr;
+    mTimerHeap.Add(aTimer, FireTimeCompare(aNow));
+}
+
+void TimerScheduler::Extract(Timer &aTimer, Time aNow)
+{
+    mTimerHeap.Remove(aTimer, FireTimeCompare(aNow));
+    aTimer.mNext = nullptr;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
+Timer *TimerScheduler::GetEarliest(void)
+{
+    return mTimerList.GetHead();
+}
+
+void TimerScheduler::Insert(Timer &aTimer, Time aNow)
+{
+    Timer *prev = nullptr;
+
+    for (Timer *cur = mTimerList.GetHead(); cur; prev = cur, cur = cur->GetNext())
+    {
+        if (aTimer.DoesFireBefore(*cur, aNow))
+        {
+            break;
+        }
+    }
+
+    if (prev == nullptr)
+    {
+        mTimerList.Push(aTimer);
+    }
+    else
+    {
+        mTimerList.PushAfter(aTimer, *prev);
+    }
+}
+
+void TimerScheduler::Extract(Timer &aTimer, Time aNow)
+{
+    OT_UNUSED_VARIABLE(aNow);
+
+    if (mTimerList.GetHead() == &aTimer)
+    {
+        mTimerList.Pop();
+    }
+    else
+    {
+        IgnoreError(mTimerList.Remove(aTimer));
+    }
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     Instance *instance = static_cast<Instance *>(aInstance);
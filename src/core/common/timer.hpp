@@ -46,6 +46,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/tasklet.hpp"
 #include "common/time.hpp"
 
@@ -71,6 +72,7 @@ class Timer : public InstanceLocator, public LinkedListEntry<Timer>
 {
     friend class TimerScheduler;
     friend class LinkedListEntry<Timer>;
+    template <typename, typename> friend class PairingHeap;
 
 public:
     /**
@@ -99,6 +101,11 @@ public:
         , mHandler(aHandler)
         , mFireTime()
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        , mHeapChild(nullptr)
+        , mHeapNext(nullptr)
+        , mHeapPrev(nullptr)
+#endif
     {
     }
 
@@ -137,6 +144,13 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer * mNext;
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    // Links in the scheduler's `PairingHeap`. While a timer is in the
+    // heap, `mNext` is only used to mark it as running.
+    Timer *mHeapChild;
+    Timer *mHeapNext;
+    Timer *mHeapPrev;
+#endif
 };
 
 /**
@@ -297,20 +311,51 @@ protected:
     /**
      * This method processes the running timers.
      *
+     * All the timers which have expired are fired in a single pass. A timer (re-)started from a timer handler during
+     * the pass is fired on a later pass.
+     *
      * @param[in]  aAlarmApi  A reference to the Alarm APIs.
      *
      */
     void ProcessTimers(const AlarmApi &aAlarmApi);
 
     /**
-     * This method sets the platform alarm based on timer at front of the list.
+     * This method sets the platform alarm based on the earliest running timer.
      *
      * @param[in]  aAlarmApi  A reference to the Alarm APIs.
      *
      */
     void SetAlarm(const AlarmApi &aAlarmApi);
 
+private:
+    Timer *GetEarliest(void);
+    void   Insert(Timer &aTimer, Time aNow);
+    void   Extract(Timer &aTimer, Time aNow);
+    void   MoveExpiredTimers(Time aNow);
+
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    class FireTimeCompare
+    {
+    public:
+        explicit FireTimeCompare(Time aNow)
+            : mNow(aNow)
+        {
+        }
+
+        bool operator()(const Timer &aFirst, const Timer &aSecond) const
+        {
+            return aFirst.DoesFireBefore(aSecond, mNow);
+        }
+
+    private:
+        Time mNow;
+    };
+
+    PairingHeap<Timer, FireTimeCompare> mTimerHeap;
+#else
     LinkedList<Timer> mTimerList;
+#endif
+    LinkedList<Timer> mExpiredList;
 };
 
 /**
@@ -47,6 +47,20 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS
+ *
+ * Number of outstanding CoAP requests (awaiting an acknowledgment or a response) per CoAP agent that are indexed.
+ *
+ * Indexed requests are looked up by Message ID and Token, and their retransmission times are kept in a heap. Requests
+ * beyond this limit are not rejected: they are kept in the pending queue and found by scanning it, until an index
+ * entry is freed. MUST be less than 255.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -150,4 +150,41 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_RECURSION_DESIRED_FLAG 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * When enabled, DNS client keeps received responses (including NXDOMAIN responses) for the lifetime given by their
+ * record TTLs and answers identical queries from the cache. A query identical to one already in flight is also
+ * attached to it instead of being sent again.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_SIZE
+ *
+ * Specifies the maximum number of responses kept in the DNS client cache.
+ *
+ * Each cached response holds a message buffer. When the cache is full, the entry closest to expiry is replaced.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the time (in seconds) a negative response (NXDOMAIN or no answer) is cached when the response does not
+ * include an SOA record to derive it from (RFC 2308).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 30
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
@@ -65,4 +65,17 @@
 #define OPENTHREAD_CONFIG_DNSSD_QUERY_TIMEOUT 6000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE
+ *
+ * Specifies the number of names (or name suffixes) remembered for name compression while building a DNS-SD response.
+ *
+ * Each entry takes 4 bytes and the table is also kept for every query waiting on a query callback (e.g., Discovery
+ * Proxy). Names written after the table is full are still compressed using the remembered ones.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE 16
+#endif
+
 #endif // CONFIG_DNSSD_SERVER_H_
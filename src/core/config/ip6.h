@@ -137,6 +137,29 @@
 #define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MPL_SEED_SET_BUCKETS
+ *
+ * The number of hash buckets (indexed by MPL Seed Id) the MPL Seed Set entries are distributed over.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_BUCKETS
+#define OPENTHREAD_CONFIG_MPL_SEED_SET_BUCKETS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_ENTRIES
+ *
+ * The maximum number of MPL Data Messages buffered for (re)transmission at the same time (FTD only).
+ *
+ * When all entries are in use, a new MPL Data Message evicts the buffered one with the fewest remaining
+ * transmissions (which is forwarded once first if it was not transmitted yet).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_ENTRIES
+#define OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_ENTRIES 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME
  *
@@ -305,6 +305,19 @@
 #define OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to keep the expanded AES key schedules of the MAC keys (previous, current, and next key sequence, and
+ * the current TREL key) so that software frame security does not run the AES key expansion for every frame.
+ *
+ * Each cached key schedule uses `sizeof(mbedtls_aes_context)` bytes of RAM.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_TIMING_ENABLE
  *
@@ -88,6 +88,52 @@
 #define OPENTHREAD_CONFIG_ECDSA_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE
+ *
+ * Define to 1 to use the CPU AES instructions (x86 AES-NI, or the ARMv8 Cryptography Extension when the compiler
+ * targets it) for AES block encryption instead of the mbedTLS software implementation.
+ *
+ * On x86 the availability of AES-NI is checked at run time, falling back to mbedTLS.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE
+#define OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HDLC_FCS_SLICING_ENABLE
+ *
+ * Define to 1 to compute the HDLC FCS eight bytes at a time (slicing-by-8) when encoding or decoding HDLC-lite
+ * frames. This uses 3.5 KB of additional lookup tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HDLC_FCS_SLICING_ENABLE
+#define OPENTHREAD_CONFIG_HDLC_FCS_SLICING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+ *
+ * Define to 1 to keep a lookup table compiled from the Leader Network Data (6LoWPAN contexts, on-mesh prefixes and
+ * the most preferred border routers) so that context, on-mesh and route lookups do not parse the Network Data TLVs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_MAX_PREFIXES
+ *
+ * The maximum number of Prefix TLVs in the Network Data lookup table. Lookups fall back to parsing the Network Data
+ * TLVs when the Network Data contains more Prefix TLVs (or more route entries than twice this number).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_MAX_PREFIXES 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
  *
@@ -128,6 +174,20 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+ *
+ * Define to 1 to use an intrusive pairing heap (instead of a sorted linked list) for the running timers in the timer
+ * schedulers.
+ *
+ * The heap provides O(1) timer start and O(log n) amortized timer stop/fire, which benefits devices with many
+ * running timers (e.g., routers with many children), at the cost of three extra pointers per `Timer` object.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
  *
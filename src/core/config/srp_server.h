@@ -104,4 +104,20 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_MAX_ADDRESSES_NUM 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS
+ *
+ * Specifies the initial number of hash buckets in the SRP server name indexes.
+ *
+ * The SRP server indexes its registered hosts by host name and its services by service name and by service instance
+ * name, so that DNS-SD queries and SRP updates do not need to scan all the hosts and services. Each index starts with
+ * this number of buckets (one pointer each), and all of them are doubled (allocated from the heap) whenever there are
+ * more than two hosts or services per bucket on average, so lookups do not degrade with the number of registrations.
+ * The initial buckets are used again once all the hosts are removed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS 16
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
@@ -44,7 +44,8 @@ namespace Crypto {
 
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
-    mEcb.SetKey(aKey, CHAR_BIT * aKeyLength);
+    mKeyEcb.SetKey(aKey, CHAR_BIT * aKeyLength);
+    mEcb = &mKeyEcb;
 }
 
 void AesCcm::SetKey(const Mac::Key &aMacKey)
@@ -115,7 +116,7 @@ void AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mEcb->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -163,7 +164,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -177,7 +178,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -192,19 +193,54 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    mPlainTextCur += aLength;
+
+    // Process whole blocks while the key stream and the CBC-MAC are both
+    // block aligned. The next key stream block and the CBC-MAC of the
+    // previous block are computed together.
+
+    while ((aLength >= sizeof(mBlock)) && (mCtrLength == sizeof(mCtrPad)) &&
+           ((mBlockLength == 0) || (mBlockLength == sizeof(mBlock))))
     {
-        if (mCtrLength == 16)
+        IncrementCounter();
+
+        if (mBlockLength == sizeof(mBlock))
         {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+            mEcb->EncryptPair(mCtr, mCtrPad, mBlock, mBlock);
+        }
+        else
+        {
+            mEcb->Encrypt(mCtr, mCtrPad);
+        }
+
+        for (uint8_t i = 0; i < sizeof(mBlock); i++)
+        {
+            if (aMode == kEncrypt)
             {
-                if (++mCtr[j])
-                {
-                    break;
-                }
+                byte               = plaintextBytes[i];
+                ciphertextBytes[i] = byte ^ mCtrPad[i];
             }
+            else
+            {
+                byte              = ciphertextBytes[i] ^ mCtrPad[i];
+                plaintextBytes[i] = byte;
+            }
+
+            mBlock[i] ^= byte;
+        }
+
+        plaintextBytes += sizeof(mBlock);
+        ciphertextBytes += sizeof(mBlock);
+        aLength -= sizeof(mBlock);
+        mBlockLength = sizeof(mBlock);
+    }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+    for (unsigned i = 0; i < aLength; i++)
+    {
+        if (mCtrLength == sizeof(mCtrPad))
+        {
+            IncrementCounter();
+            mEcb->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -221,20 +257,18 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
         mBlock[mBlockLength++] ^= byte;
     }
 
-    mPlainTextCur += aLength;
-
     if (mPlainTextCur >= mPlainTextLength)
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mEcb->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -242,13 +276,24 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     }
 }
 
+void AesCcm::IncrementCounter(void)
+{
+    for (int i = sizeof(mCtr) - 1; i > mNonceLength; i--)
+    {
+        if (++mCtr[i])
+        {
+            break;
+        }
+    }
+}
+
 void AesCcm::Finalize(void *aTag)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aTag);
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    mEcb->Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
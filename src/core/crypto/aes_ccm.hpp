@@ -76,6 +76,15 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * This constructor initializes the AES CCM object.
+     *
+     */
+    AesCcm(void)
+        : mEcb(&mKeyEcb)
+    {
+    }
+
     /**
      * This method sets the key.
      *
@@ -93,6 +102,17 @@ public:
      */
     void SetKey(const Mac::Key &aMacKey);
 
+    /**
+     * This method sets the key from an AES ECB object with an already expanded key.
+     *
+     * This avoids the key expansion when the same key is used for many computations. The @p aExpandedKey MUST stay
+     * valid (and unchanged) while it is used by the AES CCM object.
+     *
+     * @param[in]  aExpandedKey   An AES ECB object with the key set.
+     *
+     */
+    void SetKey(AesEcb &aExpandedKey) { mEcb = &aExpandedKey; }
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -160,7 +180,10 @@ public:
                               uint8_t *              aNonce);
 
 private:
-    AesEcb   mEcb;
+    void IncrementCounter(void);
+
+    AesEcb * mEcb;
+    AesEcb   mKeyEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
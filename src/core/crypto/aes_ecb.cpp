@@ -33,9 +33,134 @@
 
 #include "aes_ecb.hpp"
 
+#if OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE && !defined(MBEDTLS_AES_ALT)
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define OT_AES_ECB_AESNI 1
+#define OT_AES_ECB_ACCEL 1
+#include <wmmintrin.h>
+#elif defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN) && \
+    (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define OT_AES_ECB_ARMV8_CE 1
+#define OT_AES_ECB_ACCEL 1
+#include <arm_neon.h>
+#endif
+#endif
+
 namespace ot {
 namespace Crypto {
 
+#if defined(OT_AES_ECB_AESNI)
+
+// The AES-NI and ARMv8 Crypto Extension paths use the round keys expanded by
+// `mbedtls_aes_setkey_enc()`. On a little-endian CPU, mbedTLS stores them as
+// the byte sequence of the FIPS-197 key schedule, which is the layout both
+// instruction sets expect.
+
+__attribute__((target("aes,sse2"))) static void AccelEncrypt(const uint8_t *aRoundKeys,
+                                                              int            aRounds,
+                                                              const uint8_t *aInput,
+                                                              uint8_t *      aOutput)
+{
+    const __m128i *roundKeys = reinterpret_cast<const __m128i *>(aRoundKeys);
+    __m128i        block;
+
+    block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput)), _mm_loadu_si128(&roundKeys[0]));
+
+    for (int round = 1; round < aRounds; round++)
+    {
+        block = _mm_aesenc_si128(block, _mm_loadu_si128(&roundKeys[round]));
+    }
+
+    block = _mm_aesenclast_si128(block, _mm_loadu_si128(&roundKeys[aRounds]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput), block);
+}
+
+__attribute__((target("aes,sse2"))) static void AccelEncryptPair(const uint8_t *aRoundKeys,
+                                                                  int            aRounds,
+                                                                  const uint8_t *aInput1,
+                                                                  uint8_t *      aOutput1,
+                                                                  const uint8_t *aInput2,
+                                                                  uint8_t *      aOutput2)
+{
+    const __m128i *roundKeys = reinterpret_cast<const __m128i *>(aRoundKeys);
+    __m128i        roundKey  = _mm_loadu_si128(&roundKeys[0]);
+    __m128i        block1;
+    __m128i        block2;
+
+    // The rounds of the two blocks are interleaved so that the CPU can
+    // overlap their latencies.
+
+    block1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput1)), roundKey);
+    block2 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput2)), roundKey);
+
+    for (int round = 1; round < aRounds; round++)
+    {
+        roundKey = _mm_loadu_si128(&roundKeys[round]);
+        block1   = _mm_aesenc_si128(block1, roundKey);
+        block2   = _mm_aesenc_si128(block2, roundKey);
+    }
+
+    roundKey = _mm_loadu_si128(&roundKeys[aRounds]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput1), _mm_aesenclast_si128(block1, roundKey));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput2), _mm_aesenclast_si128(block2, roundKey));
+}
+
+static bool IsAccelAvailable(void)
+{
+    return __builtin_cpu_supports("aes");
+}
+
+#elif defined(OT_AES_ECB_ARMV8_CE)
+
+// See the comment on the AES-NI path about the round key layout.
+
+static void AccelEncrypt(const uint8_t *aRoundKeys, int aRounds, const uint8_t *aInput, uint8_t *aOutput)
+{
+    uint8x16_t block = vld1q_u8(aInput);
+
+    for (int round = 0; round < aRounds - 1; round++)
+    {
+        block = vaesmcq_u8(vaeseq_u8(block, vld1q_u8(&aRoundKeys[round * AesEcb::kBlockSize])));
+    }
+
+    block = vaeseq_u8(block, vld1q_u8(&aRoundKeys[(aRounds - 1) * AesEcb::kBlockSize]));
+    vst1q_u8(aOutput, veorq_u8(block, vld1q_u8(&aRoundKeys[aRounds * AesEcb::kBlockSize])));
+}
+
+static void AccelEncryptPair(const uint8_t *aRoundKeys,
+                             int            aRounds,
+                             const uint8_t *aInput1,
+                             uint8_t *      aOutput1,
+                             const uint8_t *aInput2,
+                             uint8_t *      aOutput2)
+{
+    uint8x16_t block1 = vld1q_u8(aInput1);
+    uint8x16_t block2 = vld1q_u8(aInput2);
+    uint8x16_t roundKey;
+
+    for (int round = 0; round < aRounds - 1; round++)
+    {
+        roundKey = vld1q_u8(&aRoundKeys[round * AesEcb::kBlockSize]);
+        block1   = vaesmcq_u8(vaeseq_u8(block1, roundKey));
+        block2   = vaesmcq_u8(vaeseq_u8(block2, roundKey));
+    }
+
+    roundKey = vld1q_u8(&aRoundKeys[(aRounds - 1) * AesEcb::kBlockSize]);
+    block1   = vaeseq_u8(block1, roundKey);
+    block2   = vaeseq_u8(block2, roundKey);
+
+    roundKey = vld1q_u8(&aRoundKeys[aRounds * AesEcb::kBlockSize]);
+    vst1q_u8(aOutput1, veorq_u8(block1, roundKey));
+    vst1q_u8(aOutput2, veorq_u8(block2, roundKey));
+}
+
+static bool IsAccelAvailable(void)
+{
+    return true;
+}
+
+#endif // defined(OT_AES_ECB_AESNI)
+
 AesEcb::AesEcb(void)
 {
     mbedtls_aes_init(&mContext);
@@ -48,7 +173,35 @@ void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 
 void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
 {
-    mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+#ifdef OT_AES_ECB_ACCEL
+    if (IsAccelAvailable())
+    {
+        AccelEncrypt(reinterpret_cast<const uint8_t *>(mContext.rk), mContext.nr, aInput, aOutput);
+    }
+    else
+#endif
+    {
+        mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+    }
+}
+
+void AesEcb::EncryptPair(const uint8_t aInput1[kBlockSize],
+                         uint8_t       aOutput1[kBlockSize],
+                         const uint8_t aInput2[kBlockSize],
+                         uint8_t       aOutput2[kBlockSize])
+{
+#ifdef OT_AES_ECB_ACCEL
+    if (IsAccelAvailable())
+    {
+        AccelEncryptPair(reinterpret_cast<const uint8_t *>(mContext.rk), mContext.nr, aInput1, aOutput1, aInput2,
+                         aOutput2);
+    }
+    else
+#endif
+    {
+        mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput1, aOutput1);
+        mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput2, aOutput2);
+    }
 }
 
 AesEcb::~AesEcb(void)
@@ -90,6 +90,23 @@ public:
      */
     void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
 
+    /**
+     * This method encrypts two independent blocks.
+     *
+     * When `OPENTHREAD_CONFIG_AES_ACCELERATION_ENABLE` is set and the CPU provides AES instructions, the rounds of the
+     * two blocks are interleaved. Otherwise this is equivalent to two `Encrypt()` calls.
+     *
+     * @param[in]   aInput1   A pointer to the first input buffer.
+     * @param[out]  aOutput1  A pointer to the first output buffer.
+     * @param[in]   aInput2   A pointer to the second input buffer.
+     * @param[out]  aOutput2  A pointer to the second output buffer.
+     *
+     */
+    void EncryptPair(const uint8_t aInput1[kBlockSize],
+                     uint8_t       aOutput1[kBlockSize],
+                     const uint8_t aInput2[kBlockSize],
+                     uint8_t       aOutput2[kBlockSize]);
+
 private:
     mbedtls_aes_context mContext;
 };
@@ -1015,7 +1015,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(aFrame.mInfo.mTxInfo.mCslPresent == 0);
 #endif
 
-    aFrame.ProcessTransmitAesCcm(*extAddress);
+    aFrame.ProcessTransmitAesCcm(*extAddress, keyManager.GetMacKeySchedule(aFrame.GetAesKey()));
 
 exit:
     return;
@@ -1603,7 +1603,10 @@ void Mac::HandleTimer(void)
     }
 }
 
-Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor)
+Error Mac::ProcessReceiveSecurity(RxFrame &              aFrame,
+                                  FrameHeaderDescriptor &aHeader,
+                                  const Address &        aSrcAddr,
+                                  Neighbor *             aNeighbor)
 {
     KeyManager &      keyManager = Get<KeyManager>();
     Error             error      = kErrorSecurity;
@@ -1617,13 +1620,13 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
 
     VerifyOrExit(aFrame.GetSecurityEnabled(), error = kErrorNone);
 
-    IgnoreError(aFrame.GetSecurityLevel(securityLevel));
+    IgnoreError(aHeader.GetSecurityLevel(securityLevel));
     VerifyOrExit(securityLevel == Frame::kSecEncMic32);
 
-    IgnoreError(aFrame.GetFrameCounter(frameCounter));
+    IgnoreError(aHeader.GetFrameCounter(frameCounter));
     otLogDebgMac("Rx security - frame counter %u", frameCounter);
 
-    IgnoreError(aFrame.GetKeyIdMode(keyIdMode));
+    IgnoreError(aHeader.GetKeyIdMode(keyIdMode));
 
     switch (keyIdMode)
     {
@@ -1635,7 +1638,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
     case Frame::kKeyIdMode1:
         VerifyOrExit(aNeighbor != nullptr);
 
-        IgnoreError(aFrame.GetKeyId(keyid));
+        IgnoreError(aHeader.GetKeyId(keyid));
         keyid--;
 
         if (keyid == (keyManager.GetCurrentKeySequence() & 0x7f))
@@ -1698,7 +1701,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         OT_UNREACHABLE_CODE(break);
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey, keyManager.GetMacKeySchedule(*macKey)));
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1818,7 +1821,7 @@ Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
-    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey, keyManager.GetMacKeySchedule(*macKey));
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
@@ -1838,11 +1841,12 @@ exit:
 
 void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
 {
-    Address   srcaddr;
-    Address   dstaddr;
-    PanId     panid;
-    Neighbor *neighbor;
-    Error     error = aError;
+    FrameHeaderDescriptor header;
+    Address               srcaddr;
+    Address               dstaddr;
+    PanId                 panid;
+    Neighbor *            neighbor;
+    Error                 error = aError;
 
     mCounters.mRxTotal++;
 
@@ -1852,10 +1856,10 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
 
     // Ensure we have a valid frame before attempting to read any contents of
     // the buffer received from the radio.
-    SuccessOrExit(error = aFrame->ValidatePsdu());
+    SuccessOrExit(error = header.Parse(*aFrame));
 
-    IgnoreError(aFrame->GetSrcAddr(srcaddr));
-    IgnoreError(aFrame->GetDstAddr(dstaddr));
+    IgnoreError(header.GetSrcAddr(srcaddr));
+    IgnoreError(header.GetDstAddr(dstaddr));
     neighbor = Get<NeighborTable>().FindNeighbor(srcaddr);
 
     // Destination Address Filtering
@@ -1884,7 +1888,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     }
 
     // Verify destination PAN ID if present
-    if (kErrorNone == aFrame->GetDstPanId(panid))
+    if (kErrorNone == header.GetDstPanId(panid))
     {
         VerifyOrExit(panid == kShortAddrBroadcast || panid == mPanId, error = kErrorDestinationAddressFiltered);
     }
@@ -1941,7 +1945,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
         mCounters.mRxUnicast++;
     }
 
-    error = ProcessReceiveSecurity(*aFrame, srcaddr, neighbor);
+    error = ProcessReceiveSecurity(*aFrame, header, srcaddr, neighbor);
 
     switch (error)
     {
@@ -1991,7 +1995,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
         {
             uint8_t keyIdMode;
 
-            IgnoreError(aFrame->GetKeyIdMode(keyIdMode));
+            IgnoreError(header.GetKeyIdMode(keyIdMode));
 
             if (keyIdMode == Frame::kKeyIdMode1)
             {
@@ -2098,7 +2102,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     }
 
     otDumpDebgMac("RX", aFrame->GetHeader(), aFrame->GetLength());
-    Get<MeshForwarder>().HandleReceivedFrame(*aFrame);
+    Get<MeshForwarder>().HandleReceivedFrame(*aFrame, header);
 
     UpdateIdleMode();
 
@@ -1126,6 +1126,222 @@ template Error Frame::AppendHeaderIeAt<CslIe>(uint8_t &aIndex);
 template Error Frame::AppendHeaderIeAt<Termination2Ie>(uint8_t &aIndex);
 #endif
 
+FrameHeaderDescriptor::FrameHeaderDescriptor(void)
+    : mFrame(nullptr)
+    , mFcf(0)
+    , mLength(0)
+    , mSecurityControl(0)
+    , mDstPanIdIndex(Frame::kInvalidIndex)
+    , mDstAddrIndex(Frame::kInvalidIndex)
+    , mSrcPanIdIndex(Frame::kInvalidIndex)
+    , mSrcAddrIndex(Frame::kInvalidIndex)
+    , mSecurityIndex(Frame::kInvalidIndex)
+    , mPayloadIndex(Frame::kInvalidIndex)
+    , mFooterLength(0)
+{
+}
+
+Error FrameHeaderDescriptor::Parse(Frame &aFrame)
+{
+    Error error = kErrorNone;
+
+    mFrame           = &aFrame;
+    mFcf             = aFrame.GetFrameControlField();
+    mLength          = aFrame.GetPsduLength();
+    mSecurityControl = 0;
+    mPayloadIndex    = aFrame.FindPayloadIndex();
+
+    VerifyOrExit(mPayloadIndex != Frame::kInvalidIndex, error = kErrorParse);
+
+    mSecurityIndex = aFrame.FindSecurityHeaderIndex();
+
+    if (mSecurityIndex != Frame::kInvalidIndex)
+    {
+        mSecurityControl = aFrame.mPsdu[mSecurityIndex];
+    }
+
+    mFooterLength = aFrame.GetFcsSize() + Frame::CalculateMicSize(mSecurityControl);
+    VerifyOrExit(mPayloadIndex + mFooterLength <= mLength, error = kErrorParse);
+
+    mDstPanIdIndex = aFrame.FindDstPanIdIndex();
+    mDstAddrIndex  = aFrame.FindDstAddrIndex();
+    mSrcPanIdIndex = aFrame.FindSrcPanIdIndex();
+    mSrcAddrIndex  = aFrame.FindSrcAddrIndex();
+
+exit:
+    if (error != kErrorNone)
+    {
+        mPayloadIndex  = Frame::kInvalidIndex;
+        mSecurityIndex = Frame::kInvalidIndex;
+        mFooterLength  = 0;
+    }
+
+    return error;
+}
+
+bool FrameHeaderDescriptor::IsValid(void)
+{
+    // Parse the frame again if its header was changed since it was
+    // last parsed.
+
+    VerifyOrExit(mFrame != nullptr);
+
+    if ((mFrame->GetPsduLength() != mLength) || (mFrame->GetFrameControlField() != mFcf) ||
+        ((mSecurityIndex != Frame::kInvalidIndex) && (mFrame->mPsdu[mSecurityIndex] != mSecurityControl)))
+    {
+        IgnoreError(Parse(*mFrame));
+    }
+
+exit:
+    return (mPayloadIndex != Frame::kInvalidIndex);
+}
+
+Error FrameHeaderDescriptor::GetDstPanId(PanId &aPanId)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid() && (mDstPanIdIndex != Frame::kInvalidIndex), error = kErrorParse);
+    aPanId = ReadUint16(&mFrame->mPsdu[mDstPanIdIndex]);
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetDstAddr(Address &aAddress)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid(), error = kErrorParse);
+
+    switch (mFcf & Frame::kFcfDstAddrMask)
+    {
+    case Frame::kFcfDstAddrShort:
+        aAddress.SetShort(ReadUint16(&mFrame->mPsdu[mDstAddrIndex]));
+        break;
+
+    case Frame::kFcfDstAddrExt:
+        aAddress.SetExtended(&mFrame->mPsdu[mDstAddrIndex], ExtAddress::kReverseByteOrder);
+        break;
+
+    default:
+        aAddress.SetNone();
+        break;
+    }
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetSrcPanId(PanId &aPanId)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid() && (mSrcPanIdIndex != Frame::kInvalidIndex), error = kErrorParse);
+    aPanId = ReadUint16(&mFrame->mPsdu[mSrcPanIdIndex]);
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetSrcAddr(Address &aAddress)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid(), error = kErrorParse);
+
+    switch (mFcf & Frame::kFcfSrcAddrMask)
+    {
+    case Frame::kFcfSrcAddrShort:
+        aAddress.SetShort(ReadUint16(&mFrame->mPsdu[mSrcAddrIndex]));
+        break;
+
+    case Frame::kFcfSrcAddrExt:
+        aAddress.SetExtended(&mFrame->mPsdu[mSrcAddrIndex], ExtAddress::kReverseByteOrder);
+        break;
+
+    default:
+        aAddress.SetNone();
+        break;
+    }
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetSecurityLevel(uint8_t &aSecurityLevel)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid() && (mSecurityIndex != Frame::kInvalidIndex), error = kErrorParse);
+    aSecurityLevel = mSecurityControl & Frame::kSecLevelMask;
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetKeyIdMode(uint8_t &aKeyIdMode)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid() && (mSecurityIndex != Frame::kInvalidIndex), error = kErrorParse);
+    aKeyIdMode = mSecurityControl & Frame::kKeyIdModeMask;
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetFrameCounter(uint32_t &aFrameCounter)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsValid() && (mSecurityIndex != Frame::kInvalidIndex), error = kErrorParse);
+    aFrameCounter = ReadUint32(&mFrame->mPsdu[mSecurityIndex + Frame::kSecurityControlSize]);
+
+exit:
+    return error;
+}
+
+Error FrameHeaderDescriptor::GetKeyId(uint8_t &aKeyId)
+{
+    Error   error = kErrorNone;
+    uint8_t keySourceLength;
+
+    VerifyOrExit(IsValid() && (mSecurityIndex != Frame::kInvalidIndex), error = kErrorParse);
+
+    keySourceLength = Frame::GetKeySourceLength(mSecurityControl & Frame::kKeyIdModeMask);
+
+    aKeyId =
+        mFrame->mPsdu[mSecurityIndex + Frame::kSecurityControlSize + Frame::kFrameCounterSize + keySourceLength];
+
+exit:
+    return error;
+}
+
+uint8_t FrameHeaderDescriptor::GetHeaderLength(void)
+{
+    return IsValid() ? mPayloadIndex : 0;
+}
+
+uint8_t FrameHeaderDescriptor::GetFooterLength(void)
+{
+    return IsValid() ? mFooterLength : 0;
+}
+
+uint8_t *FrameHeaderDescriptor::GetPayload(void)
+{
+    return IsValid() ? &mFrame->mPsdu[mPayloadIndex] : nullptr;
+}
+
+uint16_t FrameHeaderDescriptor::GetPayloadLength(void)
+{
+    return IsValid() ? (mLength - mPayloadIndex - mFooterLength) : 0;
+}
+
+uint8_t *FrameHeaderDescriptor::GetFooter(void)
+{
+    return IsValid() ? &mFrame->mPsdu[mLength - mFooterLength] : nullptr;
+}
+
 void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 {
     uint8_t *      psduBuffer   = mPsdu;
@@ -1165,31 +1381,42 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 #endif
 }
 
-void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb *aExpandedKey)
 {
 #if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
     OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aExpandedKey);
 #else
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tagLength;
-    Crypto::AesCcm aesCcm;
+    uint32_t              frameCounter = 0;
+    uint8_t               securityLevel;
+    uint8_t               nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t               tagLength;
+    FrameHeaderDescriptor header;
+    Crypto::AesCcm        aesCcm;
 
     VerifyOrExit(GetSecurityEnabled());
 
-    SuccessOrExit(GetSecurityLevel(securityLevel));
-    SuccessOrExit(GetFrameCounter(frameCounter));
+    SuccessOrExit(header.Parse(*this));
+    SuccessOrExit(header.GetSecurityLevel(securityLevel));
+    SuccessOrExit(header.GetFrameCounter(frameCounter));
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
-    tagLength = GetFooterLength() - GetFcsSize();
+    if (aExpandedKey != nullptr)
+    {
+        aesCcm.SetKey(*aExpandedKey);
+    }
+    else
+    {
+        aesCcm.SetKey(GetAesKey());
+    }
+
+    tagLength = header.GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kEncrypt);
-    aesCcm.Finalize(GetFooter());
+    aesCcm.Init(header.GetHeaderLength(), header.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aesCcm.Header(GetHeader(), header.GetHeaderLength());
+    aesCcm.Payload(header.GetPayload(), header.GetPayload(), header.GetPayloadLength(), Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(header.GetFooter());
 
     SetIsSecurityProcessed(true);
 
@@ -1327,45 +1554,56 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
-Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey)
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey, Crypto::AesEcb *aExpandedKey)
 {
 #if OPENTHREAD_RADIO
     OT_UNUSED_VARIABLE(aExtAddress);
     OT_UNUSED_VARIABLE(aMacKey);
+    OT_UNUSED_VARIABLE(aExpandedKey);
 
     return kErrorNone;
 #else
-    Error          error        = kErrorSecurity;
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tag[kMaxMicSize];
-    uint8_t        tagLength;
-    Crypto::AesCcm aesCcm;
+    Error                 error        = kErrorSecurity;
+    uint32_t              frameCounter = 0;
+    uint8_t               securityLevel;
+    uint8_t               nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t               tag[kMaxMicSize];
+    uint8_t               tagLength;
+    FrameHeaderDescriptor header;
+    Crypto::AesCcm        aesCcm;
 
     VerifyOrExit(GetSecurityEnabled(), error = kErrorNone);
 
-    SuccessOrExit(GetSecurityLevel(securityLevel));
-    SuccessOrExit(GetFrameCounter(frameCounter));
+    SuccessOrExit(header.Parse(*this));
+    SuccessOrExit(header.GetSecurityLevel(securityLevel));
+    SuccessOrExit(header.GetFrameCounter(frameCounter));
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
-    tagLength = GetFooterLength() - GetFcsSize();
+    if (aExpandedKey != nullptr)
+    {
+        aesCcm.SetKey(*aExpandedKey);
+    }
+    else
+    {
+        aesCcm.SetKey(aMacKey);
+    }
+
+    tagLength = header.GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
+    aesCcm.Init(header.GetHeaderLength(), header.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aesCcm.Header(GetHeader(), header.GetHeaderLength());
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aesCcm.Payload(header.GetPayload(), header.GetPayload(), header.GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #else
     // For fuzz tests, execute AES but do not alter the payload
     uint8_t fuzz[OT_RADIO_FRAME_MAX_SIZE];
-    aesCcm.Payload(fuzz, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aesCcm.Payload(fuzz, header.GetPayload(), header.GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #endif
     aesCcm.Finalize(tag);
 
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    VerifyOrExit(memcmp(tag, GetFooter(), tagLength) == 0);
+    VerifyOrExit(memcmp(tag, header.GetFooter(), tagLength) == 0);
 #endif
 
     error = kErrorNone;
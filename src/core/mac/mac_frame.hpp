@@ -43,6 +43,13 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+namespace Crypto {
+
+class AesEcb;
+
+} // namespace Crypto
+
 namespace Mac {
 
 using ot::Encoding::LittleEndian::HostSwap16;
@@ -306,6 +313,8 @@ public:
  */
 class Frame : public otRadioFrame
 {
+    friend class FrameHeaderDescriptor;
+
 public:
     enum
     {
@@ -1140,6 +1149,182 @@ protected:
     static uint8_t CalculateMicSize(uint8_t aSecurityControl);
 };
 
+/**
+ * This class represents the parsed MAC header of a frame.
+ *
+ * `Parse()` walks the MAC header of a frame once and records the offsets of its fields, so that the accessors read
+ * the fields directly instead of re-deriving their offsets from the Frame Control field on every call.
+ *
+ * The offsets remain tied to the frame content at the time of parsing. If the Frame Control field, the Security
+ * Control field or the length of the frame is changed afterwards, the frame is parsed again on the next access.
+ *
+ */
+class FrameHeaderDescriptor
+{
+public:
+    /**
+     * This constructor initializes the `FrameHeaderDescriptor` with no frame.
+     *
+     */
+    FrameHeaderDescriptor(void);
+
+    /**
+     * This method parses the MAC header of a frame.
+     *
+     * The frame MUST outlive its use through this `FrameHeaderDescriptor`.
+     *
+     * @param[in]  aFrame  The frame to parse.
+     *
+     * @retval kErrorNone   Successfully parsed the frame (the PSDU is valid, see `Frame::ValidatePsdu()`).
+     * @retval kErrorParse  The frame is not a valid MAC frame.
+     *
+     */
+    Error Parse(Frame &aFrame);
+
+    /**
+     * This method gets the Destination PAN Identifier.
+     *
+     * @param[out]  aPanId  The Destination PAN Identifier.
+     *
+     * @retval kErrorNone   Successfully retrieved the Destination PAN Identifier.
+     * @retval kErrorParse  The frame is not valid or has no Destination PAN Identifier.
+     *
+     */
+    Error GetDstPanId(PanId &aPanId);
+
+    /**
+     * This method gets the Destination Address.
+     *
+     * @param[out]  aAddress  The Destination Address.
+     *
+     * @retval kErrorNone   Successfully retrieved the Destination Address.
+     * @retval kErrorParse  The frame is not valid.
+     *
+     */
+    Error GetDstAddr(Address &aAddress);
+
+    /**
+     * This method gets the Source PAN Identifier.
+     *
+     * @param[out]  aPanId  The Source PAN Identifier.
+     *
+     * @retval kErrorNone   Successfully retrieved the Source PAN Identifier.
+     * @retval kErrorParse  The frame is not valid or has no Source PAN Identifier.
+     *
+     */
+    Error GetSrcPanId(PanId &aPanId);
+
+    /**
+     * This method gets the Source Address.
+     *
+     * @param[out]  aAddress  The Source Address.
+     *
+     * @retval kErrorNone   Successfully retrieved the Source Address.
+     * @retval kErrorParse  The frame is not valid.
+     *
+     */
+    Error GetSrcAddr(Address &aAddress);
+
+    /**
+     * This method gets the Security Level Identifier.
+     *
+     * @param[out]  aSecurityLevel  The Security Level Identifier.
+     *
+     * @retval kErrorNone   Successfully retrieved the Security Level Identifier.
+     * @retval kErrorParse  The frame is not valid or has no security header.
+     *
+     */
+    Error GetSecurityLevel(uint8_t &aSecurityLevel);
+
+    /**
+     * This method gets the Key Identifier Mode.
+     *
+     * @param[out]  aKeyIdMode  The Key Identifier Mode.
+     *
+     * @retval kErrorNone   Successfully retrieved the Key Identifier Mode.
+     * @retval kErrorParse  The frame is not valid or has no security header.
+     *
+     */
+    Error GetKeyIdMode(uint8_t &aKeyIdMode);
+
+    /**
+     * This method gets the Frame Counter.
+     *
+     * @param[out]  aFrameCounter  The Frame Counter.
+     *
+     * @retval kErrorNone   Successfully retrieved the Frame Counter.
+     * @retval kErrorParse  The frame is not valid or has no security header.
+     *
+     */
+    Error GetFrameCounter(uint32_t &aFrameCounter);
+
+    /**
+     * This method gets the Key Identifier.
+     *
+     * @param[out]  aKeyId  The Key Identifier.
+     *
+     * @retval kErrorNone   Successfully retrieved the Key Identifier.
+     * @retval kErrorParse  The frame is not valid or has no security header.
+     *
+     */
+    Error GetKeyId(uint8_t &aKeyId);
+
+    /**
+     * This method returns the MAC header length.
+     *
+     * @returns The MAC header length, or zero if the frame is not valid.
+     *
+     */
+    uint8_t GetHeaderLength(void);
+
+    /**
+     * This method returns the MAC footer length (MIC and FCS).
+     *
+     * @returns The MAC footer length, or zero if the frame is not valid.
+     *
+     */
+    uint8_t GetFooterLength(void);
+
+    /**
+     * This method returns a pointer to the MAC payload.
+     *
+     * @returns A pointer to the MAC payload, or nullptr if the frame is not valid.
+     *
+     */
+    uint8_t *GetPayload(void);
+
+    /**
+     * This method returns the MAC payload length.
+     *
+     * @returns The MAC payload length, or zero if the frame is not valid.
+     *
+     */
+    uint16_t GetPayloadLength(void);
+
+    /**
+     * This method returns a pointer to the MAC footer.
+     *
+     * @returns A pointer to the MAC footer, or nullptr if the frame is not valid.
+     *
+     */
+    uint8_t *GetFooter(void);
+
+private:
+    bool IsValid(void);
+
+    Frame *  mFrame;
+    uint16_t mFcf;
+    uint16_t mLength;
+    uint8_t  mSecurityControl;
+    uint8_t  mDstPanIdIndex;
+    uint8_t  mDstAddrIndex;
+    uint8_t  mSrcPanIdIndex;
+    uint8_t  mSrcAddrIndex;
+    uint8_t  mSecurityIndex;
+    uint8_t  mPayloadIndex;
+    uint8_t  mFooterLength;
+};
+
 /**
  * This class supports received IEEE 802.15.4 MAC frame processing.
  *
@@ -1204,12 +1389,16 @@ public:
      * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
      * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aExpandedKey A pointer to an AES ECB object with @p aMacKey already set, or nullptr to expand
+     *                          @p aMacKey for this frame.
      *
      * @retval kErrorNone      Process of received frame AES CCM succeeded.
      * @retval kErrorSecurity  Received frame MIC check failed.
      *
      */
-    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey);
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress,
+                               const Key &       aMacKey,
+                               Crypto::AesEcb *  aExpandedKey = nullptr);
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
@@ -1350,9 +1539,11 @@ public:
      *
      * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
+     * @param[in]  aExpandedKey A pointer to an AES ECB object with the frame AES key (`GetAesKey()`) already set, or
+     *                          nullptr to expand the key for this frame.
      *
      */
-    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb *aExpandedKey = nullptr);
 
     /**
      * This method indicates whether or not the frame has security processed.
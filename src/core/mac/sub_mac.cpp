@@ -358,7 +358,11 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
+#if OPENTHREAD_RADIO
     mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+#else
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, Get<KeyManager>().GetMacKeySchedule(GetCurrentMacKey()));
+#endif
 
 exit:
     return;
@@ -33,7 +33,10 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
 #include "net/tcp6.hpp"
@@ -69,13 +72,86 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The one's complement sum is independent of byte order (RFC-1071),
+    // so the data is summed as host-order 32-bit words into a 64-bit
+    // accumulator and the folded result is converted to network order
+    // at the end. If the data starts at an odd index in the overall
+    // checksummed stream (e.g., odd length of a previous chunk), the
+    // sum is byte-swapped before being added to `mValue`.
+
+    uint64_t sum = 0;
+    uint16_t value;
+    uint32_t word;
+
+    VerifyOrExit(aLength > 0);
+
+    while (aLength >= sizeof(uint32_t))
+    {
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        aBuffer += sizeof(uint32_t);
+        aLength -= sizeof(uint32_t);
+    }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        uint16_t halfWord;
+
+        memcpy(&halfWord, aBuffer, sizeof(halfWord));
+        sum += halfWord;
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    if (aLength > 0)
+    {
+        // Trailing byte is the MSB of a (zero-padded) 16-bit word.
+
+        uint8_t  bytes[sizeof(uint16_t)] = {aBuffer[0], 0};
+        uint16_t halfWord;
+
+        memcpy(&halfWord, bytes, sizeof(halfWord));
+        sum += halfWord;
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    value = Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum));
+
+    if (mAtOddIndex)
+    {
+        value = Encoding::Swap16(value);
+    }
+
+    AddSum(value);
+
+    if (aLength > 0)
+    {
+        mAtOddIndex = !mAtOddIndex;
+    }
+
+exit:
+    return;
+}
+
+void Checksum::AddSum(uint16_t aSum)
+{
+    uint16_t newValue = mValue + aSum;
+
+    // Calculate one's complement sum (end-around carry).
+
+    if (newValue < mValue)
     {
-        AddUint8(aBuffer[i]);
+        newValue++;
     }
+
+    mValue = newValue;
 }
 
-void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+Error Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 {
     uint16_t checksum = GetValue();
 
@@ -86,7 +162,7 @@ void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 
     checksum = Encoding::BigEndian::HostSwap16(checksum);
 
-    aMessage.Write(aOffset, checksum);
+    return aMessage.Write(aOffset, checksum);
 }
 
 void Checksum::Calculate(const Ip6::Address &aSource,
@@ -124,11 +200,12 @@ Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::Messag
     return (checksum.GetValue() == kValidRxChecksum) ? kErrorNone : kErrorDrop;
 }
 
-void Checksum::UpdateMessageChecksum(Message &           aMessage,
-                                     const Ip6::Address &aSource,
-                                     const Ip6::Address &aDestination,
-                                     uint8_t             aIpProto)
+Error Checksum::UpdateMessageChecksum(Message &           aMessage,
+                                      const Ip6::Address &aSource,
+                                      const Ip6::Address &aDestination,
+                                      uint8_t             aIpProto)
 {
+    Error    error = kErrorNone;
     uint16_t headerOffset;
     Checksum checksum;
 
@@ -151,10 +228,10 @@ void Checksum::UpdateMessageChecksum(Message &           aMessage,
     }
 
     checksum.Calculate(aSource, aDestination, aIpProto, aMessage);
-    checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
+    error = checksum.WriteToMessage(aMessage.GetOffset() + headerOffset, aMessage);
 
 exit:
-    return;
+    return error;
 }
 
 } // namespace ot
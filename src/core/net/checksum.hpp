@@ -78,11 +78,14 @@ public:
      * @param[in] aDestination  The destination address.
      * @param[in] aIpProto      The Internet Protocol value.
      *
+     * @retval kErrorNone    Successfully updated the checksum (or @p aIpProto has no checksum).
+     * @retval kErrorNoBufs  Insufficient available buffers to write the checksum to @p aMessage.
+     *
      */
-    static void UpdateMessageChecksum(Message &           aMessage,
-                                      const Ip6::Address &aSource,
-                                      const Ip6::Address &aDestination,
-                                      uint8_t             aIpProto);
+    static Error UpdateMessageChecksum(Message &           aMessage,
+                                       const Ip6::Address &aSource,
+                                       const Ip6::Address &aDestination,
+                                       uint8_t             aIpProto);
 
 private:
     Checksum(void)
@@ -95,7 +98,8 @@ private:
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
-    void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
+    void     AddSum(uint16_t aSum);
+    Error    WriteToMessage(uint16_t aOffset, Message &aMessage) const;
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
                        uint8_t             aIpProto,
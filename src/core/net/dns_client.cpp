@@ -560,6 +560,9 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     , mUserDidSetDefaultAddress(false)
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mCacheTasklet(aInstance, Client::HandleCacheTasklet)
+#endif
 {
     static_assert(kIp6AddressQuery == 0, "kIp6AddressQuery value is not correct");
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
@@ -572,6 +575,15 @@ Client::Client(Instance &aInstance)
     static_assert(kBrowseQuery == 1, "kBrowseQuery value is not correct");
     static_assert(kServiceQuery == 2, "kServiceQuery value is not correct");
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    for (CacheEntry &entry : mCache)
+    {
+        entry.Clear();
+    }
+
+    memset(&mCacheCounters, 0, sizeof(mCacheCounters));
+#endif
 }
 
 Error Client::Start(void)
@@ -594,6 +606,10 @@ void Client::Stop(void)
         FinalizeQuery(*query, kErrorAbort);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    FlushCache();
+#endif
+
     IgnoreError(mSocket.Close());
 }
 
@@ -716,6 +732,32 @@ Error Client::StartQuery(QueryInfo &        aInfo,
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
     mQueries.Enqueue(*query);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // A cached response is delivered from `mCacheTasklet` so that
+    // the callback is never invoked from within this method. If an
+    // identical query is already in flight, the new query is
+    // attached to it and finalized along with it.
+
+    if (FindCacheEntry(*query, aInfo.mQueryType, aInfo.mConfig) != nullptr)
+    {
+        aInfo.mAnswerFromCache = true;
+        UpdateQuery(*query, aInfo);
+        mCacheTasklet.Post();
+        ExitNow();
+    }
+
+    aInfo.mMainQuery = FindInFlightQuery(*query, aInfo);
+
+    if (aInfo.mMainQuery != nullptr)
+    {
+        UpdateQuery(*query, aInfo);
+        mCacheCounters.mCoalesced++;
+        ExitNow();
+    }
+
+    mCacheCounters.mMisses++;
+#endif
+
     SendQuery(*query, aInfo, /* aUpdateTimer */ true);
 
 exit:
@@ -743,12 +785,6 @@ exit:
     return error;
 }
 
-void Client::FreeQuery(Query &aQuery)
-{
-    mQueries.Dequeue(aQuery);
-    aQuery.Free();
-}
-
 void Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
 {
     // This method prepares and sends a query message represented by
@@ -854,6 +890,31 @@ void Client::FinalizeQuery(Query &aQuery, Error aError)
 }
 
 void Client::FinalizeQuery(Response &aResponse, QueryType aType, Error aError)
+{
+    Query &query = *aResponse.mQuery;
+
+    // The query is removed from `mQueries` before invoking the
+    // callback, so a query started from the callback is never
+    // attached to it.
+
+    mQueries.Dequeue(query);
+    InvokeCallback(aResponse, aType, aError);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    while ((aResponse.mQuery = FindAttachedQuery(query)) != nullptr)
+    {
+        mQueries.Dequeue(*aResponse.mQuery);
+        InvokeCallback(aResponse, aType, aError);
+        aResponse.mQuery->Free();
+    }
+
+    aResponse.mQuery = &query;
+#endif
+
+    query.Free();
+}
+
+void Client::InvokeCallback(Response &aResponse, QueryType aType, Error aError)
 {
     Callback callback;
     void *   context;
@@ -888,8 +949,6 @@ void Client::FinalizeQuery(Response &aResponse, QueryType aType, Error aError)
         break;
 #endif
     }
-
-    FreeQuery(*aResponse.mQuery);
 }
 
 void Client::GetCallback(const Query &aQuery, Callback &aCallback, void *&aContext)
@@ -942,6 +1001,9 @@ void Client::ProcessResponse(const Message &aMessage)
     // finalizing the query and invoking the user's callback.
 
     SuccessOrExit(ParseResponse(response, type, responseError));
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    AddToCache(response, type, responseError);
+#endif
     FinalizeQuery(response, type, responseError);
 
 exit:
@@ -1072,11 +1134,25 @@ void Client::HandleTimer(void)
 
         info.ReadFrom(*query);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        if ((info.mMainQuery != nullptr) || info.mAnswerFromCache)
+        {
+            continue;
+        }
+#endif
+
         if (now >= info.mRetransmissionTime)
         {
             if (info.mTransmissionCount >= info.mConfig.GetMaxTxAttempts())
             {
                 FinalizeQuery(*query, kErrorResponseTimeout);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+                // Finalizing also frees the queries attached to this
+                // one (`nextQuery` may be among them), so we restart
+                // from the head of the list.
+                nextQuery = mQueries.GetHead();
+                nextTime  = now.GetDistantFuture();
+#endif
                 continue;
             }
 
@@ -1095,6 +1171,369 @@ void Client::HandleTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void Client::FlushCache(void)
+{
+    for (CacheEntry &entry : mCache)
+    {
+        FreeCacheEntry(entry);
+    }
+}
+
+bool Client::IsSameQueryConfig(const QueryConfig &aFirst, const QueryConfig &aSecond)
+{
+    // Only the config fields which can change the response content
+    // are compared (e.g., response timeout is ignored).
+
+    return (aFirst.GetServerSockAddr() == aSecond.GetServerSockAddr()) &&
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+           (aFirst.GetNat64Mode() == aSecond.GetNat64Mode()) &&
+#endif
+           (aFirst.GetRecursionFlag() == aSecond.GetRecursionFlag());
+}
+
+Client::Query *Client::FindInFlightQuery(const Query &aQuery, const QueryInfo &aInfo)
+{
+    Query *   query;
+    QueryInfo info;
+
+    for (query = mQueries.GetHead(); query != nullptr; query = query->GetNext())
+    {
+        uint16_t offset = kNameOffsetInQuery;
+
+        if (query == &aQuery)
+        {
+            continue;
+        }
+
+        info.ReadFrom(*query);
+
+        if ((info.mMainQuery == nullptr) && !info.mAnswerFromCache && (info.mQueryType == aInfo.mQueryType) &&
+            IsSameQueryConfig(info.mConfig, aInfo.mConfig) &&
+            (Name::CompareName(*query, offset, aQuery, kNameOffsetInQuery) == kErrorNone))
+        {
+            break;
+        }
+    }
+
+    return query;
+}
+
+Client::Query *Client::FindAttachedQuery(const Query &aMainQuery)
+{
+    Query *   query;
+    QueryInfo info;
+
+    for (query = mQueries.GetHead(); query != nullptr; query = query->GetNext())
+    {
+        info.ReadFrom(*query);
+
+        if (info.mMainQuery == &aMainQuery)
+        {
+            break;
+        }
+    }
+
+    return query;
+}
+
+Client::Query *Client::FindQueryToAnswerFromCache(void)
+{
+    Query *   query;
+    QueryInfo info;
+
+    for (query = mQueries.GetHead(); query != nullptr; query = query->GetNext())
+    {
+        info.ReadFrom(*query);
+
+        if (info.mAnswerFromCache)
+        {
+            break;
+        }
+    }
+
+    return query;
+}
+
+Client::CacheEntry *Client::FindCacheEntry(const Query &aQuery, QueryType aType, const QueryConfig &aConfig)
+{
+    TimeMilli   now = TimerMilli::GetNow();
+    Name        queryName(aQuery, kNameOffsetInQuery);
+    CacheEntry *matchedEntry = nullptr;
+
+    for (CacheEntry &entry : mCache)
+    {
+        uint16_t offset = sizeof(Header);
+
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        if (now >= entry.mExpireTime)
+        {
+            FreeCacheEntry(entry);
+            continue;
+        }
+
+        if ((entry.mQueryType == aType) && IsSameQueryConfig(entry.mConfig, aConfig) &&
+            (Name::CompareName(*entry.mMessage, offset, queryName) == kErrorNone))
+        {
+            matchedEntry = &entry;
+            break;
+        }
+    }
+
+    return matchedEntry;
+}
+
+void Client::AddToCache(const Response &aResponse, QueryType aType, Error aResponseError)
+{
+    // The response is cached for the smallest TTL among its records.
+    // A negative response (NXDOMAIN or no answer) is cached for the
+    // TTL of the SOA record capped by its MINIMUM field (RFC 2308),
+    // or `kCacheNegativeTtl` if there is no SOA record.
+
+    const Message &message = *aResponse.mMessage;
+    uint16_t       offset  = message.GetOffset();
+    CacheEntry     newEntry;
+    CacheEntry *   entry;
+    QueryInfo      info;
+    uint32_t       minTtl;
+    uint32_t       soaTtl;
+    uint32_t       lifetime;
+    bool           isNegative;
+
+    VerifyOrExit((aResponseError == kErrorNone) || (aResponseError == kErrorNotFound));
+
+    info.ReadFrom(*aResponse.mQuery);
+
+    newEntry.Clear();
+    newEntry.mConfig        = info.mConfig;
+    newEntry.mQueryType     = aType;
+    newEntry.mResponseType  = aType;
+    newEntry.mResponseError = aResponseError;
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    // An IPv4 address query is only sent as a NAT64 fallback of an
+    // IPv6 address query, so the entry answers the latter.
+
+    if (aType == kIp4AddressQuery)
+    {
+        newEntry.mQueryType = kIp6AddressQuery;
+    }
+
+    newEntry.mIp6QueryResponseRequiresNat64 = aResponse.mIp6QueryResponseRequiresNat64;
+#endif
+
+    // The offsets are rebased so that the DNS header starts at offset
+    // zero of the cached message (name compression pointers are
+    // relative to the DNS header).
+
+    newEntry.mAnswerOffset          = aResponse.mAnswerOffset - offset;
+    newEntry.mAnswerRecordCount     = aResponse.mAnswerRecordCount;
+    newEntry.mAdditionalOffset      = aResponse.mAdditionalOffset - offset;
+    newEntry.mAdditionalRecordCount = aResponse.mAdditionalRecordCount;
+
+    newEntry.mMessage = Get<MessagePool>().New(Message::kTypeOther, /* aReserveHeader */ 0);
+    VerifyOrExit(newEntry.mMessage != nullptr);
+
+    SuccessOrExit(newEntry.mMessage->SetLength(message.GetLength() - offset));
+    message.CopyTo(offset, 0, message.GetLength() - offset, *newEntry.mMessage);
+
+    SuccessOrExit(ReduceCachedTtls(newEntry, /* aElapsed */ 0, minTtl, soaTtl));
+
+    isNegative = (aResponseError == kErrorNotFound) || (aResponse.mAnswerRecordCount == 0);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    if (aResponse.mIp6QueryResponseRequiresNat64)
+    {
+        isNegative = false;
+    }
+#endif
+
+    lifetime = OT_MIN(isNegative ? soaTtl : minTtl, static_cast<uint32_t>(kCacheMaxTtl));
+    VerifyOrExit(lifetime > 0);
+
+    newEntry.mAgeTime    = TimerMilli::GetNow();
+    newEntry.mExpireTime = newEntry.mAgeTime + Time::SecToMsec(lifetime);
+
+    // Replace an existing entry for the same query, or use an unused
+    // entry, or evict the entry closest to expiry.
+
+    entry = FindCacheEntry(*aResponse.mQuery, newEntry.mQueryType, newEntry.mConfig);
+
+    if (entry == nullptr)
+    {
+        entry = &mCache[0];
+
+        for (CacheEntry &cacheEntry : mCache)
+        {
+            if (!cacheEntry.IsInUse())
+            {
+                entry = &cacheEntry;
+                break;
+            }
+
+            if (cacheEntry.mExpireTime < entry->mExpireTime)
+            {
+                entry = &cacheEntry;
+            }
+        }
+    }
+
+    FreeCacheEntry(*entry);
+    *entry            = newEntry;
+    newEntry.mMessage = nullptr;
+
+    otLogInfoDns("Cached response for %u sec", lifetime);
+
+exit:
+    FreeCacheEntry(newEntry);
+}
+
+void Client::FreeCacheEntry(CacheEntry &aEntry)
+{
+    if (aEntry.mMessage != nullptr)
+    {
+        aEntry.mMessage->Free();
+        aEntry.mMessage = nullptr;
+    }
+}
+
+Error Client::ReduceCachedTtls(CacheEntry &aEntry, uint32_t aElapsed, uint32_t &aMinTtl, uint32_t &aSoaTtl)
+{
+    // This method reduces the TTL of all records (in answer, authority
+    // and additional data sections) in the cached response by
+    // `aElapsed` seconds. It also outputs the smallest (reduced) TTL
+    // and the negative caching TTL derived from an SOA record.
+
+    Error          error   = kErrorNone;
+    Message &      message = *aEntry.mMessage;
+    uint16_t       offset  = aEntry.mAnswerOffset;
+    Header         header;
+    uint32_t       numRecords;
+    ResourceRecord record;
+
+    aMinTtl = kCacheMaxTtl;
+    aSoaTtl = kCacheNegativeTtl;
+
+    SuccessOrExit(error = message.Read(0, header));
+
+    numRecords = static_cast<uint32_t>(header.GetAnswerCount()) + header.GetAuthorityRecordCount() +
+                 header.GetAdditionalRecordCount();
+
+    for (; numRecords > 0; numRecords--)
+    {
+        uint32_t ttl;
+
+        SuccessOrExit(error = Name::ParseName(message, offset));
+        SuccessOrExit(error = message.Read(offset, record));
+
+        if (record.GetType() != ResourceRecord::kTypeOpt)
+        {
+            ttl = (record.GetTtl() > aElapsed) ? (record.GetTtl() - aElapsed) : 0;
+
+            if (aElapsed != 0)
+            {
+                record.SetTtl(ttl);
+                SuccessOrExit(error = message.Write(offset, record));
+            }
+
+            aMinTtl = OT_MIN(aMinTtl, ttl);
+
+            if ((record.GetType() == ResourceRecord::kTypeSoa) && (record.GetLength() >= sizeof(uint32_t)))
+            {
+                uint32_t minimum;
+
+                // MINIMUM is the last field in SOA record data.
+                SuccessOrExit(error = message.Read(offset + record.GetSize() - sizeof(uint32_t), minimum));
+                aSoaTtl = OT_MIN(ttl, HostSwap32(minimum));
+            }
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return error;
+}
+
+void Client::AnswerFromCache(Query &aQuery, CacheEntry &aEntry)
+{
+    Response  response;
+    TimeMilli now     = TimerMilli::GetNow();
+    uint32_t  elapsed = Time::MsecToSec(now - aEntry.mAgeTime);
+    uint32_t  minTtl;
+    uint32_t  soaTtl;
+
+    if (elapsed > 0)
+    {
+        IgnoreError(ReduceCachedTtls(aEntry, elapsed, minTtl, soaTtl));
+        aEntry.mAgeTime += Time::SecToMsec(elapsed);
+    }
+
+    response.mInstance              = &Get<Instance>();
+    response.mQuery                 = &aQuery;
+    response.mMessage               = aEntry.mMessage;
+    response.mAnswerOffset          = aEntry.mAnswerOffset;
+    response.mAnswerRecordCount     = aEntry.mAnswerRecordCount;
+    response.mAdditionalOffset      = aEntry.mAdditionalOffset;
+    response.mAdditionalRecordCount = aEntry.mAdditionalRecordCount;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    response.mIp6QueryResponseRequiresNat64 = aEntry.mIp6QueryResponseRequiresNat64;
+#endif
+
+    FinalizeQuery(response, aEntry.mResponseType, aEntry.mResponseError);
+}
+
+void Client::HandleCacheTasklet(Tasklet &aTasklet)
+{
+    aTasklet.Get<Client>().HandleCacheTasklet();
+}
+
+void Client::HandleCacheTasklet(void)
+{
+    // A single query is answered per run and the tasklet is posted
+    // again if there are more. This way a callback which starts the
+    // same query again does not keep us in this method.
+
+    Query *     query = FindQueryToAnswerFromCache();
+    QueryInfo   info;
+    CacheEntry *entry;
+
+    VerifyOrExit(query != nullptr);
+
+    info.ReadFrom(*query);
+    info.mAnswerFromCache = false;
+    UpdateQuery(*query, info);
+
+    entry = FindCacheEntry(*query, info.mQueryType, info.mConfig);
+
+    if (entry != nullptr)
+    {
+        mCacheCounters.mHits++;
+        AnswerFromCache(*query, *entry);
+    }
+    else
+    {
+        // The entry expired or was flushed in the meantime.
+        mCacheCounters.mMisses++;
+        SendQuery(*query, info, /* aUpdateTimer */ true);
+    }
+
+    if (FindQueryToAnswerFromCache() != nullptr)
+    {
+        mCacheTasklet.Post();
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
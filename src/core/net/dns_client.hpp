@@ -38,6 +38,7 @@
 #include "common/clearable.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
@@ -676,6 +677,30 @@ public:
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+    /**
+     * This type represents the response cache counters.
+     *
+     */
+    typedef otDnsClientCacheCounters CacheCounters;
+
+    /**
+     * This method gets the response cache counters.
+     *
+     * @returns The response cache counters.
+     *
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * This method removes all responses from the response cache.
+     *
+     */
+    void FlushCache(void);
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 private:
     enum QueryType : uint8_t
     {
@@ -711,6 +736,10 @@ private:
         TimeMilli   mRetransmissionTime;
         QueryConfig mConfig;
         uint8_t     mTransmissionCount;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        Query *mMainQuery;       // The in-flight query this one is attached to (`nullptr` if none).
+        bool   mAnswerFromCache; // Indicates the query is to be answered from the cache (by `mCacheTasklet`).
+#endif
         // Followed by the name (service, host, instance) encoded as a `Dns::Name`.
     };
 
@@ -725,11 +754,11 @@ private:
                            const char *       aName,
                            void *             aContext);
     Error       AllocateQuery(const QueryInfo &aInfo, const char *aLabel, const char *aName, Query *&aQuery);
-    void        FreeQuery(Query &aQuery);
-    void        UpdateQuery(Query &aQuery, const QueryInfo &aInfo) { aQuery.Write(0, aInfo); }
+    void        UpdateQuery(Query &aQuery, const QueryInfo &aInfo) { IgnoreError(aQuery.Write(0, aInfo)); }
     void        SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer);
     void        FinalizeQuery(Query &aQuery, Error aError);
     void        FinalizeQuery(Response &Response, QueryType aType, Error aError);
+    static void InvokeCallback(Response &aResponse, QueryType aType, Error aError);
     static void GetCallback(const Query &aQuery, Callback &aCallback, void *&aContext);
     Error       AppendNameFromQuery(const Query &aQuery, Message &aMessage);
     Query *     FindQueryById(uint16_t aMessageId);
@@ -744,6 +773,50 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     void UpdateDefaultConfigAddress(void);
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    enum : uint8_t
+    {
+        kCacheSize = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_SIZE,
+    };
+
+    enum : uint32_t
+    {
+        kCacheNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL, // in sec
+        kCacheMaxTtl      = 86400,                                           // in sec (one day)
+    };
+
+    struct CacheEntry : public Clearable<CacheEntry> // A cached response.
+    {
+        bool IsInUse(void) const { return mMessage != nullptr; }
+
+        Message *   mMessage;       // Response message starting from DNS header, `nullptr` if entry is unused.
+        TimeMilli   mAgeTime;       // Time when record TTLs in `mMessage` were last reduced.
+        TimeMilli   mExpireTime;    // Time when the entry expires.
+        QueryConfig mConfig;        // Config of the query (only server address and flags are used).
+        QueryType   mQueryType;     // The query type requested by the user.
+        QueryType   mResponseType;  // The query type the response answers (differs after NAT64 fallback).
+        Error       mResponseError; // The error from response code.
+        uint16_t    mAnswerOffset;
+        uint16_t    mAnswerRecordCount;
+        uint16_t    mAdditionalOffset;
+        uint16_t    mAdditionalRecordCount;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+        bool mIp6QueryResponseRequiresNat64;
+#endif
+    };
+
+    static bool  IsSameQueryConfig(const QueryConfig &aFirst, const QueryConfig &aSecond);
+    Query *      FindInFlightQuery(const Query &aQuery, const QueryInfo &aInfo);
+    Query *      FindAttachedQuery(const Query &aMainQuery);
+    Query *      FindQueryToAnswerFromCache(void);
+    CacheEntry * FindCacheEntry(const Query &aQuery, QueryType aType, const QueryConfig &aConfig);
+    void         AddToCache(const Response &aResponse, QueryType aType, Error aResponseError);
+    void         FreeCacheEntry(CacheEntry &aEntry);
+    static Error ReduceCachedTtls(CacheEntry &aEntry, uint32_t aElapsed, uint32_t &aMinTtl, uint32_t &aSoaTtl);
+    void         AnswerFromCache(Query &aQuery, CacheEntry &aEntry);
+    static void  HandleCacheTasklet(Tasklet &aTasklet);
+    void         HandleCacheTasklet(void);
+#endif
 
     static const uint8_t   kQuestionCount[];
     static const uint16_t *kQuestionRecordTypes[];
@@ -764,6 +837,11 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     bool mUserDidSetDefaultAddress;
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    CacheEntry    mCache[kCacheSize];
+    Tasklet       mCacheTasklet;
+    CacheCounters mCacheCounters;
+#endif
 };
 
 } // namespace Dns
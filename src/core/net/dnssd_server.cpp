@@ -186,7 +186,7 @@ void Server::SendResponse(Header                  aHeader,
     }
 
     aHeader.SetResponseCode(aResponseCode);
-    aMessage.Write(0, aHeader);
+    IgnoreError(aMessage.Write(0, aHeader));
 
     error = aSocket.SendTo(aMessage, aMessageInfo);
 
@@ -313,7 +313,7 @@ Error Server::AppendPtrRecord(Message &         aMessage,
     SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
 
     ptrRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
-    aMessage.Write(recordOffset, ptrRecord);
+    SuccessOrExit(error = aMessage.Write(recordOffset, ptrRecord));
 
 exit:
     return error;
@@ -346,7 +346,7 @@ Error Server::AppendSrvRecord(Message &         aMessage,
     SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
 
     srvRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
-    aMessage.Write(recordOffset, srvRecord);
+    SuccessOrExit(error = aMessage.Write(recordOffset, srvRecord));
 
 exit:
     return error;
@@ -374,152 +374,222 @@ exit:
 
 Error Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
-    Error       error;
-    uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, aName);
-    const char *serviceName;
+    return AppendName(aMessage, aName, /* aFirstLabelLength */ 0, aCompressInfo);
+}
 
-    // Check whether `aName` is a sub-type service name.
-    serviceName = StringFind(aName, kDnssdSubTypeLabel);
+Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+{
+    NameComponentsOffsetInfo nameComponentsInfo;
 
-    if (serviceName != nullptr)
-    {
-        uint8_t subTypeLabelLength = static_cast<uint8_t>(serviceName - aName) + sizeof(kDnssdSubTypeLabel) - 1;
+    IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
+    OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
 
-        SuccessOrExit(error = Name::AppendMultipleLabels(aName, subTypeLabelLength, aMessage));
+    // The instance label is the first label and can contain dot chars.
+    return AppendName(aMessage, aName, nameComponentsInfo.mServiceOffset - 1, aCompressInfo);
+}
 
-        // Skip over the "._sub." label to get to the root service name.
-        serviceName += sizeof(kDnssdSubTypeLabel) - 1;
-    }
-    else
-    {
-        serviceName = aName;
-    }
+Error Server::AppendTxtRecord(Message &         aMessage,
+                              const char *      aInstanceName,
+                              const void *      aTxtData,
+                              uint16_t          aTxtLength,
+                              uint32_t          aTtl,
+                              NameCompressInfo &aCompressInfo)
+{
+    Error     error = kErrorNone;
+    TxtRecord txtRecord;
 
-    if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(serviceName, Name::kMaxNameSize - 1) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
 
-        serviceCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetServiceNameOffset(serviceCompressOffset);
+    txtRecord.Init();
+    txtRecord.SetTtl(aTtl);
+    txtRecord.SetLength(aTxtLength);
 
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(serviceCompressOffset + domainStart);
-            error = Name::AppendName(serviceName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(serviceName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
+    SuccessOrExit(error = aMessage.Append(txtRecord));
+    error = aMessage.AppendBytes(aTxtData, aTxtLength);
 
 exit:
     return error;
 }
 
-Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
 {
-    Error    error;
-    uint16_t instanceCompressOffset = aCompressInfo.GetInstanceNameOffset(aMessage, aName);
+    return AppendName(aMessage, aName, /* aFirstLabelLength */ 0, aCompressInfo);
+}
 
-    if (instanceCompressOffset != NameCompressInfo::kUnknownOffset)
+Error Server::AppendName(Message &         aMessage,
+                         const char *      aName,
+                         uint8_t           aFirstLabelLength,
+                         NameCompressInfo &aCompressInfo)
+{
+    // This method appends `aName` to `aMessage`, replacing its longest
+    // suffix already present in the message with a pointer label. The
+    // suffixes are looked up in `aCompressInfo` by hash, from the
+    // shortest (last label) to the full name. The offsets of all the
+    // newly appended labels are then added to `aCompressInfo`.
+    //
+    // Labels in `aName` are separated by dot '.' chars, except that a
+    // non-zero `aFirstLabelLength` gives the length of the first label
+    // which can itself contain dot chars (service instance label).
+
+    Error    error       = kErrorNone;
+    uint16_t nameOffset  = aMessage.GetLength();
+    uint8_t  nameLength  = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength));
+    uint16_t matchOffset = NameCompressInfo::kUnknownOffset;
+    uint8_t  matchStart;
+    uint8_t  labelEnd;
+    uint16_t hash     = 0;
+    bool     matching = true;
+
+    if ((nameLength > 0) && (aName[nameLength - 1] == Name::kLabelSeperatorChar))
     {
-        error = Name::AppendPointerLabel(instanceCompressOffset, aMessage);
+        nameLength--;
     }
-    else
+
+    matchStart = nameLength;
+
+    for (labelEnd = nameLength; labelEnd > 0;)
     {
-        NameComponentsOffsetInfo nameComponentsInfo;
+        uint8_t labelStart = labelEnd;
 
-        IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
-        OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
+        if (labelEnd <= aFirstLabelLength)
+        {
+            labelStart = 0;
+        }
+        else
+        {
+            while ((labelStart > 0) && (aName[labelStart - 1] != Name::kLabelSeperatorChar))
+            {
+                labelStart--;
+            }
+        }
 
-        aCompressInfo.SetInstanceNameOffset(aMessage.GetLength());
+        VerifyOrExit((labelStart < labelEnd) && (labelEnd - labelStart <= Name::kMaxLabelLength),
+                     error = kErrorInvalidArgs);
 
-        // Append the instance name as one label
-        SuccessOrExit(error = Name::AppendLabel(aName, nameComponentsInfo.mServiceOffset - 1, aMessage));
+        hash = UpdateNameHash(hash, &aName[labelStart], labelEnd - labelStart);
 
+        if (matching)
         {
-            const char *serviceName           = aName + nameComponentsInfo.mServiceOffset;
-            uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, serviceName);
+            uint8_t  probe = 0;
+            uint16_t offset;
 
-            if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-            {
-                error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-            }
-            else
+            matching = false;
+
+            while ((offset = aCompressInfo.FindOffset(hash, probe)) != NameCompressInfo::kUnknownOffset)
             {
-                aCompressInfo.SetServiceNameOffset(aMessage.GetLength());
-                error = Name::AppendName(serviceName, aMessage);
+                if (MatchName(aMessage, offset, &aName[labelStart], nameLength - labelStart,
+                              (labelStart == 0) ? aFirstLabelLength : 0))
+                {
+                    matching    = true;
+                    matchStart  = labelStart;
+                    matchOffset = offset;
+                    break;
+                }
             }
         }
-    }
 
-exit:
-    return error;
-}
+        if (!matching)
+        {
+            // Each label is encoded with a length byte in place of the
+            // dot char before it, so a label starting at `labelStart`
+            // in `aName` is appended at `nameOffset + labelStart`.
 
-Error Server::AppendTxtRecord(Message &         aMessage,
-                              const char *      aInstanceName,
-                              const void *      aTxtData,
-                              uint16_t          aTxtLength,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
-{
-    Error     error = kErrorNone;
-    TxtRecord txtRecord;
+            aCompressInfo.AddOffset(hash, nameOffset + labelStart);
+        }
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+        labelEnd = (labelStart > 0) ? labelStart - 1 : 0;
+    }
 
-    txtRecord.Init();
-    txtRecord.SetTtl(aTtl);
-    txtRecord.SetLength(aTxtLength);
+    if (matchStart > 0)
+    {
+        uint8_t start = 0;
 
-    SuccessOrExit(error = aMessage.Append(txtRecord));
-    error = aMessage.AppendBytes(aTxtData, aTxtLength);
+        if (aFirstLabelLength != 0)
+        {
+            SuccessOrExit(error = Name::AppendLabel(aName, aFirstLabelLength, aMessage));
+            start = aFirstLabelLength + 1;
+        }
+
+        if (matchStart > start)
+        {
+            SuccessOrExit(error = Name::AppendMultipleLabels(&aName[start], matchStart - start, aMessage));
+        }
+    }
+
+    if (matchOffset != NameCompressInfo::kUnknownOffset)
+    {
+        error = Name::AppendPointerLabel(matchOffset, aMessage);
+    }
+    else
+    {
+        error = Name::AppendTerminator(aMessage);
+    }
 
 exit:
     return error;
 }
 
-Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+bool Server::MatchName(const Message &aMessage,
+                       uint16_t       aOffset,
+                       const char *   aName,
+                       uint8_t        aNameLength,
+                       uint8_t        aFirstLabelLength)
 {
-    Error    error;
-    uint16_t hostCompressOffset = aCompressInfo.GetHostNameOffset(aMessage, aName);
+    // This method checks whether the (possibly compressed) name at
+    // `aOffset` in `aMessage` matches the first `aNameLength` chars of
+    // `aName`. `aFirstLabelLength` is used as in `AppendName()`.
 
-    if (hostCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(hostCompressOffset, aMessage);
-    }
-    else
+    bool    matches = false;
+    uint8_t index   = 0;
+
+    while (true)
     {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
+        char    label[Name::kMaxLabelSize];
+        uint8_t readLength  = sizeof(label);
+        uint8_t labelLength = 0;
+        Error   error       = Name::ReadLabel(aMessage, aOffset, label, readLength);
+
+        if (error == kErrorNotFound)
+        {
+            matches = (index >= aNameLength);
+            break;
+        }
 
-        hostCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetHostNameOffset(hostCompressOffset);
+        VerifyOrExit((error == kErrorNone) && (index < aNameLength));
 
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
+        if ((index == 0) && (aFirstLabelLength != 0))
         {
-            aCompressInfo.SetDomainNameOffset(hostCompressOffset + domainStart);
-            error = Name::AppendName(aName, aMessage);
+            labelLength = aFirstLabelLength;
         }
         else
         {
-            SuccessOrExit(error = Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
+            while ((index + labelLength < aNameLength) && (aName[index + labelLength] != Name::kLabelSeperatorChar))
+            {
+                labelLength++;
+            }
         }
+
+        VerifyOrExit((readLength == labelLength) && (memcmp(label, &aName[index], labelLength) == 0));
+        index += labelLength + 1;
     }
 
 exit:
-    return error;
+    return matches;
+}
+
+uint16_t Server::UpdateNameHash(uint16_t aHash, const char *aLabel, uint8_t aLabelLength)
+{
+    // The hash of a name is derived from the hash of the name without
+    // its first label (`aHash`) and the first label (djb2 function).
+
+    uint16_t hash = static_cast<uint16_t>((aHash << 5) + aHash + aLabelLength);
+
+    for (uint8_t i = 0; i < aLabelLength; i++)
+    {
+        hash = static_cast<uint16_t>((hash << 5) + hash + static_cast<uint8_t>(aLabel[i]));
+    }
+
+    return hash;
 }
 
 void Server::IncResourceRecordCount(Header &aHeader, bool aAdditional)
@@ -671,83 +741,84 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                                               NameCompressInfo &aCompressInfo,
                                               bool              aAdditional)
 {
-    Error                    error    = kErrorNone;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    Error            error    = kErrorNone;
+    TimeMilli        now      = TimerMilli::GetNow();
+    uint16_t         qtype    = aQuestion.GetType();
+    Header::Response response = Header::kResponseNameError;
 
-    while ((host = GetNextSrpHost(host)) != nullptr)
+    // Handle PTR/SRV/TXT query
+    if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
     {
-        bool        needAdditionalAaaaRecord = false;
-        const char *hostName                 = host->GetFullName();
+        // A PTR query is matched against the service names and SRV/TXT
+        // queries against the service instance names, both of which
+        // are indexed by the SRP server.
+
+        bool                        isPtrQuery = (qtype == ResourceRecord::kTypePtr);
+        const Srp::Server::Service *service    = nullptr;
+        const Srp::Server::Host *   lastHost   = nullptr;
 
-        // Handle PTR/SRV/TXT query
-        if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+        while ((service = GetNextSrpService(aName, isPtrQuery, service)) != nullptr)
         {
-            const Srp::Server::Service *service = nullptr;
+            const Srp::Server::Host &host         = service->GetHost();
+            uint32_t                 instanceTtl  = TimeMilli::MsecToSec(service->GetExpireTime() - now);
+            const char *             instanceName = service->GetInstanceName();
 
-            while ((service = GetNextSrpService(*host, service)) != nullptr)
+            if (!aAdditional && isPtrQuery)
             {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetInstanceName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = service->MatchesInstanceName(aName);
-                bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
-                bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
-                bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
-
-                if (!aAdditional && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+                SuccessOrExit(error =
+                                  AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-                if ((!aAdditional && srvQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if ((!aAdditional && qtype == ResourceRecord::kTypeSrv) ||
+                (aAdditional && isPtrQuery &&
+                 !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
+            {
+                SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, host.GetFullName(), instanceTtl,
+                                                      service->GetPriority(), service->GetWeight(), service->GetPort(),
+                                                      aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
+            }
 
-                if ((!aAdditional && txtQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
-                {
-                    SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+            if ((!aAdditional && qtype == ResourceRecord::kTypeTxt) ||
+                (aAdditional && isPtrQuery &&
+                 !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
+            {
+                SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
+                                                      service->GetTxtDataLength(), instanceTtl, aCompressInfo));
+                IncResourceRecordCount(aResponseHeader, aAdditional);
+                response = Header::kResponseSuccess;
             }
-        }
 
-        // Handle AAAA query
-        if ((!aAdditional && qtype == ResourceRecord::kTypeAaaa && host->Matches(aName)) ||
-            (aAdditional && needAdditionalAaaaRecord &&
-             !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa)))
-        {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
+            // The additional AAAA records of a host are appended only
+            // once, along with the first of its services matching the
+            // PTR/SRV query. The SRP server keeps the services of a
+            // host with the same service name next to each other in
+            // its index (and an instance name matches one service), so
+            // it is enough to remember the last host handled.
 
-            for (uint8_t i = 0; i < addrNum; i++)
+            if (aAdditional && qtype != ResourceRecord::kTypeTxt && &host != lastHost &&
+                !HasQuestion(aResponseHeader, aResponseMessage, host.GetFullName(), ResourceRecord::kTypeAaaa))
             {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
-                IncResourceRecordCount(aResponseHeader, aAdditional);
+                SuccessOrExit(error = AppendSrpHostAddresses(host, now, aResponseHeader, aResponseMessage,
+                                                             aCompressInfo, aAdditional));
             }
 
+            lastHost = &host;
+        }
+    }
+
+    // Handle AAAA query
+    if (!aAdditional && qtype == ResourceRecord::kTypeAaaa)
+    {
+        const Srp::Server::Host *host = Get<Srp::Server>().FindHost(aName);
+
+        if (host != nullptr && !host->IsDeleted())
+        {
+            SuccessOrExit(error = AppendSrpHostAddresses(*host, now, aResponseHeader, aResponseMessage, aCompressInfo,
+                                                         aAdditional));
             response = Header::kResponseSuccess;
         }
     }
@@ -756,22 +827,42 @@ exit:
     return error == kErrorNone ? response : Header::kResponseServerFailure;
 }
 
-const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
+const Srp::Server::Service *Server::GetNextSrpService(const char *                aName,
+                                                      bool                        aMatchServiceName,
+                                                      const Srp::Server::Service *aService)
 {
-    const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
+    const Srp::Server &srpServer = Get<Srp::Server>();
 
-    while (host != nullptr && host->IsDeleted())
+    do
     {
-        host = Get<Srp::Server>().GetNextHost(host);
-    }
+        aService = aMatchServiceName ? srpServer.FindNextServiceWithServiceName(aName, aService)
+                                     : srpServer.FindNextServiceWithInstanceName(aName, aService);
+    } while (aService != nullptr && (aService->IsDeleted() || aService->GetHost().IsDeleted()));
 
-    return host;
+    return aService;
 }
 
-const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &   aHost,
-                                                      const Srp::Server::Service *aService)
+Error Server::AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                     TimeMilli                aNow,
+                                     Header &                 aResponseHeader,
+                                     Message &                aResponseMessage,
+                                     NameCompressInfo &       aCompressInfo,
+                                     bool                     aAdditional)
 {
-    return aHost.FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService);
+    Error               error = kErrorNone;
+    uint8_t             addrNum;
+    const Ip6::Address *addrs   = aHost.GetAddresses(addrNum);
+    uint32_t            hostTtl = TimeMilli::MsecToSec(aHost.GetExpireTime() - aNow);
+
+    for (uint8_t i = 0; i < addrNum; i++)
+    {
+        SuccessOrExit(error =
+                          AppendAaaaRecord(aResponseMessage, aHost.GetFullName(), addrs[i], hostTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
+    }
+
+exit:
+    return error;
 }
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
@@ -1163,6 +1254,58 @@ void Server::FinalizeQuery(QueryTransaction &aQuery, Header::Response aResponseC
     aQuery.Finalize(aResponseCode, mSocket);
 }
 
+uint16_t Server::NameCompressInfo::FindOffset(uint16_t aHash, uint8_t &aProbe) const
+{
+    // The table uses open addressing with linear probing from the
+    // index selected by `aHash`. `aProbe` tracks the number of probed
+    // entries, so the caller can iterate over all offsets recorded
+    // with `aHash` (it starts from zero).
+
+    uint16_t offset = kUnknownOffset;
+
+    while (aProbe < kTableSize)
+    {
+        uint8_t index = (aHash + aProbe) % kTableSize;
+
+        aProbe++;
+
+        if (mOffsets[index] == kUnknownOffset)
+        {
+            aProbe = kTableSize;
+        }
+        else if (mHashes[index] == aHash)
+        {
+            offset = mOffsets[index];
+            break;
+        }
+    }
+
+    return offset;
+}
+
+void Server::NameCompressInfo::AddOffset(uint16_t aHash, uint16_t aOffset)
+{
+    // A name beyond the 14-bit pointer label offset range cannot be
+    // referred to. If the table is full, the offset is not added.
+
+    VerifyOrExit(aOffset <= kMaxOffset);
+
+    for (uint8_t probe = 0; probe < kTableSize; probe++)
+    {
+        uint8_t index = (aHash + probe) % kTableSize;
+
+        if (mOffsets[index] == kUnknownOffset)
+        {
+            mOffsets[index] = aOffset;
+            mHashes[index]  = aHash;
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
 void Server::QueryTransaction::Init(const Header &          aResponseHeader,
                                     Message &               aResponseMessage,
                                     const NameCompressInfo &aCompressInfo,
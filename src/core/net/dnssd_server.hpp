@@ -152,79 +152,31 @@ private:
         explicit NameCompressInfo(void) = default;
 
         explicit NameCompressInfo(const char *aDomainName)
-            : mDomainName(aDomainName)
-            , mDomainNameOffset(kUnknownOffset)
-            , mServiceNameOffset(kUnknownOffset)
-            , mInstanceNameOffset(kUnknownOffset)
-            , mHostNameOffset(kUnknownOffset)
         {
+            Clear();
+            mDomainName = aDomainName;
         }
 
         enum : uint16_t
         {
-            kUnknownOffset = 0, // Unknown offset value (used when offset is not yet set).
+            kUnknownOffset = 0,      // Unknown offset value (used when offset is not yet set).
+            kMaxOffset     = 0x3fff, // Maximum offset which can be used in a pointer label.
         };
 
-        uint16_t GetDomainNameOffset(void) const { return mDomainNameOffset; }
-
-        void SetDomainNameOffset(uint16_t aOffset) { mDomainNameOffset = aOffset; }
-
         const char *GetDomainName(void) const { return mDomainName; }
 
-        uint16_t GetServiceNameOffset(const Message &aMessage, const char *aServiceName) const
-        {
-            return MatchCompressedName(aMessage, mServiceNameOffset, aServiceName)
-                       ? mServiceNameOffset
-                       : static_cast<uint16_t>(kUnknownOffset);
-        };
-
-        void SetServiceNameOffset(uint16_t aOffset)
-        {
-            if (mServiceNameOffset == kUnknownOffset)
-            {
-                mServiceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetInstanceNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mInstanceNameOffset, aName) ? mInstanceNameOffset
-                                                                             : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetInstanceNameOffset(uint16_t aOffset)
-        {
-            if (mInstanceNameOffset == kUnknownOffset)
-            {
-                mInstanceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetHostNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mHostNameOffset, aName) ? mHostNameOffset
-                                                                         : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetHostNameOffset(uint16_t aOffset)
-        {
-            if (mHostNameOffset == kUnknownOffset)
-            {
-                mHostNameOffset = aOffset;
-            }
-        }
+        uint16_t FindOffset(uint16_t aHash, uint8_t &aProbe) const;
+        void     AddOffset(uint16_t aHash, uint16_t aOffset);
 
     private:
-        static bool MatchCompressedName(const Message &aMessage, uint16_t aOffset, const char *aName)
+        enum : uint8_t
         {
-            return aOffset != kUnknownOffset && Name::CompareName(aMessage, aOffset, aName) == kErrorNone;
-        }
+            kTableSize = OPENTHREAD_CONFIG_DNSSD_SERVER_NAME_COMPRESS_TABLE_SIZE,
+        };
 
-        const char *mDomainName;         // The serialized domain name.
-        uint16_t    mDomainNameOffset;   // Offset of domain name serialization into the response message.
-        uint16_t    mServiceNameOffset;  // Offset of service name serialization into the response message.
-        uint16_t    mInstanceNameOffset; // Offset of instance name serialization into the response message.
-        uint16_t    mHostNameOffset;     // Offset of host name serialization into the response message.
+        const char *mDomainName;          // The serialized domain name.
+        uint16_t    mOffsets[kTableSize]; // Offsets of names (or name suffixes) in the response message.
+        uint16_t    mHashes[kTableSize];  // Hashes of the names at `mOffsets` (index into the table).
     };
 
     enum
@@ -346,6 +298,16 @@ private:
     static Error            AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
     static Error            AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
     static Error            AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
+    static Error            AppendName(Message &         aMessage,
+                                       const char *      aName,
+                                       uint8_t           aFirstLabelLength,
+                                       NameCompressInfo &aCompressInfo);
+    static bool             MatchName(const Message &aMessage,
+                                      uint16_t       aOffset,
+                                      const char *   aName,
+                                      uint8_t        aNameLength,
+                                      uint8_t        aFirstLabelLength);
+    static uint16_t         UpdateNameHash(uint16_t aHash, const char *aLabel, uint8_t aLabelLength);
     static void             IncResourceRecordCount(Header &aHeader, bool aAdditional);
     static Error            FindNameComponents(const char *aName, const char *aDomain, NameComponentsOffsetInfo &aInfo);
     static Error            FindPreviousLabel(const char *aName, uint8_t &aStart, uint8_t &aStop);
@@ -364,9 +326,15 @@ private:
                                                             Message &         aResponseMessage,
                                                             NameCompressInfo &aCompressInfo,
                                                             bool              aAdditional);
-    const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
-    static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
+    const Srp::Server::Service *       GetNextSrpService(const char *                aName,
+                                                         bool                        aMatchServiceName,
                                                          const Srp::Server::Service *aService);
+    static Error                       AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                                              TimeMilli                aNow,
+                                                              Header &                 aResponseHeader,
+                                                              Message &                aResponseMessage,
+                                                              NameCompressInfo &       aCompressInfo,
+                                                              bool                     aAdditional);
 #endif
 
     Error             ResolveByQueryCallbacks(Header &                aResponseHeader,
@@ -107,12 +107,12 @@ Error Icmp::SendError(Header::Type aType, Header::Code aCode, const MessageInfo
     VerifyOrExit((message = Get<Ip6>().NewMessage(0, settings)) != nullptr, error = kErrorNoBufs);
     SuccessOrExit(error = message->SetLength(sizeof(icmp6Header) + sizeof(ip6Header)));
 
-    message->Write(sizeof(icmp6Header), ip6Header);
+    SuccessOrExit(error = message->Write(sizeof(icmp6Header), ip6Header));
 
     icmp6Header.Clear();
     icmp6Header.SetType(aType);
     icmp6Header.SetCode(aCode);
-    message->Write(0, icmp6Header);
+    SuccessOrExit(error = message->Write(0, icmp6Header));
 
     SuccessOrExit(error = Get<Ip6>().SendDatagram(*message, messageInfoLocal, kProtoIcmp6));
 
@@ -196,7 +196,7 @@ Error Icmp::HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMess
     payloadLength = aRequestMessage.GetLength() - aRequestMessage.GetOffset() - Header::kDataFieldOffset;
     SuccessOrExit(error = replyMessage->SetLength(Header::kDataFieldOffset + payloadLength));
 
-    replyMessage->WriteBytes(0, &icmp6Header, Header::kDataFieldOffset);
+    SuccessOrExit(error = replyMessage->WriteBytes(0, &icmp6Header, Header::kDataFieldOffset));
     aRequestMessage.CopyTo(aRequestMessage.GetOffset() + Header::kDataFieldOffset, Header::kDataFieldOffset,
                            payloadLength, *replyMessage);
 
@@ -269,22 +269,23 @@ Error Ip6::InsertMplOption(Message &aMessage, Header &aHeader, MessageInfo &aMes
 
             // increase existing hop-by-hop option header length by 8 bytes
             hbh.SetLength(hbh.GetLength() + 1);
-            aMessage.Write(0, hbh);
+            SuccessOrExit(error = aMessage.Write(0, hbh));
 
             // make space for MPL Option + padding by shifting hop-by-hop option header
             SuccessOrExit(error = aMessage.PrependBytes(nullptr, 8));
-            aMessage.CopyTo(8, 0, hbhLength, aMessage);
+            VerifyOrExit(aMessage.CopyTo(8, 0, hbhLength, aMessage) == hbhLength, error = kErrorNoBufs);
 
             // insert MPL Option
             mMpl.InitOption(mplOption, aHeader.GetSource());
-            aMessage.WriteBytes(hbhLength, &mplOption, mplOption.GetTotalLength());
+            SuccessOrExit(error = aMessage.WriteBytes(hbhLength, &mplOption, mplOption.GetTotalLength()));
 
             // insert Pad Option (if needed)
             if (mplOption.GetTotalLength() % 8)
             {
                 OptionPadN padOption;
                 padOption.Init(8 - (mplOption.GetTotalLength() % 8));
-                aMessage.WriteBytes(hbhLength + mplOption.GetTotalLength(), &padOption, padOption.GetTotalLength());
+                SuccessOrExit(error = aMessage.WriteBytes(hbhLength + mplOption.GetTotalLength(), &padOption,
+                                                          padOption.GetTotalLength()));
             }
 
             // increase IPv6 Payload Length
@@ -305,7 +306,7 @@ Error Ip6::InsertMplOption(Message &aMessage, Header &aHeader, MessageInfo &aMes
         {
             Message *messageCopy = nullptr;
 
-            if ((messageCopy = aMessage.Clone()) != nullptr)
+            if ((messageCopy = aMessage.CloneShared()) != nullptr)
             {
                 IgnoreError(HandleDatagram(*messageCopy, nullptr, nullptr, true));
                 otLogInfoIp6("Message copy for indirect transmission to sleepy children");
@@ -406,7 +407,7 @@ Error Ip6::RemoveMplOption(Message &aMessage)
         while (offset >= sizeof(buf))
         {
             IgnoreError(aMessage.Read(offset - sizeof(buf), buf));
-            aMessage.Write(offset, buf);
+            SuccessOrExit(error = aMessage.Write(offset, buf));
             offset -= sizeof(buf);
         }
 
@@ -421,11 +422,11 @@ Error Ip6::RemoveMplOption(Message &aMessage)
         {
             // update HBH header length
             hbh.SetLength(hbh.GetLength() - 1);
-            aMessage.Write(sizeof(ip6Header), hbh);
+            SuccessOrExit(error = aMessage.Write(sizeof(ip6Header), hbh));
         }
 
         ip6Header.SetPayloadLength(ip6Header.GetPayloadLength() - sizeof(buf));
-        aMessage.Write(0, ip6Header);
+        SuccessOrExit(error = aMessage.Write(0, ip6Header));
     }
     else if (mplOffset != 0)
     {
@@ -433,7 +434,7 @@ Error Ip6::RemoveMplOption(Message &aMessage)
         OptionPadN padOption;
 
         padOption.Init(sizeof(OptionHeader) + mplLength);
-        aMessage.WriteBytes(mplOffset, &padOption, padOption.GetTotalLength());
+        SuccessOrExit(error = aMessage.WriteBytes(mplOffset, &padOption, padOption.GetTotalLength()));
     }
 
 exit:
@@ -487,14 +488,15 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
 
     SuccessOrExit(error = aMessage.Prepend(header));
 
-    Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(), aIpProto);
+    SuccessOrExit(error =
+                      Checksum::UpdateMessageChecksum(aMessage, header.GetSource(), header.GetDestination(), aIpProto));
 
     if (aMessageInfo.GetPeerAddr().IsMulticastLargerThanRealmLocal())
     {
 #if OPENTHREAD_FTD
         if (Get<ChildTable>().HasSleepyChildWithAddress(header.GetDestination()))
         {
-            Message *messageCopy = aMessage.Clone();
+            Message *messageCopy = aMessage.CloneShared();
 
             if (messageCopy != nullptr)
             {
@@ -651,10 +653,10 @@ Error Ip6::FragmentDatagram(Message &aMessage, uint8_t aIpProto)
         SuccessOrExit(error = fragment->SetLength(aMessage.GetOffset() + sizeof(fragmentHeader) + payloadFragment));
 
         header.SetPayloadLength(payloadFragment + sizeof(fragmentHeader));
-        fragment->Write(0, header);
+        IgnoreError(fragment->Write(0, header));
 
         fragment->SetOffset(aMessage.GetOffset());
-        fragment->Write(aMessage.GetOffset(), fragmentHeader);
+        IgnoreError(fragment->Write(aMessage.GetOffset(), fragmentHeader));
 
         VerifyOrExit(aMessage.CopyTo(aMessage.GetOffset() + FragmentHeader::FragmentOffsetToBytes(offset),
                                      aMessage.GetOffset() + sizeof(fragmentHeader), payloadFragment,
@@ -767,7 +769,7 @@ Error Ip6::HandleFragment(Message &aMessage, Netif *aNetif, MessageInfo &aMessag
         SuccessOrExit(error = aMessage.Read(0, header));
         header.SetPayloadLength(message->GetLength() - sizeof(header));
         header.SetNextHeader(fragmentHeader.GetNextHeader());
-        message->Write(0, header);
+        IgnoreError(message->Write(0, header));
 
         otLogDebgIp6("Reassembly complete.");
 
@@ -956,7 +958,7 @@ Error Ip6::HandlePayload(Message &          aMessage,
 
     if (aMessageOwnership == Message::kCopyToUse)
     {
-        VerifyOrExit((message = aMessage.Clone()) != nullptr, error = kErrorNoBufs);
+        VerifyOrExit((message = aMessage.CloneShared()) != nullptr, error = kErrorNoBufs);
     }
 
     switch (aIpProto)
@@ -1059,7 +1061,7 @@ Error Ip6::ProcessReceiveCallback(Message &          aMessage,
         break;
 
     case Message::kCopyToUse:
-        message = aMessage.Clone();
+        message = aMessage.CloneShared();
 
         if (message == nullptr)
         {
@@ -1270,7 +1272,7 @@ start:
         VerifyOrExit(header.GetHopLimit() > 0, error = kErrorDrop);
 
         hopLimit = header.GetHopLimit();
-        aMessage.Write(Header::kHopLimitFieldOffset, hopLimit);
+        SuccessOrExit(error = aMessage.Write(Header::kHopLimitFieldOffset, hopLimit));
 
         if (aFromNcpHost && nextHeader == kProtoIcmp6)
         {
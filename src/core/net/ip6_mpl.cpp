@@ -54,7 +54,7 @@ Mpl::Mpl(Instance &aInstance)
     , mTimerExpirations(0)
 #endif
 {
-    memset(mSeedSet, 0, sizeof(mSeedSet));
+    ResetCounters();
 }
 
 void Mpl::InitOption(OptionMpl &aOption, const Address &aAddress)
@@ -99,7 +99,7 @@ Error Mpl::ProcessOption(Message &aMessage, const Address &aAddress, bool aIsOut
     if (error == kErrorNone)
     {
 #if OPENTHREAD_FTD
-        AddBufferedMessage(aMessage, option.GetSeedId(), option.GetSequence(), aIsOutbound);
+        AddBufferedMessage(aMessage, aIsOutbound);
 #endif
     }
     else if (aIsOutbound)
@@ -109,159 +109,198 @@ Error Mpl::ProcessOption(Message &aMessage, const Address &aAddress, bool aIsOut
         // to allow subsequent retransmissions with the same sequence number.
         ExitNow(error = kErrorNone);
     }
+    else
+    {
+        if (error == kErrorDuplicated)
+        {
+            mCounters.mDuplicates++;
+        }
+        else
+        {
+            mCounters.mSeedSetFull++;
+        }
+
+        error = kErrorDrop;
+    }
 
 exit:
     return error;
 }
 
 /*
- * mSeedSet stores recently received (Seed ID, Sequence) values.
- * - (Seed ID, Sequence) values are grouped by Seed ID.
+ * mSeedSet stores recently received (Seed ID, Sequence) values in hash buckets indexed by Seed ID.
+ * - (Seed ID, Sequence) values are grouped by Seed ID within a bucket.
  * - (Seed ID, Sequence) groups are not sorted by Seed ID relative to other groups.
  * - (Seed ID, Sequence) values within a group are sorted by Sequence.
- * - All unused entries (marked by 0 lifetime) are grouped at the end.
+ * - Entries are allocated from mSeedEntryPool.
  *
  * Update process:
  *
- * - Eviction selection:
- *   - If there are unused entries, mark the first unused entry for "eviction"
- *   - Otherwise, pick the first entry of the group that has the most entries.
+ * - If there exists a group matching the Seed ID, select insert position based on Sequence ordering.
+ *   Otherwise, insert at the head of the bucket.
  *
- * - Insert selection:
- *   - If there exists a group matching the Seed ID, select insert entry based on Sequence ordering.
- *   - Otherwise, set insert entry equal to evict entry.
- *
- * - If evicting a valid entry (lifetime non-zero):
+ * - If there are no free entries, evict the first entry of the group that has the most entries:
  *   - Require group size to have >=2 entries.
  *   - If inserting into existing group, require Sequence to be larger than oldest stored Sequence in group.
  */
 Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
 {
-    Error      error    = kErrorNone;
-    SeedEntry *insert   = nullptr;
-    SeedEntry *group    = mSeedSet;
-    SeedEntry *evict    = mSeedSet;
-    uint8_t    curCount = 0;
-    uint8_t    maxCount = 0;
-
-    for (uint32_t i = 0; i < kNumSeedEntries; i++, curCount++)
+    Error                  error         = kErrorNone;
+    LinkedList<SeedEntry> &bucket        = GetSeedBucket(aSeedId);
+    SeedEntry *            insertAfter   = nullptr;
+    SeedEntry *            prev          = nullptr;
+    bool                   groupFound    = false;
+    bool                   positionFound = false;
+    SeedEntry *            entry;
+
+    for (entry = bucket.GetHead(); entry != nullptr; prev = entry, entry = entry->GetNext())
     {
-        if (mSeedSet[i].mLifetime == 0)
-        {
-            // unused entries exist
+        int8_t diff;
 
-            if (insert == nullptr)
+        if (entry->mSeedId != aSeedId)
+        {
+            if (groupFound)
             {
-                // no existing group, set insert and evict entry to be the same
-                insert = &mSeedSet[i];
+                break;
             }
 
-            // mark first unused entry for eviction
-            evict = &mSeedSet[i];
-            break;
+            continue;
         }
 
-        if (mSeedSet[i].mSeedId != group->mSeedId)
-        {
-            // processing new group
+        diff = static_cast<int8_t>(aSequence - entry->mSequence);
 
-            if (aSeedId == group->mSeedId && insert == nullptr)
-            {
-                // insert at end of existing group
-                insert = &mSeedSet[i];
-                curCount++;
-            }
+        // already received, drop message
+        VerifyOrExit(diff != 0, error = kErrorDuplicated);
 
-            if (maxCount < curCount)
-            {
-                // look to evict an entry from the seed with the most entries
-                evict    = group;
-                maxCount = curCount;
-            }
-
-            group    = &mSeedSet[i];
-            curCount = 0;
+        if (!groupFound)
+        {
+            groupFound  = true;
+            insertAfter = prev;
         }
 
-        if (aSeedId == mSeedSet[i].mSeedId)
+        if (!positionFound && diff > 0)
         {
-            // have existing entries for aSeedId
-
-            int8_t diff = static_cast<int8_t>(aSequence - mSeedSet[i].mSequence);
-
-            if (diff == 0)
-            {
-                // already received, drop message
-                ExitNow(error = kErrorDrop);
-            }
-            else if (insert == nullptr && diff < 0)
-            {
-                // insert in order of sequence
-                insert = &mSeedSet[i];
-                curCount++;
-            }
+            insertAfter = entry;
+        }
+        else
+        {
+            positionFound = true;
         }
     }
 
-    if (evict->mLifetime != 0)
+    entry = mSeedEntryPool.Allocate();
+
+    if (entry == nullptr)
     {
         // no free entries available, look to evict an existing entry
-        OT_ASSERT(curCount != 0);
 
-        if (aSeedId == group->mSeedId && insert == nullptr)
-        {
-            // insert at end of existing group
-            insert = &mSeedSet[kNumSeedEntries];
-            curCount++;
-        }
+        // require Sequence to be larger than oldest stored Sequence in group
+        VerifyOrExit(!groupFound || (insertAfter != nullptr && insertAfter->mSeedId == aSeedId), error = kErrorDrop);
 
-        if (maxCount < curCount)
-        {
-            // look to evict an entry from the seed with the most entries
-            evict    = group;
-            maxCount = curCount;
-        }
+        SuccessOrExit(error = EvictSeedEntry(aSeedId, insertAfter));
+        entry = mSeedEntryPool.Allocate();
+        OT_ASSERT(entry != nullptr);
+    }
 
-        // require evict group size to have >= 2 entries
-        VerifyOrExit(maxCount > 1, error = kErrorDrop);
+    entry->mSeedId   = aSeedId;
+    entry->mSequence = aSequence;
+    entry->mLifetime = kSeedEntryLifetime;
 
-        if (insert == nullptr)
-        {
-            // no existing entries for aSeedId
-            insert = evict;
-        }
-        else
-        {
-            // require Sequence to be larger than oldest stored Sequence in group
-            VerifyOrExit(insert > mSeedSet && aSeedId == (insert - 1)->mSeedId, error = kErrorDrop);
-        }
+    if (insertAfter == nullptr)
+    {
+        bucket.Push(*entry);
+    }
+    else
+    {
+        bucket.PushAfter(*entry, *insertAfter);
     }
 
-    if (evict > insert)
+    if (!mSeedSetTimer.IsRunning())
     {
-        OT_ASSERT(insert >= mSeedSet);
-        memmove(insert + 1, insert, static_cast<size_t>(evict - insert) * sizeof(SeedEntry));
+        mSeedSetTimer.Start(kSeedEntryLifetimeDt);
     }
-    else if (evict < insert)
+
+exit:
+    return error;
+}
+
+Error Mpl::EvictSeedEntry(uint16_t aSeedId, SeedEntry *&aInsertAfter)
+{
+    // This method evicts the first (oldest) entry of the group with
+    // the most entries. The group of `aSeedId` is counted with the
+    // entry which is going to be added. `aInsertAfter` is updated if
+    // it is the evicted entry.
+
+    Error                  error       = kErrorNone;
+    LinkedList<SeedEntry> *evictBucket = nullptr;
+    SeedEntry *            evictPrev   = nullptr;
+    SeedEntry *            evict       = nullptr;
+    uint8_t                maxCount    = 0;
+
+    for (LinkedList<SeedEntry> &bucket : mSeedSet)
     {
-        OT_ASSERT(evict >= mSeedSet);
-        memmove(evict, evict + 1, static_cast<size_t>(insert - 1 - evict) * sizeof(SeedEntry));
-        insert--;
+        SeedEntry *groupHead = nullptr;
+        SeedEntry *groupPrev = nullptr;
+        SeedEntry *prev      = nullptr;
+        uint8_t    count     = 0;
+
+        for (SeedEntry *entry = bucket.GetHead();; prev = entry, entry = entry->GetNext())
+        {
+            if ((entry == nullptr) || (groupHead == nullptr) || (entry->mSeedId != groupHead->mSeedId))
+            {
+                if (groupHead != nullptr)
+                {
+                    if (groupHead->mSeedId == aSeedId)
+                    {
+                        count++;
+                    }
+
+                    if (maxCount < count)
+                    {
+                        // look to evict an entry from the seed with the most entries
+                        evictBucket = &bucket;
+                        evictPrev   = groupPrev;
+                        evict       = groupHead;
+                        maxCount    = count;
+                    }
+                }
+
+                if (entry == nullptr)
+                {
+                    break;
+                }
+
+                groupHead = entry;
+                groupPrev = prev;
+                count     = 0;
+            }
+
+            count++;
+        }
     }
 
-    insert->mSeedId   = aSeedId;
-    insert->mSequence = aSequence;
-    insert->mLifetime = kSeedEntryLifetime;
+    // require evict group size to have >= 2 entries
+    VerifyOrExit(maxCount > 1, error = kErrorDrop);
 
-    if (!mSeedSetTimer.IsRunning())
+    IgnoreReturnValue(evictBucket->PopAfter(evictPrev));
+
+    if (aInsertAfter == evict)
     {
-        mSeedSetTimer.Start(kSeedEntryLifetimeDt);
+        aInsertAfter = evictPrev;
     }
 
+    mSeedEntryPool.Free(*evict);
+
 exit:
     return error;
 }
 
+LinkedList<Mpl::SeedEntry> &Mpl::GetSeedBucket(uint16_t aSeedId)
+{
+    // Seed Id is usually an RLOC16, fold the Router Id into the Child Id bits.
+    return mSeedSet[(aSeedId ^ (aSeedId >> 10)) % kNumSeedBuckets];
+}
+
 void Mpl::HandleSeedSetTimer(Timer &aTimer)
 {
     aTimer.Get<Mpl>().HandleSeedSetTimer();
@@ -270,22 +309,30 @@ void Mpl::HandleSeedSetTimer(Timer &aTimer)
 void Mpl::HandleSeedSetTimer(void)
 {
     bool startTimer = false;
-    int  j          = 0;
 
-    for (int i = 0; i < kNumSeedEntries && mSeedSet[i].mLifetime; i++)
+    for (LinkedList<SeedEntry> &bucket : mSeedSet)
     {
-        mSeedSet[i].mLifetime--;
+        SeedEntry *prev = nullptr;
+        SeedEntry *entry;
+        SeedEntry *next;
 
-        if (mSeedSet[i].mLifetime > 0)
+        for (entry = bucket.GetHead(); entry != nullptr; entry = next)
         {
-            mSeedSet[j++] = mSeedSet[i];
-            startTimer    = true;
-        }
-    }
+            next = entry->GetNext();
 
-    for (; j < kNumSeedEntries && mSeedSet[j].mLifetime; j++)
-    {
-        mSeedSet[j].mLifetime = 0;
+            entry->mLifetime--;
+
+            if (entry->mLifetime > 0)
+            {
+                prev       = entry;
+                startTimer = true;
+            }
+            else
+            {
+                IgnoreReturnValue(bucket.PopAfter(prev));
+                mSeedEntryPool.Free(*entry);
+            }
+        }
     }
 
     if (startTimer)
@@ -296,12 +343,12 @@ void Mpl::HandleSeedSetTimer(void)
 
 #if OPENTHREAD_FTD
 
-void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound)
+void Mpl::AddBufferedMessage(Message &aMessage, bool aIsOutbound)
 {
-    Error    error       = kErrorNone;
-    Message *messageCopy = nullptr;
-    Metadata metadata;
-    uint8_t  hopLimit = 0;
+    Error            error           = kErrorNone;
+    Message *        messageCopy     = nullptr;
+    BufferedMessage *bufferedMessage = nullptr;
+    uint8_t          hopLimit        = 0;
 
 #if OPENTHREAD_CONFIG_MPL_DYNAMIC_INTERVAL_ENABLE
     // adjust the first MPL forward interval dynamically according to the network scale
@@ -311,28 +358,106 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
 #endif
 
     VerifyOrExit(GetTimerExpirations() > 0);
-    VerifyOrExit((messageCopy = aMessage.Clone()) != nullptr, error = kErrorNoBufs);
+    VerifyOrExit((messageCopy = aMessage.CloneShared()) != nullptr, error = kErrorNoBufs);
 
     if (!aIsOutbound)
     {
         IgnoreError(aMessage.Read(Header::kHopLimitFieldOffset, hopLimit));
         VerifyOrExit(hopLimit-- > 1, error = kErrorDrop);
-        messageCopy->Write(Header::kHopLimitFieldOffset, hopLimit);
+        SuccessOrExit(error = messageCopy->Write(Header::kHopLimitFieldOffset, hopLimit));
     }
 
-    metadata.mSeedId            = aSeedId;
-    metadata.mSequence          = aSequence;
-    metadata.mTransmissionCount = aIsOutbound ? 1 : 0;
-    metadata.mIntervalOffset    = 0;
-    metadata.GenerateNextTransmissionTime(TimerMilli::GetNow(), interval);
+    if ((bufferedMessage = mBufferedMessagePool.Allocate()) == nullptr)
+    {
+        bufferedMessage = EvictBufferedMessage();
+    }
 
-    SuccessOrExit(error = metadata.AppendTo(*messageCopy));
-    mBufferedMessageSet.Enqueue(*messageCopy);
+    bufferedMessage->mMessage           = messageCopy;
+    bufferedMessage->mTransmissionCount = aIsOutbound ? 1 : 0;
+    bufferedMessage->mIntervalOffset    = 0;
+    bufferedMessage->GenerateNextTransmissionTime(TimerMilli::GetNow(), interval);
 
-    mRetransmissionTimer.FireAtIfEarlier(metadata.mTransmissionTime);
+    mBufferedMessageSet.Enqueue(*messageCopy);
+    ScheduleRetransmission(*bufferedMessage);
 
 exit:
-    FreeMessageOnError(messageCopy, error);
+    if (error != kErrorNone)
+    {
+        FreeMessage(messageCopy);
+
+        if (error != kErrorDrop)
+        {
+            mCounters.mNotBuffered++;
+        }
+    }
+}
+
+Mpl::BufferedMessage *Mpl::EvictBufferedMessage(void)
+{
+    // Evict the buffered message with the fewest remaining transmissions.
+    // A message that was not transmitted yet is forwarded once now, so
+    // that every new MPL Data Message is forwarded at least once.
+
+    BufferedMessage *evicted     = nullptr;
+    BufferedMessage *evictedPrev = nullptr;
+    BufferedMessage *prev        = nullptr;
+
+    for (BufferedMessage *entry = mRetransmissionQueue.GetHead(); entry != nullptr; entry = entry->GetNext())
+    {
+        if ((evicted == nullptr) || (entry->mTransmissionCount > evicted->mTransmissionCount))
+        {
+            evicted     = entry;
+            evictedPrev = prev;
+        }
+
+        prev = entry;
+    }
+
+    OT_ASSERT(evicted != nullptr);
+
+    IgnoreReturnValue(mRetransmissionQueue.PopAfter(evictedPrev));
+    mBufferedMessageSet.Dequeue(*evicted->mMessage);
+
+    if (evicted->mTransmissionCount == 0)
+    {
+        Get<Ip6>().EnqueueDatagram(*evicted->mMessage);
+    }
+    else
+    {
+        evicted->mMessage->Free();
+    }
+
+    mCounters.mBufferedEvicted++;
+
+    return evicted;
+}
+
+void Mpl::ScheduleRetransmission(BufferedMessage &aBufferedMessage)
+{
+    // Insert `aBufferedMessage` after all entries with the same or an
+    // earlier transmission time, so the timer only tracks the head.
+
+    BufferedMessage *prev = nullptr;
+
+    for (BufferedMessage *entry = mRetransmissionQueue.GetHead(); entry != nullptr; entry = entry->GetNext())
+    {
+        if (aBufferedMessage.mTransmissionTime < entry->mTransmissionTime)
+        {
+            break;
+        }
+
+        prev = entry;
+    }
+
+    if (prev == nullptr)
+    {
+        mRetransmissionQueue.Push(aBufferedMessage);
+        mRetransmissionTimer.FireAt(aBufferedMessage.mTransmissionTime);
+    }
+    else
+    {
+        mRetransmissionQueue.PushAfter(aBufferedMessage, *prev);
+    }
 }
 
 void Mpl::HandleRetransmissionTimer(Timer &aTimer)
@@ -342,103 +467,66 @@ void Mpl::HandleRetransmissionTimer(Timer &aTimer)
 
 void Mpl::HandleRetransmissionTimer(void)
 {
-    TimeMilli now      = TimerMilli::GetNow();
-    TimeMilli nextTime = now.GetDistantFuture();
-    Metadata  metadata;
-    Message * message;
-    Message * nextMessage;
+    TimeMilli        now = TimerMilli::GetNow();
+    BufferedMessage *bufferedMessage;
 
-    for (message = mBufferedMessageSet.GetHead(); message != nullptr; message = nextMessage)
+    while ((bufferedMessage = mRetransmissionQueue.GetHead()) != nullptr)
     {
-        nextMessage = message->GetNext();
+        Message &message = *bufferedMessage->mMessage;
 
-        metadata.ReadFrom(*message);
+        if (now < bufferedMessage->mTransmissionTime)
+        {
+            mRetransmissionTimer.FireAt(bufferedMessage->mTransmissionTime);
+            break;
+        }
 
-        if (now < metadata.mTransmissionTime)
+        IgnoreReturnValue(mRetransmissionQueue.Pop());
+
+        // Update the number of transmission timer expirations.
+        bufferedMessage->mTransmissionCount++;
+
+        if (bufferedMessage->mTransmissionCount < GetTimerExpirations())
         {
-            if (nextTime > metadata.mTransmissionTime)
+            Message *messageCopy = message.CloneShared();
+
+            if (messageCopy != nullptr)
             {
-                nextTime = metadata.mTransmissionTime;
+                if (bufferedMessage->mTransmissionCount > 1)
+                {
+                    messageCopy->SetSubType(Message::kSubTypeMplRetransmission);
+                }
+
+                Get<Ip6>().EnqueueDatagram(*messageCopy);
             }
+
+            bufferedMessage->GenerateNextTransmissionTime(now, kDataMessageInterval);
+            ScheduleRetransmission(*bufferedMessage);
         }
         else
         {
-            // Update the number of transmission timer expirations.
-            metadata.mTransmissionCount++;
+            mBufferedMessageSet.Dequeue(message);
 
-            if (metadata.mTransmissionCount < GetTimerExpirations())
+            if (bufferedMessage->mTransmissionCount == GetTimerExpirations())
             {
-                Message *messageCopy = message->Clone(message->GetLength() - sizeof(Metadata));
-
-                if (messageCopy != nullptr)
+                if (bufferedMessage->mTransmissionCount > 1)
                 {
-                    if (metadata.mTransmissionCount > 1)
-                    {
-                        messageCopy->SetSubType(Message::kSubTypeMplRetransmission);
-                    }
-
-                    Get<Ip6>().EnqueueDatagram(*messageCopy);
+                    message.SetSubType(Message::kSubTypeMplRetransmission);
                 }
 
-                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
-                metadata.UpdateIn(*message);
-
-                if (nextTime > metadata.mTransmissionTime)
-                {
-                    nextTime = metadata.mTransmissionTime;
-                }
+                Get<Ip6>().EnqueueDatagram(message);
             }
             else
             {
-                mBufferedMessageSet.Dequeue(*message);
-
-                if (metadata.mTransmissionCount == GetTimerExpirations())
-                {
-                    if (metadata.mTransmissionCount > 1)
-                    {
-                        message->SetSubType(Message::kSubTypeMplRetransmission);
-                    }
-
-                    metadata.RemoveFrom(*message);
-                    Get<Ip6>().EnqueueDatagram(*message);
-                }
-                else
-                {
-                    // Stop retransmitting if the number of timer expirations is already exceeded.
-                    message->Free();
-                }
+                // Stop retransmitting if the number of timer expirations is already exceeded.
+                message.Free();
             }
-        }
-    }
 
-    if (nextTime < now.GetDistantFuture())
-    {
-        mRetransmissionTimer.FireAt(nextTime);
+            mBufferedMessagePool.Free(*bufferedMessage);
+        }
     }
 }
 
-void Mpl::Metadata::ReadFrom(const Message &aMessage)
-{
-    uint16_t length = aMessage.GetLength();
-
-    OT_ASSERT(length >= sizeof(*this));
-    IgnoreError(aMessage.Read(length - sizeof(*this), *this));
-}
-
-void Mpl::Metadata::RemoveFrom(Message &aMessage) const
-{
-    Error error = aMessage.SetLength(aMessage.GetLength() - sizeof(*this));
-
-    OT_ASSERT(error == kErrorNone);
-    OT_UNUSED_VARIABLE(error);
-}
-
-void Mpl::Metadata::UpdateIn(Message &aMessage) const
-{
-    aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
-}
-
-void Mpl::Metadata::GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval)
+void Mpl::BufferedMessage::GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval)
 {
     // Emulate Trickle timer behavior and set up the next retransmission within [0,I) range.
     uint8_t t = (aInterval == 0) ? aInterval : Random::NonCrypto::GetUint8InRange(0, aInterval);
@@ -36,9 +36,13 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/ip6.h>
+
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_headers.hpp"
 
@@ -190,6 +194,12 @@ private:
 class Mpl : public InstanceLocator, private NonCopyable
 {
 public:
+    /**
+     * This type represents the MPL counters.
+     *
+     */
+    typedef otIp6MplCounters Counters;
+
     /**
      * This constructor initializes the MPL object.
      *
@@ -249,6 +259,20 @@ public:
      */
     void SetMatchingAddress(const Address &aAddress) { mMatchingAddress = &aAddress; }
 
+    /**
+     * This method returns the MPL counters.
+     *
+     * @returns A reference to the MPL counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the MPL counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
 #if OPENTHREAD_FTD
     /**
      * This method gets the MPL number of Trickle timer expirations that occur before
@@ -281,53 +305,64 @@ private:
     enum
     {
         kNumSeedEntries      = OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES,
+        kNumSeedBuckets      = OPENTHREAD_CONFIG_MPL_SEED_SET_BUCKETS,
         kSeedEntryLifetime   = OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME,
         kSeedEntryLifetimeDt = 1000,
         kDataMessageInterval = 64
     };
 
-    struct SeedEntry
+    struct SeedEntry : public LinkedListEntry<SeedEntry>
     {
-        uint16_t mSeedId;
-        uint8_t  mSequence;
-        uint8_t  mLifetime;
+        SeedEntry *mNext;
+        uint16_t   mSeedId;
+        uint8_t    mSequence;
+        uint8_t    mLifetime;
     };
 
     static void HandleSeedSetTimer(Timer &aTimer);
     void        HandleSeedSetTimer(void);
 
-    Error UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
+    Error                  UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
+    Error                  EvictSeedEntry(uint16_t aSeedId, SeedEntry *&aInsertAfter);
+    LinkedList<SeedEntry> &GetSeedBucket(uint16_t aSeedId);
 
-    SeedEntry      mSeedSet[kNumSeedEntries];
-    const Address *mMatchingAddress;
-    TimerMilli     mSeedSetTimer;
-    uint16_t       mSeedId;
-    uint8_t        mSequence;
+    Pool<SeedEntry, kNumSeedEntries> mSeedEntryPool;
+    LinkedList<SeedEntry>            mSeedSet[kNumSeedBuckets];
+    const Address *                  mMatchingAddress;
+    TimerMilli                       mSeedSetTimer;
+    Counters                         mCounters;
+    uint16_t                         mSeedId;
+    uint8_t                          mSequence;
 
 #if OPENTHREAD_FTD
-    struct Metadata
+    enum
     {
-        Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
-        void  ReadFrom(const Message &aMessage);
-        void  RemoveFrom(Message &aMessage) const;
-        void  UpdateIn(Message &aMessage) const;
-        void  GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval);
-
-        TimeMilli mTransmissionTime;
-        uint16_t  mSeedId;
-        uint8_t   mSequence;
-        uint8_t   mTransmissionCount;
-        uint8_t   mIntervalOffset;
+        kNumBufferedMessages = OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_ENTRIES,
+    };
+
+    struct BufferedMessage : public LinkedListEntry<BufferedMessage>
+    {
+        void GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval);
+
+        BufferedMessage *mNext;
+        Message *        mMessage;
+        TimeMilli        mTransmissionTime;
+        uint8_t          mTransmissionCount;
+        uint8_t          mIntervalOffset;
     };
 
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
-    void AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound);
+    void             AddBufferedMessage(Message &aMessage, bool aIsOutbound);
+    BufferedMessage *EvictBufferedMessage(void);
+    void             ScheduleRetransmission(BufferedMessage &aBufferedMessage);
 
-    MessageQueue mBufferedMessageSet;
-    TimerMilli   mRetransmissionTimer;
-    uint8_t      mTimerExpirations;
+    Pool<BufferedMessage, kNumBufferedMessages> mBufferedMessagePool;
+    LinkedList<BufferedMessage>                 mRetransmissionQueue; // Sorted by `mTransmissionTime`.
+    MessageQueue                                mBufferedMessageSet;
+    TimerMilli                                  mRetransmissionTimer;
+    uint8_t                                     mTimerExpirations;
 #endif // OPENTHREAD_FTD
 };
 
@@ -469,7 +469,13 @@ public:
      * @param[in]  aMessage  A reference to the message.
      *
      */
-    void UpdateIn(Message &aMessage) const { aMessage.Write(aMessage.GetLength() - sizeof(*this), *this); }
+    void UpdateIn(Message &aMessage) const
+    {
+        Error error = aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
+
+        OT_ASSERT(error == kErrorNone);
+        OT_UNUSED_VARIABLE(error);
+    }
 
 private:
     uint32_t              mTransmitTimestamp;   ///< Time at the client when the request departed for the server.
@@ -780,7 +780,7 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
     SuccessOrExit(error = AppendHostDescriptionInstruction(aMessage, info));
 
     header.SetUpdateRecordCount(info.mRecordCount);
-    aMessage.Write(kHeaderOffset, header);
+    SuccessOrExit(error = aMessage.Write(kHeaderOffset, header));
 
     // Prepare Additional Data section
 
@@ -788,7 +788,7 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
     SuccessOrExit(error = AppendSignature(aMessage, info));
 
     header.SetAdditionalRecordCount(2); // Lease OPT and SIG RRs
-    aMessage.Write(kHeaderOffset, header);
+    SuccessOrExit(error = aMessage.Write(kHeaderOffset, header));
 
 exit:
     return error;
@@ -1164,7 +1164,7 @@ void Client::UpdateRecordLengthInMessage(Dns::ResourceRecord &aRecord, uint16_t
     // record.
 
     aRecord.SetLength(aMessage.GetLength() - aOffset - sizeof(Dns::ResourceRecord));
-    aMessage.Write(aOffset, aRecord);
+    IgnoreError(aMessage.Write(aOffset, aRecord));
 }
 
 void Client::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
@@ -90,6 +90,12 @@ Server::Server(Instance &aInstance)
     , mEnabled(false)
     , mHasRegisteredAnyService(false)
 {
+    mHostNameIndex     = nullptr;
+    mServiceNameIndex  = nullptr;
+    mInstanceNameIndex = nullptr;
+    ResetNameIndexes();
+    mLeaseCounters.Clear();
+
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -207,12 +213,247 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
     return (aHost == nullptr) ? mHosts.GetHead() : aHost->GetNext();
 }
 
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+    const Host *host = mHostNameIndex[GetNameIndexBucket(aFullName)];
+
+    while (host != nullptr && !host->Matches(aFullName))
+    {
+        host = host->mNextWithFullName;
+    }
+
+    return host;
+}
+
+Server::Host *Server::FindHost(const char *aFullName)
+{
+    return const_cast<Host *>(const_cast<const Server *>(this)->FindHost(aFullName));
+}
+
+const Server::Service *Server::FindNextServiceWithServiceName(const char *   aServiceName,
+                                                              const Service *aPrevService) const
+{
+    const Service *service = (aPrevService == nullptr) ? mServiceNameIndex[GetNameIndexBucket(aServiceName)]
+                                                       : aPrevService->mNextWithServiceName;
+
+    while (service != nullptr && !service->MatchesServiceName(aServiceName))
+    {
+        service = service->mNextWithServiceName;
+    }
+
+    return service;
+}
+
+const Server::Service *Server::FindNextServiceWithInstanceName(const char *   aInstanceName,
+                                                               const Service *aPrevService) const
+{
+    const Service *service = (aPrevService == nullptr) ? mInstanceNameIndex[GetNameIndexBucket(aInstanceName)]
+                                                       : aPrevService->mNextWithInstanceName;
+
+    while (service != nullptr && !service->MatchesInstanceName(aInstanceName))
+    {
+        service = service->mNextWithInstanceName;
+    }
+
+    return service;
+}
+
+uint32_t Server::HashName(const char *aName)
+{
+    // FNV-1a hash of the name.
+
+    uint32_t hash = 2166136261u;
+
+    for (; *aName != '\0'; aName++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*aName)) * 16777619u;
+    }
+
+    return hash;
+}
+
+template <typename EntryType>
+static bool RemoveFromIndexChain(EntryType *&aHead, EntryType *EntryType::*aNext, const EntryType &aEntry)
+{
+    // Returns false (and does nothing) if `aEntry` is not in the chain.
+
+    bool removed = false;
+
+    for (EntryType **link = &aHead; *link != nullptr; link = &((*link)->*aNext))
+    {
+        if (*link == &aEntry)
+        {
+            *link   = aEntry.*aNext;
+            removed = true;
+            break;
+        }
+    }
+
+    return removed;
+}
+
+template <typename EntryType>
+void Server::MoveIndexChains(EntryType **aFromBuckets,
+                             uint16_t    aNumFromBuckets,
+                             EntryType **aToBuckets,
+                             uint16_t    aNumToBuckets,
+                             EntryType *EntryType::*aNext,
+                             const char *(EntryType::*aGetName)(void) const)
+{
+    // Entries adjacent in a chain are still adjacent (in reverse order)
+    // in the new chains, as adjacent entries with the same name move
+    // to the same new bucket.
+
+    for (uint16_t bucket = 0; bucket < aNumFromBuckets; bucket++)
+    {
+        EntryType *next;
+
+        for (EntryType *entry = aFromBuckets[bucket]; entry != nullptr; entry = next)
+        {
+            EntryType *&head = aToBuckets[HashName((entry->*aGetName)()) % aNumToBuckets];
+
+            next          = entry->*aNext;
+            entry->*aNext = head;
+            head          = entry;
+        }
+    }
+}
+
+// This method adds a registered service to the service name and instance name indexes.
+void Server::AddToNameIndex(Service &aService)
+{
+    Service **link = &mServiceNameIndex[GetNameIndexBucket(aService.GetServiceName())];
+
+    // The services of a host with the same service name are kept next
+    // to each other, so that the DNS-SD server appends the addresses
+    // of the host only once when answering a PTR query.
+
+    for (Service *service = *link; service != nullptr; service = service->mNextWithServiceName)
+    {
+        if (&service->GetHost() == &aService.GetHost() && service->MatchesServiceName(aService.GetServiceName()))
+        {
+            link = &service->mNextWithServiceName;
+            break;
+        }
+    }
+
+    aService.mNextWithServiceName = *link;
+    *link                         = &aService;
+
+    link                           = &mInstanceNameIndex[GetNameIndexBucket(aService.GetInstanceName())];
+    aService.mNextWithInstanceName = *link;
+    *link                          = &aService;
+
+    mNumIndexedServices++;
+
+    if (mNumIndexedServices > kNameIndexMaxLoad * mNumNameIndexBuckets)
+    {
+        GrowNameIndexes();
+    }
+}
+
+// This method removes a service from the name indexes. It does nothing if the service is not indexed (e.g., it
+// belongs to a host which is being processed and has not been added to the server yet).
+void Server::RemoveFromNameIndex(Service &aService)
+{
+    if (RemoveFromIndexChain(mServiceNameIndex[GetNameIndexBucket(aService.GetServiceName())],
+                             &Service::mNextWithServiceName, aService))
+    {
+        mNumIndexedServices--;
+    }
+
+    IgnoreReturnValue(RemoveFromIndexChain(mInstanceNameIndex[GetNameIndexBucket(aService.GetInstanceName())],
+                                           &Service::mNextWithInstanceName, aService));
+}
+
+void Server::GrowNameIndexes(void)
+{
+    // The number of buckets is doubled so that the index chains stay
+    // short as hosts and services are registered. The current indexes
+    // are kept if the buckets cannot be allocated.
+
+    uint16_t  numBuckets = 2 * mNumNameIndexBuckets;
+    Host **   hostNameIndex;
+    Service **serviceNameIndex;
+    Service **instanceNameIndex;
+
+    VerifyOrExit(numBuckets > mNumNameIndexBuckets);
+
+    hostNameIndex = static_cast<Host **>(Instance::HeapCAlloc(numBuckets, sizeof(Host *) + 2 * sizeof(Service *)));
+    VerifyOrExit(hostNameIndex != nullptr);
+
+    serviceNameIndex  = reinterpret_cast<Service **>(hostNameIndex + numBuckets);
+    instanceNameIndex = serviceNameIndex + numBuckets;
+
+    MoveIndexChains(mHostNameIndex, mNumNameIndexBuckets, hostNameIndex, numBuckets, &Host::mNextWithFullName,
+                    &Host::GetFullName);
+    MoveIndexChains(mServiceNameIndex, mNumNameIndexBuckets, serviceNameIndex, numBuckets,
+                    &Service::mNextWithServiceName, &Service::GetServiceName);
+    MoveIndexChains(mInstanceNameIndex, mNumNameIndexBuckets, instanceNameIndex, numBuckets,
+                    &Service::mNextWithInstanceName, &Service::GetInstanceName);
+
+    if (mHostNameIndex != mInitialHostNameIndex)
+    {
+        Instance::HeapFree(mHostNameIndex);
+    }
+
+    mHostNameIndex       = hostNameIndex;
+    mServiceNameIndex    = serviceNameIndex;
+    mInstanceNameIndex   = instanceNameIndex;
+    mNumNameIndexBuckets = numBuckets;
+
+    otLogInfoSrp("[server] grow name indexes to %u buckets", numBuckets);
+
+exit:
+    return;
+}
+
+void Server::ResetNameIndexes(void)
+{
+    // This method switches back to the initial (empty) indexes, and
+    // MUST only be called when no host is registered.
+
+    if ((mHostNameIndex != nullptr) && (mHostNameIndex != mInitialHostNameIndex))
+    {
+        Instance::HeapFree(mHostNameIndex);
+    }
+
+    memset(mInitialHostNameIndex, 0, sizeof(mInitialHostNameIndex));
+    memset(mInitialServiceNameIndex, 0, sizeof(mInitialServiceNameIndex));
+    memset(mInitialInstanceNameIndex, 0, sizeof(mInitialInstanceNameIndex));
+
+    mHostNameIndex       = mInitialHostNameIndex;
+    mServiceNameIndex    = mInitialServiceNameIndex;
+    mInstanceNameIndex   = mInitialInstanceNameIndex;
+    mNumNameIndexBuckets = kNameIndexBuckets;
+    mNumIndexedHosts     = 0;
+    mNumIndexedServices  = 0;
+}
+
 // This method adds a SRP service host and takes ownership of it.
 // The caller MUST make sure that there is no existing host with the same hostname.
 void Server::AddHost(Host &aHost)
 {
-    OT_ASSERT(mHosts.FindMatching(aHost.GetFullName()) == nullptr);
+    Host *&head = mHostNameIndex[GetNameIndexBucket(aHost.GetFullName())];
+
+    OT_ASSERT(FindHost(aHost.GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(aHost));
+
+    aHost.mNextWithFullName = head;
+    head                    = &aHost;
+    mNumIndexedHosts++;
+
+    if (mNumIndexedHosts > kNameIndexMaxLoad * mNumNameIndexBuckets)
+    {
+        GrowNameIndexes();
+    }
+
+    for (Service *service = aHost.mServices.GetHead(); service != nullptr; service = service->GetNext())
+    {
+        AddToNameIndex(*service);
+    }
+
+    UpdateLeaseDeadlines(aHost);
 }
 
 void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandler)
@@ -225,11 +466,33 @@ void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandle
     if (aRetainName)
     {
         otLogInfoSrp("[server] remove host '%s' (but retain its name)", aHost->GetFullName());
+        UpdateLeaseDeadline(*aHost);
     }
     else
     {
         aHost->mKeyLease = 0;
         IgnoreError(mHosts.Remove(*aHost));
+
+        if (RemoveFromIndexChain(mHostNameIndex[GetNameIndexBucket(aHost->GetFullName())],
+                                 &Host::mNextWithFullName, *aHost))
+        {
+            mNumIndexedHosts--;
+        }
+
+        RemoveFromLeaseHeap(*aHost);
+
+        for (Service *service = aHost->mServices.GetHead(); service != nullptr; service = service->GetNext())
+        {
+            RemoveFromNameIndex(*service);
+            RemoveFromLeaseHeap(*service);
+        }
+
+        if (mNumIndexedHosts == 0)
+        {
+            // Release the grown indexes once the last host is removed.
+            ResetNameIndexes();
+        }
+
         otLogInfoSrp("[server] fully remove host '%s'", aHost->GetFullName());
     }
 
@@ -255,7 +518,7 @@ exit:
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && *aHost.GetKey() != *existingHost->GetKey())
     {
@@ -265,16 +528,13 @@ bool Server::HasNameConflictsWith(Host &aHost) const
     for (const Service::Description *desc = aHost.mServiceDescriptions.GetHead(); desc != nullptr;
          desc                             = desc->GetNext())
     {
-        // Check on all hosts for a matching service description with
-        // the same instance name and if found, verify that it has the
-        // same key.
+        // Check on all registered services with the same instance
+        // name and if found, verify that their host has the same key.
 
-        for (const Host *host = mHosts.GetHead(); host != nullptr; host = host->GetNext())
+        for (const Service *service = FindNextServiceWithInstanceName(desc->GetInstanceName(), nullptr);
+             service != nullptr; service = FindNextServiceWithInstanceName(desc->GetInstanceName(), service))
         {
-            if (host->FindServiceDescription(desc->GetInstanceName()) != nullptr)
-            {
-                VerifyOrExit(*aHost.GetKey() == *host->GetKey(), hasConflicts = true);
-            }
+            VerifyOrExit(*aHost.GetKey() == *service->GetHost().GetKey(), hasConflicts = true);
         }
     }
 
@@ -339,7 +599,7 @@ void Server::CommitSrpUpdate(Error                    aError,
         desc->mKeyLease = grantedKeyLease;
     }
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -1004,7 +1264,7 @@ void Server::HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host &aHost, cons
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1174,116 +1434,149 @@ void Server::HandleLeaseTimer(Timer &aTimer)
 
 void Server::HandleLeaseTimer(void)
 {
-    TimeMilli now                = TimerMilli::GetNow();
-    TimeMilli earliestExpireTime = now.GetDistantFuture();
-    Host *    nextHost;
+    TimeMilli   now = TimerMilli::GetNow();
+    LeaseEntry *entry;
 
-    for (Host *host = mHosts.GetHead(); host != nullptr; host = nextHost)
-    {
-        nextHost = host->GetNext();
+    // Only the hosts and services whose LEASE or KEY-LEASE expired are
+    // processed. Each one is either removed from the lease heap or is
+    // re-inserted with a later deadline (its KEY-LEASE expiry).
 
-        if (host->GetKeyExpireTime() <= now)
+    while ((entry = mLeaseHeap.GetTop()) != nullptr && entry->mLeaseDeadline <= now)
+    {
+        if (entry->mIsHost)
         {
-            otLogInfoSrp("[server] KEY LEASE of host %s expired", host->GetFullName());
-
-            // Removes the whole host and all services if the KEY RR expired.
-            RemoveHost(host, /* aRetainName */ false, /* aNotifyServiceHandler */ true);
+            HandleHostLeaseExpiry(static_cast<Host &>(*entry), now);
         }
-        else if (host->IsDeleted())
+        else
         {
-            // The host has been deleted, but the hostname & service instance names retain.
+            HandleServiceLeaseExpiry(static_cast<Service &>(*entry), now);
+        }
+    }
 
-            Service *next;
+    if (entry != nullptr)
+    {
+        otLogInfoSrp("[server] lease timer is scheduled for %u seconds", Time::MsecToSec(entry->mLeaseDeadline - now));
+        mLeaseTimer.StartAt(entry->mLeaseDeadline, 0);
+    }
+    else
+    {
+        otLogInfoSrp("[server] lease timer is stopped");
+        mLeaseTimer.Stop();
+    }
+}
 
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetKeyExpireTime());
+void Server::HandleHostLeaseExpiry(Host &aHost, TimeMilli aNow)
+{
+    if (aHost.GetKeyExpireTime() <= aNow)
+    {
+        otLogInfoSrp("[server] KEY LEASE of host %s expired", aHost.GetFullName());
+        mLeaseCounters.mHostKeyLeaseExpirations++;
 
-            // Check if any service instance name expired.
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
-            {
-                next = service->GetNext();
-
-                OT_ASSERT(service->mIsDeleted);
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, /* aRetainName */ false, /* aNotifyServiceHandler */ true);
-                }
-                else
-                {
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-            }
-        }
-        else if (host->GetExpireTime() <= now)
+        // Removes the whole host and all services if the KEY RR expired.
+        RemoveHost(&aHost, /* aRetainName */ false, /* aNotifyServiceHandler */ true);
+    }
+    else
+    {
+        OT_ASSERT(!aHost.IsDeleted() && aHost.GetExpireTime() <= aNow);
+
+        otLogInfoSrp("[server] LEASE of host %s expired", aHost.GetFullName());
+        mLeaseCounters.mHostLeaseExpirations++;
+
+        // If the host expired, delete all resources of this host and its services.
+        for (Service *service = aHost.mServices.GetHead(); service != nullptr; service = service->GetNext())
         {
-            otLogInfoSrp("[server] LEASE of host %s expired", host->GetFullName());
+            // Don't need to notify the service handler as `RemoveHost` at below will do.
+            aHost.RemoveService(service, /* aRetainName */ true, /* aNotifyServiceHandler */ false);
+        }
 
-            // If the host expired, delete all resources of this host and its services.
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = service->GetNext())
-            {
-                // Don't need to notify the service handler as `RemoveHost` at below will do.
-                host->RemoveService(service, /* aRetainName */ true, /* aNotifyServiceHandler */ false);
-            }
+        RemoveHost(&aHost, /* aRetainName */ true, /* aNotifyServiceHandler */ true);
+    }
+}
 
-            RemoveHost(host, /* aRetainName */ true, /* aNotifyServiceHandler */ true);
+void Server::HandleServiceLeaseExpiry(Service &aService, TimeMilli aNow)
+{
+    Host &host = aService.mDescription.mHost;
 
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetKeyExpireTime());
-        }
-        else
-        {
-            // The host doesn't expire, check if any service expired or is explicitly removed.
+    // If the host lease (or key lease) also expired, the host is
+    // processed first which then takes care of all its services.
 
-            Service *next;
+    if (host.mLeaseDeadline <= aNow)
+    {
+        HandleHostLeaseExpiry(host, aNow);
+        ExitNow();
+    }
 
-            OT_ASSERT(!host->IsDeleted());
+    if (aService.GetKeyExpireTime() <= aNow)
+    {
+        aService.Log(Service::kKeyLeaseExpired);
+        mLeaseCounters.mServiceKeyLeaseExpirations++;
+        host.RemoveService(&aService, /* aRetainName */ false, /* aNotifyServiceHandler */ true);
+    }
+    else
+    {
+        OT_ASSERT(!aService.IsDeleted());
 
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetExpireTime());
+        aService.Log(Service::kLeaseExpired);
+        mLeaseCounters.mServiceLeaseExpirations++;
 
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
-            {
-                next = service->GetNext();
-
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, /* aRetainName */ false, /* aNotifyServiceHandler */ true);
-                }
-                else if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= now)
-                {
-                    service->Log(Service::kLeaseExpired);
-
-                    // The service is expired, delete it.
-                    host->RemoveService(service, /* aRetainName */ true, /* aNotifyServiceHandler */ true);
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else
-                {
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetExpireTime());
-                }
-            }
-        }
+        // The service is expired, delete it but retain its name.
+        host.RemoveService(&aService, /* aRetainName */ true, /* aNotifyServiceHandler */ true);
+    }
+
+exit:
+    return;
+}
+
+void Server::UpdateLeaseDeadlines(Host &aHost)
+{
+    UpdateLeaseDeadline(aHost);
+
+    for (Service *service = aHost.mServices.GetHead(); service != nullptr; service = service->GetNext())
+    {
+        UpdateLeaseDeadline(*service);
     }
+}
+
+void Server::UpdateLeaseDeadline(LeaseEntry &aEntry)
+{
+    // This method (re-)inserts a host or a service in the lease heap
+    // with the time its LEASE (or KEY-LEASE, if deleted) expires.
+
+    RemoveFromLeaseHeap(aEntry);
 
-    if (earliestExpireTime != now.GetDistantFuture())
+    if (aEntry.mIsHost)
     {
-        OT_ASSERT(earliestExpireTime >= now);
-        if (!mLeaseTimer.IsRunning() || earliestExpireTime <= mLeaseTimer.GetFireTime())
+        const Host &host = static_cast<const Host &>(aEntry);
+
+        aEntry.mLeaseDeadline = host.GetKeyExpireTime();
+
+        if (!host.IsDeleted())
         {
-            otLogInfoSrp("[server] lease timer is scheduled for %u seconds", Time::MsecToSec(earliestExpireTime - now));
-            mLeaseTimer.StartAt(earliestExpireTime, 0);
+            aEntry.mLeaseDeadline = OT_MIN(aEntry.mLeaseDeadline, host.GetExpireTime());
         }
     }
     else
     {
-        otLogInfoSrp("[server] lease timer is stopped");
-        mLeaseTimer.Stop();
+        const Service &service = static_cast<const Service &>(aEntry);
+
+        aEntry.mLeaseDeadline = service.GetKeyExpireTime();
+
+        if (!service.IsDeleted() && !service.GetHost().IsDeleted())
+        {
+            aEntry.mLeaseDeadline = OT_MIN(aEntry.mLeaseDeadline, service.GetExpireTime());
+        }
     }
+
+    mLeaseHeap.Add(aEntry);
+}
+
+void Server::RemoveFromLeaseHeap(LeaseEntry &aEntry)
+{
+    VerifyOrExit(mLeaseHeap.Contains(aEntry));
+    mLeaseHeap.Remove(aEntry);
+
+exit:
+    return;
 }
 
 void Server::HandleOutstandingUpdatesTimer(Timer &aTimer)
@@ -1329,8 +1622,11 @@ void Server::Service::Free(void)
 }
 
 Server::Service::Service(Description &aDescription, bool aIsSubType)
-    : mDescription(aDescription)
+    : LeaseEntry(/* aIsHost */ false)
+    , mDescription(aDescription)
     , mNext(nullptr)
+    , mNextWithServiceName(nullptr)
+    , mNextWithInstanceName(nullptr)
     , mTimeLastUpdate(TimerMilli::GetNow())
     , mIsDeleted(false)
     , mIsSubType(aIsSubType)
@@ -1568,9 +1864,11 @@ void Server::Host::Free(void)
 }
 
 Server::Host::Host(Instance &aInstance)
-    : InstanceLocator(aInstance)
+    : LeaseEntry(/* aIsHost */ true)
+    , InstanceLocator(aInstance)
     , mAddressesNum(0)
     , mNext(nullptr)
+    , mNextWithFullName(nullptr)
     , mLease(0)
     , mKeyLease(0)
     , mTimeLastUpdate(TimerMilli::GetNow())
@@ -1694,9 +1992,15 @@ void Server::Host::RemoveService(Service *aService, bool aRetainName, bool aNoti
     if (!aRetainName)
     {
         IgnoreError(mServices.Remove(*aService));
+        server.RemoveFromNameIndex(*aService);
+        server.RemoveFromLeaseHeap(*aService);
         aService->Free();
         FreeUnusedServiceDescriptions();
     }
+    else if (server.mLeaseHeap.Contains(*aService))
+    {
+        server.UpdateLeaseDeadline(*aService);
+    }
 
 exit:
     return;
@@ -1778,6 +2082,11 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
 
         VerifyOrExit(newService != nullptr, error = kErrorNoBufs);
 
+        if (existingService == nullptr)
+        {
+            Get<Server>().AddToNameIndex(*newService);
+        }
+
         newService->mIsDeleted      = false;
         newService->mIsCommitted    = true;
         newService->mTimeLastUpdate = TimerMilli::GetNow();
@@ -1787,6 +2096,9 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
     }
 
 exit:
+    // The service descriptions (and their leases) may be shared by
+    // services not included in `aHost`, so all services are updated.
+    Get<Server>().UpdateLeaseDeadlines(*this);
     return error;
 }
 
@@ -55,6 +55,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/pairing_heap.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
 #include "net/dns_types.hpp"
@@ -75,6 +76,7 @@ class Server : public InstanceLocator, private NonCopyable
     friend class UpdateMetadata;
     friend class Service;
     friend class Host;
+    friend class SrpServerTester;
 
 public:
     enum : uint16_t
@@ -93,15 +95,45 @@ public:
 
     class Host;
 
+    /**
+     * This class represents a host or a service in the lease expiry heap of the SRP server.
+     *
+     * The heap is ordered by the time the next LEASE or KEY-LEASE of the entry expires, so that the lease timer only
+     * processes the hosts and services whose leases have expired.
+     *
+     */
+    class LeaseEntry
+    {
+        friend class Server;
+        template <typename, typename> friend class ot::PairingHeap;
+
+    protected:
+        explicit LeaseEntry(bool aIsHost)
+            : mHeapChild(nullptr)
+            , mHeapNext(nullptr)
+            , mHeapPrev(nullptr)
+            , mIsHost(aIsHost)
+        {
+        }
+
+    private:
+        TimeMilli   mLeaseDeadline;
+        LeaseEntry *mHeapChild;
+        LeaseEntry *mHeapNext;
+        LeaseEntry *mHeapPrev;
+        bool        mIsHost;
+    };
+
     /**
      * This class implements a server-side SRP service.
      *
      */
-    class Service : public LinkedListEntry<Service>, private NonCopyable
+    class Service : public LinkedListEntry<Service>, public LeaseEntry, private NonCopyable
     {
         friend class Server;
         friend class LinkedList<Service>;
         friend class LinkedListEntry<Service>;
+        friend class SrpServerTester;
 
     public:
         /**
@@ -313,6 +345,8 @@ public:
         HeapString   mServiceName;
         Description &mDescription;
         Service *    mNext;
+        Service *    mNextWithServiceName;  // The next service in the same service name index bucket.
+        Service *    mNextWithInstanceName; // The next service in the same instance name index bucket.
         TimeMilli    mTimeLastUpdate;
         bool         mIsDeleted : 1;
         bool         mIsSubType : 1;
@@ -323,10 +357,11 @@ public:
      * This class implements the Host which registers services on the SRP server.
      *
      */
-    class Host : public LinkedListEntry<Host>, public InstanceLocator, private NonCopyable
+    class Host : public LinkedListEntry<Host>, public LeaseEntry, public InstanceLocator, private NonCopyable
     {
         friend class LinkedListEntry<Host>;
         friend class Server;
+        friend class SrpServerTester;
 
     public:
         /**
@@ -468,6 +503,7 @@ public:
         Ip6::Address mAddresses[kMaxAddressesNum];
         uint8_t      mAddressesNum;
         Host *       mNext;
+        Host *       mNextWithFullName; // The next host in the same host name index bucket.
 
         Dns::Ecdsa256KeyRecord           mKey;
         uint32_t                         mLease;    // The LEASE time in seconds.
@@ -477,6 +513,14 @@ public:
         LinkedList<Service::Description> mServiceDescriptions;
     };
 
+    /**
+     * This class represents the SRP server lease processing counters.
+     *
+     */
+    class LeaseCounters : public otSrpServerLeaseCounters, public Clearable<LeaseCounters>
+    {
+    };
+
     /**
      * This class handles LEASE and KEY-LEASE configurations.
      *
@@ -616,6 +660,20 @@ public:
      */
     Error SetLeaseConfig(const LeaseConfig &aLeaseConfig);
 
+    /**
+     * This method returns the SRP server lease processing counters.
+     *
+     * @returns  A reference to the lease counters.
+     *
+     */
+    const LeaseCounters &GetLeaseCounters(void) const { return mLeaseCounters; }
+
+    /**
+     * This method resets the SRP server lease processing counters.
+     *
+     */
+    void ResetLeaseCounters(void) { mLeaseCounters.Clear(); }
+
     /**
      * This method returns the next registered SRP host.
      *
@@ -626,6 +684,59 @@ public:
      */
     const Host *GetNextHost(const Host *aHost);
 
+    /**
+     * This method finds a registered SRP host by its full name.
+     *
+     * The host may be deleted (i.e., it only retains its name).
+     *
+     * @param[in]  aFullName  The full host name.
+     *
+     * @returns  A pointer to the host or nullptr if no registered host has @p aFullName.
+     *
+     */
+    const Host *FindHost(const char *aFullName) const;
+
+    /**
+     * This method finds a registered SRP host by its full name.
+     *
+     * The host may be deleted (i.e., it only retains its name).
+     *
+     * @param[in]  aFullName  The full host name.
+     *
+     * @returns  A pointer to the host or nullptr if no registered host has @p aFullName.
+     *
+     */
+    Host *FindHost(const char *aFullName);
+
+    /**
+     * This method finds the next registered SRP service with a given full service name.
+     *
+     * The services are found through an index and are not returned in any particular order. Deleted services (and
+     * services of deleted hosts) are also returned.
+     *
+     * @param[in]  aServiceName  The full service name.
+     * @param[in]  aPrevService  The previous service returned by this method, or nullptr to get the first one.
+     *
+     * @returns  A pointer to the next service matching @p aServiceName or nullptr if there is none.
+     *
+     */
+    const Service *FindNextServiceWithServiceName(const char *aServiceName, const Service *aPrevService) const;
+
+    /**
+     * This method finds the next registered SRP service with a given full service instance name.
+     *
+     * The base and all the sub-type services of an instance share its instance name. The services are found through
+     * an index and are not returned in any particular order. Deleted services (and services of deleted hosts) are
+     * also returned.
+     *
+     * @param[in]  aInstanceName  The full service instance name.
+     * @param[in]  aPrevService   The previous service returned by this method, or nullptr to get the first one.
+     *
+     * @returns  A pointer to the next service matching @p aInstanceName or nullptr if there is none.
+     *
+     */
+    const Service *FindNextServiceWithInstanceName(const char *aInstanceName, const Service *aPrevService) const;
+
     /**
      * This method receives the service update result from service handler set by
      * SetServiceHandler.
@@ -642,6 +753,12 @@ private:
         kUdpPayloadSize = Ip6::Ip6::kMaxDatagramLength - sizeof(Ip6::Udp::Header), // Max UDP payload size
     };
 
+    enum : uint16_t
+    {
+        kNameIndexBuckets = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS, // Initial number of index buckets.
+        kNameIndexMaxLoad = 2,                                               // Max average entries per bucket.
+    };
+
     enum : uint32_t
     {
         kDefaultMinLease             = 60u * 30,        // Default minimum lease time, 30 min (in seconds).
@@ -651,6 +768,17 @@ private:
         kDefaultEventsHandlerTimeout = OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT,
     };
 
+    class LeaseDeadlineCompare
+    {
+    public:
+        bool operator()(const LeaseEntry &aFirst, const LeaseEntry &aSecond) const
+        {
+            return aFirst.mLeaseDeadline < aSecond.mLeaseDeadline;
+        }
+    };
+
+    typedef PairingHeap<LeaseEntry, LeaseDeadlineCompare> LeaseHeap;
+
     // This class includes metadata for processing a SRP update (register, deregister)
     // and sending DNS response to the client.
     class UpdateMetadata : public InstanceLocator, public LinkedListEntry<UpdateMetadata>
@@ -736,11 +864,32 @@ private:
                                                 const Dns::Zone &        aZone,
                                                 uint16_t &               aOffset) const;
 
-    static bool IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
+    static bool     IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
+    static uint32_t HashName(const char *aName);
+    uint16_t        GetNameIndexBucket(const char *aName) const
+    {
+        return static_cast<uint16_t>(HashName(aName) % mNumNameIndexBuckets);
+    }
 
     void        HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host &aHost, const Ip6::MessageInfo &aMessageInfo);
     void        AddHost(Host &aHost);
     void        RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandler);
+    void        AddToNameIndex(Service &aService);
+    void        RemoveFromNameIndex(Service &aService);
+    void        GrowNameIndexes(void);
+    void        ResetNameIndexes(void);
+    template <typename EntryType>
+    static void MoveIndexChains(EntryType **aFromBuckets,
+                                uint16_t    aNumFromBuckets,
+                                EntryType **aToBuckets,
+                                uint16_t    aNumToBuckets,
+                                EntryType *EntryType::*aNext,
+                                const char *(EntryType::*aGetName)(void) const);
+    void        UpdateLeaseDeadline(LeaseEntry &aEntry);
+    void        UpdateLeaseDeadlines(Host &aHost);
+    void        RemoveFromLeaseHeap(LeaseEntry &aEntry);
+    void        HandleHostLeaseExpiry(Host &aHost, TimeMilli aNow);
+    void        HandleServiceLeaseExpiry(Service &aService, TimeMilli aNow);
     bool        HasNameConflictsWith(Host &aHost) const;
     void        SendResponse(const Dns::UpdateHeader &   aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
@@ -769,6 +918,20 @@ private:
 
     LinkedList<Host> mHosts;
     TimerMilli       mLeaseTimer;
+    LeaseHeap        mLeaseHeap;
+    LeaseCounters    mLeaseCounters;
+
+    // The name indexes use the arrays below until they grow, and then
+    // buckets allocated (together, in this order) from the heap.
+    Host **   mHostNameIndex;
+    Service **mServiceNameIndex;
+    Service **mInstanceNameIndex;
+    uint16_t  mNumNameIndexBuckets;
+    uint16_t  mNumIndexedHosts;
+    uint16_t  mNumIndexedServices;
+    Host *    mInitialHostNameIndex[kNameIndexBuckets];
+    Service * mInitialServiceNameIndex[kNameIndexBuckets];
+    Service * mInitialInstanceNameIndex[kNameIndexBuckets];
 
     TimerMilli                 mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -582,6 +582,80 @@ public:
      */
     void ClearSrcMatchExtEntries(void);
 
+    /**
+     * This method adds a list of short addresses to the source address match table.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses to be added.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     *
+     * @retval kErrorNone     Successfully added all the short addresses to the source match table.
+     * @retval kErrorNoBufs   No available entry in the source match table.
+     *
+     */
+    Error AddSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method adds a list of extended addresses to the source address match table.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be added stored in little-endian byte
+     *                            order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     *
+     * @retval kErrorNone     Successfully added all the extended addresses to the source match table.
+     * @retval kErrorNoBufs   No available entry in the source match table.
+     *
+     */
+    Error AddSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method removes a list of short addresses from the source address match table.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses to be removed.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     *
+     * @retval kErrorNone       Successfully removed all the short addresses from the source match table.
+     * @retval kErrorNoAddress  At least one of the short addresses is not in source address match table.
+     *
+     */
+    Error RemoveSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method removes a list of extended addresses from the source address match table.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be removed stored in little-endian
+     *                            byte order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     *
+     * @retval kErrorNone       Successfully removed all the extended addresses from the source match table.
+     * @retval kErrorNoAddress  At least one of the extended addresses is not in source address match table.
+     *
+     */
+    Error RemoveSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method replaces all the short addresses in the source address match table with a given list.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     *
+     * @retval kErrorNone     Successfully replaced the short addresses in the source match table.
+     * @retval kErrorNoBufs   No available entry in the source match table.
+     *
+     */
+    Error SetSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method replaces all the extended addresses in the source address match table with a given list.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses stored in little-endian byte order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     *
+     * @retval kErrorNone     Successfully replaced the extended addresses in the source match table.
+     * @retval kErrorNoBufs   No available entry in the source match table.
+     *
+     */
+    Error SetSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries);
+
     /**
      * This method gets the radio supported channel mask that the device is allowed to be on.
      *
@@ -832,6 +906,36 @@ inline void Radio::ClearSrcMatchExtEntries(void)
     otPlatRadioClearSrcMatchExtEntries(GetInstancePtr());
 }
 
+inline Error Radio::AddSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioAddSrcMatchShortEntries(GetInstancePtr(), aShortAddresses, aNumEntries);
+}
+
+inline Error Radio::AddSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioAddSrcMatchExtEntries(GetInstancePtr(), aExtAddresses, aNumEntries);
+}
+
+inline Error Radio::RemoveSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioRemoveSrcMatchShortEntries(GetInstancePtr(), aShortAddresses, aNumEntries);
+}
+
+inline Error Radio::RemoveSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioRemoveSrcMatchExtEntries(GetInstancePtr(), aExtAddresses, aNumEntries);
+}
+
+inline Error Radio::SetSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioSetSrcMatchShortEntries(GetInstancePtr(), aShortAddresses, aNumEntries);
+}
+
+inline Error Radio::SetSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    return otPlatRadioSetSrcMatchExtEntries(GetInstancePtr(), aExtAddresses, aNumEntries);
+}
+
 #else //----------------------------------------------------------------------------------------------------------------
 
 inline otRadioCaps Radio::GetCaps(void)
@@ -992,6 +1096,36 @@ inline void Radio::ClearSrcMatchExtEntries(void)
 {
 }
 
+inline Error Radio::AddSrcMatchShortEntries(const Mac::ShortAddress *, uint16_t)
+{
+    return kErrorNone;
+}
+
+inline Error Radio::AddSrcMatchExtEntries(const Mac::ExtAddress *, uint16_t)
+{
+    return kErrorNone;
+}
+
+inline Error Radio::RemoveSrcMatchShortEntries(const Mac::ShortAddress *, uint16_t)
+{
+    return kErrorNone;
+}
+
+inline Error Radio::RemoveSrcMatchExtEntries(const Mac::ExtAddress *, uint16_t)
+{
+    return kErrorNone;
+}
+
+inline Error Radio::SetSrcMatchShortEntries(const Mac::ShortAddress *, uint16_t)
+{
+    return kErrorNone;
+}
+
+inline Error Radio::SetSrcMatchExtEntries(const Mac::ExtAddress *, uint16_t)
+{
+    return kErrorNone;
+}
+
 #endif // #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
 
 } // namespace ot
@@ -299,3 +299,89 @@ OT_TOOL_WEAK Error otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChannel,
 
     return kErrorNotImplemented;
 }
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+
+OT_TOOL_WEAK Error otPlatRadioAddSrcMatchShortEntries(otInstance *          aInstance,
+                                                      const otShortAddress *aShortAddresses,
+                                                      uint16_t              aNumEntries)
+{
+    Error error = kErrorNone;
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchShortEntry(aInstance, aShortAddresses[i]));
+    }
+
+exit:
+    return error;
+}
+
+OT_TOOL_WEAK Error otPlatRadioAddSrcMatchExtEntries(otInstance *        aInstance,
+                                                    const otExtAddress *aExtAddresses,
+                                                    uint16_t            aNumEntries)
+{
+    Error error = kErrorNone;
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchExtEntry(aInstance, &aExtAddresses[i]));
+    }
+
+exit:
+    return error;
+}
+
+OT_TOOL_WEAK Error otPlatRadioRemoveSrcMatchShortEntries(otInstance *          aInstance,
+                                                         const otShortAddress *aShortAddresses,
+                                                         uint16_t              aNumEntries)
+{
+    Error error = kErrorNone;
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        if (otPlatRadioClearSrcMatchShortEntry(aInstance, aShortAddresses[i]) != kErrorNone)
+        {
+            error = kErrorNoAddress;
+        }
+    }
+
+    return error;
+}
+
+OT_TOOL_WEAK Error otPlatRadioRemoveSrcMatchExtEntries(otInstance *        aInstance,
+                                                       const otExtAddress *aExtAddresses,
+                                                       uint16_t            aNumEntries)
+{
+    Error error = kErrorNone;
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        if (otPlatRadioClearSrcMatchExtEntry(aInstance, &aExtAddresses[i]) != kErrorNone)
+        {
+            error = kErrorNoAddress;
+        }
+    }
+
+    return error;
+}
+
+OT_TOOL_WEAK Error otPlatRadioSetSrcMatchShortEntries(otInstance *          aInstance,
+                                                      const otShortAddress *aShortAddresses,
+                                                      uint16_t              aNumEntries)
+{
+    otPlatRadioClearSrcMatchShortEntries(aInstance);
+
+    return otPlatRadioAddSrcMatchShortEntries(aInstance, aShortAddresses, aNumEntries);
+}
+
+OT_TOOL_WEAK Error otPlatRadioSetSrcMatchExtEntries(otInstance *        aInstance,
+                                                    const otExtAddress *aExtAddresses,
+                                                    uint16_t            aNumEntries)
+{
+    otPlatRadioClearSrcMatchExtEntries(aInstance);
+
+    return otPlatRadioAddSrcMatchExtEntries(aInstance, aExtAddresses, aNumEntries);
+}
+
+#endif // OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
@@ -57,8 +57,14 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mAddressQuery(UriPath::kAddressQuery, &AddressResolver::HandleAddressQuery, this)
     , mAddressNotification(UriPath::kAddressNotify, &AddressResolver::HandleAddressNotification, this)
     , mCacheEntryPool(aInstance)
+    , mCachedList(kCachedListId)
+    , mSnoopedList(kSnoopedListId)
+    , mQueryList(kQueryListId)
+    , mQueryRetryList(kQueryRetryListId)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 {
+    ClearCacheIndex();
+
     Get<Tmf::Agent>().AddResource(mAddressError);
     Get<Tmf::Agent>().AddResource(mAddressQuery);
     Get<Tmf::Agent>().AddResource(mAddressNotification);
@@ -84,6 +90,8 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    ClearCacheIndex();
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -176,57 +184,144 @@ void AddressResolver::Remove(uint16_t aRloc16)
     Remove(aRloc16, /* aMatchRouterId */ false);
 }
 
-AddressResolver::CacheEntry *AddressResolver::GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList)
-{
-    return (aPrev == nullptr) ? aList.GetHead() : aPrev->GetNext();
-}
-
 void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
 {
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList};
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev = nullptr;
-        CacheEntry *entry;
+        CacheEntry *next;
 
-        while ((entry = GetEntryAfter(prev, *list)) != nullptr)
+        for (CacheEntry *entry = list->GetHead(); entry != nullptr; entry = next)
         {
+            next = entry->GetNext();
+
             if ((aMatchRouterId && Mle::Mle::RouterIdMatch(entry->GetRloc16(), aRloc16)) ||
                 (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
             {
-                RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
+                RemoveCacheEntry(*entry, *list, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
                 mCacheEntryPool.Free(*entry);
-
-                // If the entry is removed from list, we keep the same
-                // `prev` pointer.
-            }
-            else
-            {
-                prev = entry;
             }
         }
     }
 }
 
-AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid,
-                                                             CacheEntryList *&   aList,
-                                                             CacheEntry *&       aPrevEntry)
+AddressResolver::CacheEntryList &AddressResolver::GetList(ListId aListId)
 {
-    CacheEntry *    entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    CacheEntryList *list = &mCachedList;
 
-    for (CacheEntryList *list : lists)
+    switch (aListId)
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+    case kCachedListId:
+        break;
+    case kSnoopedListId:
+        list = &mSnoopedList;
+        break;
+    case kQueryListId:
+        list = &mQueryList;
+        break;
+    case kQueryRetryListId:
+        list = &mQueryRetryList;
+        break;
+    }
+
+    return *list;
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList)
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint16_t slot = GetCacheIndexSlot(aEid); mCacheIndex[slot] != kInvalidIndex;
+         slot          = GetNextCacheIndexSlot(slot))
+    {
+        CacheEntry &indexed = mCacheEntryPool.GetEntryAt(mCacheIndex[slot]);
+
+        if (indexed.Matches(aEid))
+        {
+            entry = &indexed;
+            aList = &GetList(entry->GetListId());
+            break;
+        }
     }
 
-exit:
     return entry;
 }
 
+uint16_t AddressResolver::GetCacheIndexSlot(const Ip6::Address &aEid)
+{
+    // The hash is derived from the IID, since the EIDs in the cache
+    // mostly share the same prefix.
+
+    const uint8_t *bytes = aEid.GetIid().mFields.m8;
+    uint32_t       hash  = 2166136261UL; // FNV-1a offset basis
+
+    for (uint8_t i = 0; i < sizeof(Ip6::InterfaceIdentifier); i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619UL; // FNV-1a prime
+    }
+
+    return static_cast<uint16_t>(hash % kCacheIndexSize);
+}
+
+void AddressResolver::ClearCacheIndex(void)
+{
+    for (uint16_t &index : mCacheIndex)
+    {
+        index = kInvalidIndex;
+    }
+}
+
+void AddressResolver::AddToCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t slot = GetCacheIndexSlot(aEntry.GetTarget());
+
+    // The index has more slots than the cache entries so an unused
+    // slot is always found.
+
+    while (mCacheIndex[slot] != kInvalidIndex)
+    {
+        slot = GetNextCacheIndexSlot(slot);
+    }
+
+    mCacheIndex[slot] = mCacheEntryPool.GetIndexOf(aEntry);
+}
+
+void AddressResolver::RemoveFromCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t index = mCacheEntryPool.GetIndexOf(aEntry);
+    uint16_t slot  = GetCacheIndexSlot(aEntry.GetTarget());
+    uint16_t next;
+
+    while (mCacheIndex[slot] != index)
+    {
+        VerifyOrExit(mCacheIndex[slot] != kInvalidIndex);
+        slot = GetNextCacheIndexSlot(slot);
+    }
+
+    mCacheIndex[slot] = kInvalidIndex;
+
+    // Shift back the following entries in the same probe sequence
+    // (linear probing deletion without tombstones). An entry can move
+    // into the freed `slot` if its home slot is not cyclically within
+    // (`slot`, `next`].
+
+    for (next = GetNextCacheIndexSlot(slot); mCacheIndex[next] != kInvalidIndex; next = GetNextCacheIndexSlot(next))
+    {
+        uint16_t home = GetCacheIndexSlot(mCacheEntryPool.GetEntryAt(mCacheIndex[next]).GetTarget());
+
+        if (((next + kCacheIndexSize - home) % kCacheIndexSize) >= ((next + kCacheIndexSize - slot) % kCacheIndexSize))
+        {
+            mCacheIndex[slot] = mCacheIndex[next];
+            mCacheIndex[next] = kInvalidIndex;
+            slot              = next;
+        }
+    }
+
+exit:
+    return;
+}
+
 void AddressResolver::Remove(const Ip6::Address &aEid)
 {
     Remove(aEid, kReasonRemovingEid);
@@ -235,13 +330,12 @@ void AddressResolver::Remove(const Ip6::Address &aEid)
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
 {
     CacheEntry *    entry;
-    CacheEntry *    prev;
     CacheEntryList *list;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
     VerifyOrExit(entry != nullptr);
 
-    RemoveCacheEntry(*entry, *list, prev, aReason);
+    RemoveCacheEntry(*entry, *list, aReason);
     mCacheEntryPool.Free(*entry);
 
 exit:
@@ -250,9 +344,8 @@ exit:
 
 AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
 {
-    CacheEntry *    newEntry  = nullptr;
-    CacheEntry *    prevEntry = nullptr;
-    CacheEntryList *lists[]   = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
+    CacheEntry *    newEntry = nullptr;
+    CacheEntryList *lists[]  = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
 
     // The following order is used when trying to allocate a new cache
     // entry: First the cache pool is checked, followed by the list
@@ -270,11 +363,11 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev;
-        CacheEntry *entry;
-        uint16_t    numNonEvictable = 0;
+        uint16_t numNonEvictable = 0;
+
+        // Search backward from the tail for the oldest evictable entry.
 
-        for (prev = nullptr; (entry = GetEntryAfter(prev, *list)) != nullptr; prev = entry)
+        for (CacheEntry *entry = list->GetTail(); entry != nullptr; entry = entry->GetPrev())
         {
             if ((list != &mCachedList) && !entry->CanEvict())
             {
@@ -282,13 +375,13 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
                 continue;
             }
 
-            newEntry  = entry;
-            prevEntry = prev;
+            newEntry = entry;
+            break;
         }
 
         if (newEntry != nullptr)
         {
-            RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            RemoveCacheEntry(*newEntry, *list, kReasonEvictingForNewEntry);
             ExitNow();
         }
 
@@ -314,12 +407,10 @@ exit:
     return newEntry;
 }
 
-void AddressResolver::RemoveCacheEntry(CacheEntry &    aEntry,
-                                       CacheEntryList &aList,
-                                       CacheEntry *    aPrevEntry,
-                                       Reason          aReason)
+void AddressResolver::RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, Reason aReason)
 {
-    aList.PopAfter(aPrevEntry);
+    aList.Remove(aEntry);
+    RemoveFromCacheIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -338,9 +429,8 @@ Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddr
     Error           error = kErrorNone;
     CacheEntryList *list;
     CacheEntry *    entry;
-    CacheEntry *    prev;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
     VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
     if ((list == &mCachedList) || (list == &mSnoopedList))
@@ -354,7 +444,7 @@ Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddr
         // from its current list, update it, and then add it to the
         // `mCachedList`.
 
-        list->PopAfter(prev);
+        list->Remove(*entry);
 
         entry->SetRloc16(aRloc16);
         entry->MarkLastTransactionTimeAsInvalid();
@@ -420,6 +510,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
     }
 
     mSnoopedList.Push(*entry);
+    AddToCacheIndex(*entry);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -429,26 +520,18 @@ exit:
 
 void AddressResolver::RestartAddressQueries(void)
 {
-    CacheEntry *tail;
+    CacheEntry *entry;
 
     // We move all entries from `mQueryRetryList` at the tail of
     // `mQueryList` and then (re)send Address Query for all entries in
     // the updated `mQueryList`.
 
-    tail = mQueryList.GetTail();
-
-    if (tail == nullptr)
-    {
-        mQueryList.SetHead(mQueryRetryList.GetHead());
-    }
-    else
+    while ((entry = mQueryRetryList.Pop()) != nullptr)
     {
-        tail->SetNext(mQueryRetryList.GetHead());
+        mQueryList.PushTail(*entry);
     }
 
-    mQueryRetryList.Clear();
-
-    for (CacheEntry *entry = mQueryList.GetHead(); entry != nullptr; entry = entry->GetNext())
+    for (entry = mQueryList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
         IgnoreError(SendAddressQuery(entry->GetTarget()));
 
@@ -462,10 +545,9 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 {
     Error           error = kErrorNone;
     CacheEntry *    entry;
-    CacheEntry *    prev = nullptr;
     CacheEntryList *list;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
 
     if (entry == nullptr)
     {
@@ -490,7 +572,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         // Remove the entry from its current list and push it at the
         // head of cached list.
 
-        list->PopAfter(prev);
+        list->Remove(*entry);
 
         if (list == &mSnoopedList)
         {
@@ -519,16 +601,27 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         // expired.
 
         VerifyOrExit(entry->IsTimeoutZero(), error = kErrorDrop);
-        mQueryRetryList.PopAfter(prev);
+        mQueryRetryList.Remove(*entry);
     }
 
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+
+    if (error != kErrorNone)
+    {
+        if (list != nullptr)
+        {
+            RemoveFromCacheIndex(*entry);
+        }
+
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
+        AddToCacheIndex(*entry);
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
@@ -595,7 +688,6 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     uint32_t                 lastTransactionTime;
     CacheEntryList *         list;
     CacheEntry *             entry;
-    CacheEntry *             prev;
 
     VerifyOrExit(aMessage.IsConfirmablePostRequest());
 
@@ -617,7 +709,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     otLogInfoArp("Received address notification from 0x%04x for %s to 0x%04x",
                  aMessageInfo.GetPeerAddr().GetIid().GetLocator(), target.ToString().AsCString(), rloc16);
 
-    entry = FindCacheEntry(target, list, prev);
+    entry = FindCacheEntry(target, list);
     VerifyOrExit(entry != nullptr);
 
     if (list == &mCachedList)
@@ -639,7 +731,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     entry->SetMeshLocalIid(meshLocalIid);
     entry->SetLastTransactionTime(lastTransactionTime);
 
-    list->PopAfter(prev);
+    list->Remove(*entry);
     mCachedList.Push(*entry);
 
     LogCacheEntryChange(kEntryUpdated, kReasonReceivedNotification, *entry);
@@ -872,7 +964,7 @@ exit:
 void AddressResolver::HandleTimeTick(void)
 {
     bool        continueRxingTicks = false;
-    CacheEntry *prev;
+    CacheEntry *next;
     CacheEntry *entry;
 
     for (entry = mSnoopedList.GetHead(); entry != nullptr; entry = entry->GetNext())
@@ -902,10 +994,10 @@ void AddressResolver::HandleTimeTick(void)
         entry->DecrementTimeout();
     }
 
-    prev = nullptr;
-
-    while ((entry = GetEntryAfter(prev, mQueryList)) != nullptr)
+    for (entry = mQueryList.GetHead(); entry != nullptr; entry = next)
     {
+        next = entry->GetNext();
+
         OT_ASSERT(!entry->IsTimeoutZero());
 
         continueRxingTicks = true;
@@ -928,20 +1020,13 @@ void AddressResolver::HandleTimeTick(void)
             entry->SetCanEvict(true);
 
             // Move the entry from `mQueryList` to `mQueryRetryList`
-            mQueryList.PopAfter(prev);
+            mQueryList.Remove(*entry);
             mQueryRetryList.Push(*entry);
 
             otLogInfoArp("Timed out waiting for address notification for %s, retry: %d",
                          entry->GetTarget().ToString().AsCString(), entry->GetTimeout());
 
             Get<MeshForwarder>().HandleResolved(entry->GetTarget(), kErrorDrop);
-
-            // When the entry is removed from `mQueryList`
-            // we keep the `prev` pointer same as before.
-        }
-        else
-        {
-            prev = entry;
         }
     }
 
@@ -1068,6 +1153,7 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
     mNextIndex = kNoNextIndex;
+    mPrevIndex = kNoNextIndex;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1089,6 +1175,100 @@ exit:
     return;
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+void AddressResolver::CacheEntry::SetPrev(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mPrevIndex = kNoNextIndex);
+    mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryList
+
+void AddressResolver::CacheEntryList::Push(CacheEntry &aEntry)
+{
+    aEntry.SetListId(mListId);
+    aEntry.SetPrev(nullptr);
+    aEntry.SetNext(mHead);
+
+    if (mHead == nullptr)
+    {
+        mTail = &aEntry;
+    }
+    else
+    {
+        mHead->SetPrev(&aEntry);
+    }
+
+    mHead = &aEntry;
+}
+
+void AddressResolver::CacheEntryList::PushTail(CacheEntry &aEntry)
+{
+    aEntry.SetListId(mListId);
+    aEntry.SetPrev(mTail);
+    aEntry.SetNext(nullptr);
+
+    if (mTail == nullptr)
+    {
+        mHead = &aEntry;
+    }
+    else
+    {
+        mTail->SetNext(&aEntry);
+    }
+
+    mTail = &aEntry;
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryList::Pop(void)
+{
+    CacheEntry *entry = mHead;
+
+    if (entry != nullptr)
+    {
+        Remove(*entry);
+    }
+
+    return entry;
+}
+
+void AddressResolver::CacheEntryList::Remove(CacheEntry &aEntry)
+{
+    CacheEntry *prev = aEntry.GetPrev();
+    CacheEntry *next = aEntry.GetNext();
+
+    OT_ASSERT(aEntry.GetListId() == mListId);
+
+    if (prev == nullptr)
+    {
+        mHead = next;
+    }
+    else
+    {
+        prev->SetNext(next);
+    }
+
+    if (next == nullptr)
+    {
+        mTail = prev;
+    }
+    else
+    {
+        next->SetPrev(prev);
+    }
+
+    aEntry.SetNext(nullptr);
+    aEntry.SetPrev(nullptr);
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
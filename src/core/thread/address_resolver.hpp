@@ -67,6 +67,7 @@ namespace ot {
 class AddressResolver : public InstanceLocator, private NonCopyable
 {
     friend class TimeTicker;
+    friend class AddressResolverTester;
 
 public:
     /**
@@ -207,6 +208,16 @@ private:
         kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT,         // in seconds
         kIteratorListIndex             = 0,
         kIteratorEntryIndex            = 1,
+        kCacheIndexSize                = 2 * kCacheEntries, // Hash index size (keeps load factor at most 0.5).
+        kInvalidIndex                  = 0xffff,            // Unused hash index slot.
+    };
+
+    enum ListId : uint8_t
+    {
+        kCachedListId,
+        kSnoopedListId,
+        kQueryListId,
+        kQueryRetryListId,
     };
 
     class CacheEntry : public InstanceLocatorInit
@@ -217,6 +228,11 @@ private:
         CacheEntry *      GetNext(void);
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
+        CacheEntry *      GetPrev(void);
+        void              SetPrev(CacheEntry *aEntry);
+
+        ListId GetListId(void) const { return mListId; }
+        void   SetListId(ListId aListId) { mListId = aListId; }
 
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
@@ -255,6 +271,8 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint16_t          mPrevIndex;
+        ListId            mListId;
         union
         {
             struct
@@ -274,7 +292,34 @@ private:
     };
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
-    typedef LinkedList<CacheEntry>          CacheEntryList;
+
+    // Doubly linked list of cache entries (linked using their pool
+    // indexes) allowing an entry to be removed in O(1) once it is
+    // found through the hash index.
+    class CacheEntryList
+    {
+    public:
+        explicit CacheEntryList(ListId aListId)
+            : mHead(nullptr)
+            , mTail(nullptr)
+            , mListId(aListId)
+        {
+        }
+
+        CacheEntry *      GetHead(void) { return mHead; }
+        const CacheEntry *GetHead(void) const { return mHead; }
+        CacheEntry *      GetTail(void) { return mTail; }
+        bool              IsEmpty(void) const { return (mHead == nullptr); }
+        void              Push(CacheEntry &aEntry);
+        void              PushTail(CacheEntry &aEntry);
+        CacheEntry *      Pop(void);
+        void              Remove(CacheEntry &aEntry);
+
+    private:
+        CacheEntry *mHead;
+        CacheEntry *mTail;
+        ListId      mListId;
+    };
 
     enum EntryChange
     {
@@ -297,12 +342,19 @@ private:
 
     CacheEntryPool &GetCacheEntryPool(void) { return mCacheEntryPool; }
 
-    void        Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
-    void        Remove(const Ip6::Address &aEid, Reason aReason);
-    CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
-    CacheEntry *NewCacheEntry(bool aSnoopedEntry);
-    void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
-    Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
+    void            Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
+    void            Remove(const Ip6::Address &aEid, Reason aReason);
+    CacheEntry *    FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList);
+    CacheEntry *    NewCacheEntry(bool aSnoopedEntry);
+    void            RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, Reason aReason);
+    Error           UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
+    CacheEntryList &GetList(ListId aListId);
+
+    static uint16_t GetCacheIndexSlot(const Ip6::Address &aEid);
+    static uint16_t GetNextCacheIndexSlot(uint16_t aSlot) { return (aSlot + 1) % kCacheIndexSize; }
+    void            ClearCacheIndex(void);
+    void            AddToCacheIndex(const CacheEntry &aEntry);
+    void            RemoveFromCacheIndex(const CacheEntry &aEntry);
 
     Error SendAddressQuery(const Ip6::Address &aEid);
 
@@ -334,8 +386,6 @@ private:
 
     const char *ListToString(const CacheEntryList *aList) const;
 
-    static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
-
     Coap::Resource mAddressError;
     Coap::Resource mAddressQuery;
     Coap::Resource mAddressNotification;
@@ -345,6 +395,7 @@ private:
     CacheEntryList mSnoopedList;
     CacheEntryList mQueryList;
     CacheEntryList mQueryRetryList;
+    uint16_t       mCacheIndex[kCacheIndexSize];
 
     Ip6::Icmp::Handler mIcmpHandler;
 };
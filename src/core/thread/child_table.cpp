@@ -82,6 +82,9 @@ ChildTable::ChildTable(Instance &aInstance)
         child.Init(aInstance);
         child.Clear();
     }
+
+    ClearLookupHints();
+    ClearRloc16Index();
 }
 
 void ChildTable::Clear(void)
@@ -90,6 +93,9 @@ void ChildTable::Clear(void)
     {
         child.Clear();
     }
+
+    ClearLookupHints();
+    ClearRloc16Index();
 }
 
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
@@ -109,6 +115,7 @@ Child *ChildTable::GetNewChild(void)
 
     VerifyOrExit(child != nullptr);
     child->Clear();
+    UpdateRloc16Index(*child);
 
 exit:
     return child;
@@ -132,19 +139,216 @@ exit:
     return child;
 }
 
+Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher)
+{
+    return const_cast<Child *>(const_cast<const ChildTable *>(this)->FindChild(aMatcher));
+}
+
+Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher, uint16_t aHint)
+{
+    Child *child;
+
+    if ((aHint < mMaxChildrenAllowed) && mChildren[aHint].Matches(aMatcher))
+    {
+        ExitNow(child = &mChildren[aHint]);
+    }
+
+    child = FindChild(aMatcher);
+    VerifyOrExit(child != nullptr);
+
+    UpdateLookupHints(*child);
+
+exit:
+    return child;
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aRloc16, aFilter));
+    Child *child = nullptr;
+
+    // An invalid short address in an `AddressMatcher` matches any
+    // child, so it cannot be looked up in the RLOC16 index.
+
+    if (aRloc16 == Mac::kShortAddrInvalid)
+    {
+        ExitNow(child = FindChild(Child::AddressMatcher(aRloc16, aFilter)));
+    }
+
+    VerifyOrExit(IsChildRloc16(aRloc16) && !IsForeignRloc16(aRloc16));
+
+    for (uint16_t slot = GetRloc16IndexSlot(aRloc16); mRloc16Index[slot] != kInvalidHint;
+         slot          = GetNextRloc16IndexSlot(slot))
+    {
+        uint16_t index = mRloc16Index[slot];
+
+        if ((mIndexedRloc16s[index] == aRloc16) && mChildren[index].MatchesFilter(aFilter))
+        {
+            ExitNow(child = &mChildren[index]);
+        }
+    }
+
+exit:
+    return child;
 }
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aExtAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aExtAddress, aFilter));
+    return FindChild(Child::AddressMatcher(aExtAddress, aFilter),
+                     mExtAddressHints[GetExtAddressHintSlot(aExtAddress)]);
 }
 
 Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
+    Child *child;
+
+    switch (aMacAddress.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        child = FindChild(aMacAddress.GetShort(), aFilter);
+        break;
+
+    case Mac::Address::kTypeExtended:
+        child = FindChild(aMacAddress.GetExtended(), aFilter);
+        break;
+
+    default:
+        child = FindChild(Child::AddressMatcher(aMacAddress, aFilter));
+        break;
+    }
+
+    return child;
+}
+
+void ChildTable::UpdateLookupHints(const Child &aChild)
+{
+    mExtAddressHints[GetExtAddressHintSlot(aChild.GetExtAddress())] = GetChildIndex(aChild);
+}
+
+void ChildTable::ClearLookupHints(void)
+{
+    for (uint16_t &hint : mExtAddressHints)
+    {
+        hint = kInvalidHint;
+    }
+}
+
+void ChildTable::UpdateRloc16Index(const Child &aChild)
+{
+    uint16_t index  = GetChildIndex(aChild);
+    uint16_t rloc16 = aChild.GetRloc16();
+
+    if (aChild.IsStateInvalid() || !IsChildRloc16(rloc16))
+    {
+        rloc16 = Mac::kShortAddrInvalid;
+    }
+
+    VerifyOrExit(mIndexedRloc16s[index] != rloc16);
+
+    if (mIndexedRloc16s[index] != Mac::kShortAddrInvalid)
+    {
+        RemoveFromRloc16Index(index);
+    }
+
+    mIndexedRloc16s[index] = rloc16;
+
+    if (rloc16 != Mac::kShortAddrInvalid)
+    {
+        AddToRloc16Index(index);
+    }
+
+exit:
+    return;
+}
+
+void ChildTable::ClearRloc16Index(void)
+{
+    for (uint16_t &entry : mRloc16Index)
+    {
+        entry = kInvalidHint;
+    }
+
+    for (uint16_t &rloc16 : mIndexedRloc16s)
+    {
+        rloc16 = Mac::kShortAddrInvalid;
+    }
+}
+
+void ChildTable::AddToRloc16Index(uint16_t aChildIndex)
+{
+    uint16_t slot = GetRloc16IndexSlot(mIndexedRloc16s[aChildIndex]);
+
+    while (mRloc16Index[slot] != kInvalidHint)
+    {
+        slot = GetNextRloc16IndexSlot(slot);
+    }
+
+    mRloc16Index[slot] = aChildIndex;
+}
+
+void ChildTable::RemoveFromRloc16Index(uint16_t aChildIndex)
+{
+    uint16_t slot = GetRloc16IndexSlot(mIndexedRloc16s[aChildIndex]);
+
+    while (mRloc16Index[slot] != aChildIndex)
+    {
+        OT_ASSERT(mRloc16Index[slot] != kInvalidHint);
+        slot = GetNextRloc16IndexSlot(slot);
+    }
+
+    mRloc16Index[slot] = kInvalidHint;
+
+    // Shift back later entries of the probe sequence (backward-shift
+    // deletion) so that lookups never stop early at the emptied slot.
+
+    for (uint16_t next = GetNextRloc16IndexSlot(slot); mRloc16Index[next] != kInvalidHint;
+         next          = GetNextRloc16IndexSlot(next))
+    {
+        uint16_t home = GetRloc16IndexSlot(mIndexedRloc16s[mRloc16Index[next]]);
+
+        if (((next + kRloc16IndexSize - home) % kRloc16IndexSize) >=
+            ((next + kRloc16IndexSize - slot) % kRloc16IndexSize))
+        {
+            mRloc16Index[slot] = mRloc16Index[next];
+            mRloc16Index[next] = kInvalidHint;
+            slot               = next;
+        }
+    }
+}
+
+bool ChildTable::IsForeignRloc16(uint16_t aRloc16) const
+{
+    // Once this device is a router its children all share its Router
+    // ID. Before that, restored children keep the RLOC16 they had
+    // under the Router ID this device previously used.
+
+    return Get<Mle::MleRouter>().IsRouterOrLeader() &&
+           !Mle::Mle::RouterIdMatch(aRloc16, Get<Mle::MleRouter>().GetRloc16());
+}
+
+bool ChildTable::IsChildRloc16(uint16_t aRloc16)
+{
+    return (Mle::Mle::ChildIdFromRloc16(aRloc16) != 0) &&
+           (Mle::Mle::RouterIdFromRloc16(aRloc16) <= Mle::kMaxRouterId);
+}
+
+uint16_t ChildTable::GetRloc16IndexSlot(uint16_t aRloc16)
+{
+    // Child IDs are allocated sequentially by the parent, so the
+    // Child ID alone spreads attached children across the slots.
+
+    return Mle::Mle::ChildIdFromRloc16(aRloc16) % kRloc16IndexSize;
+}
+
+uint16_t ChildTable::GetExtAddressHintSlot(const Mac::ExtAddress &aExtAddress)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        hash = (hash * 31) + byte;
+    }
+
+    return static_cast<uint16_t>(hash % kMaxChildren);
 }
 
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
@@ -248,6 +452,8 @@ void ChildTable::Restore(void)
         child->SetLastHeard(TimerMilli::GetNow());
         child->SetVersion(static_cast<uint8_t>(childInfo.GetVersion()));
         Get<IndirectSender>().SetChildUseShortAddress(*child, true);
+        UpdateLookupHints(*child);
+        UpdateRloc16Index(*child);
         numChildren++;
     }
 
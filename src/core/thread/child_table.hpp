@@ -303,6 +303,32 @@ public:
      */
     bool HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const;
 
+    /**
+     * This method returns if the child table contains a given `Neighbor` instance.
+     *
+     * @param[in]  aNeighbor  A reference to a `Neighbor`.
+     *
+     * @retval TRUE  if @p aNeighbor is a `Child` in the child table.
+     * @retval FALSE if @p aNeighbor is not a `Child` in the child table.
+     *
+     */
+    bool Contains(const Neighbor &aNeighbor) const
+    {
+        return mChildren <= &static_cast<const Child &>(aNeighbor) &&
+               &static_cast<const Child &>(aNeighbor) < mChildren + kMaxChildren;
+    }
+
+    /**
+     * This method updates the RLOC16 index entry of a given child.
+     *
+     * `FindChild()` by RLOC16 only consults the index, so this method MUST be called whenever the state or the RLOC16
+     * of a child in the table is changed.
+     *
+     * @param[in]  aChild  A reference to a child in the child table.
+     *
+     */
+    void UpdateRloc16Index(const Child &aChild);
+
 private:
     enum
     {
@@ -325,16 +351,46 @@ private:
         Child::StateFilter mFilter;
     };
 
-    Child *FindChild(const Child::AddressMatcher &aMatcher)
+    enum : uint16_t
     {
-        return const_cast<Child *>(const_cast<const ChildTable *>(this)->FindChild(aMatcher));
-    }
+        kInvalidHint     = 0xffff,
+        kRloc16IndexSize = 2 * kMaxChildren, // Kept at most half full so probe sequences stay short.
+    };
 
+    Child *      FindChild(const Child::AddressMatcher &aMatcher);
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
+    Child *      FindChild(const Child::AddressMatcher &aMatcher, uint16_t aHint);
+    void         UpdateLookupHints(const Child &aChild);
+    void         ClearLookupHints(void);
+    void         ClearRloc16Index(void);
+    void         AddToRloc16Index(uint16_t aChildIndex);
+    void         RemoveFromRloc16Index(uint16_t aChildIndex);
+    bool         IsForeignRloc16(uint16_t aRloc16) const;
     void         RefreshStoredChildren(void);
 
+    static bool     IsChildRloc16(uint16_t aRloc16);
+    static uint16_t GetRloc16IndexSlot(uint16_t aRloc16);
+    static uint16_t GetNextRloc16IndexSlot(uint16_t aSlot) { return (aSlot + 1) % kRloc16IndexSize; }
+    static uint16_t GetExtAddressHintSlot(const Mac::ExtAddress &aExtAddress);
+
     uint16_t mMaxChildrenAllowed;
     Child    mChildren[kMaxChildren];
+
+    // The RLOC16 index is an open-addressing hash table (linear probing)
+    // from the RLOC16 of every non-invalid child to its table index. It
+    // is kept authoritative through `UpdateRloc16Index()`, so a lookup
+    // that misses in the index means the RLOC16 is not a child's.
+    // `mIndexedRloc16s` records the RLOC16 each entry is indexed under
+    // (`Mac::kShortAddrInvalid` if none) so that an entry can be removed
+    // after the child's RLOC16 has already changed.
+    //
+    // Extended address hints map an extended address (by hash) to the
+    // table index where the child was last found. They are only trusted
+    // after the entry they point to is verified to match; otherwise the
+    // table is searched linearly and the hint is refreshed.
+    uint16_t mRloc16Index[kRloc16IndexSize];
+    uint16_t mIndexedRloc16s[kMaxChildren];
+    uint16_t mExtAddressHints[kMaxChildren];
 };
 
 } // namespace ot
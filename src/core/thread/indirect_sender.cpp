@@ -78,6 +78,7 @@ void IndirectSender::Stop(void)
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         child.SetIndirectMessage(nullptr);
+        child.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(child);
     }
 
@@ -100,6 +101,16 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     VerifyOrExit(!aMessage.GetChildMask(childIndex));
 
     aMessage.SetChildMask(childIndex);
+
+    // `aMessage` was just added to the send queue, so it comes after
+    // any queued message of the child with the same or higher priority.
+
+    if ((aChild.GetFirstQueuedMessage() == nullptr) ||
+        (aMessage.GetPriority() > aChild.GetFirstQueuedMessage()->GetPriority()))
+    {
+        aChild.SetFirstQueuedMessage(&aMessage);
+    }
+
     mSourceMatchController.IncrementMessageCount(aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
@@ -126,8 +137,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = kErrorNotFound);
 
-    aMessage.ClearChildMask(childIndex);
-    mSourceMatchController.DecrementMessageCount(aChild);
+    ClearMessageForChild(aMessage, aChild, childIndex);
 
     RequestMessageUpdate(aChild);
 
@@ -135,23 +145,65 @@ exit:
     return error;
 }
 
+void IndirectSender::RemoveMessageFromSleepyChildren(Message &aMessage)
+{
+    VerifyOrExit(aMessage.IsChildPending());
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAny))
+    {
+        IgnoreError(RemoveMessageFromSleepyChild(aMessage, child));
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::ClearMessageForChild(Message &aMessage, Child &aChild, uint16_t aChildIndex)
+{
+    // `aMessage` must still be in the send queue so that the next
+    // queued message of the child can be searched from it.
+
+    aMessage.ClearChildMask(aChildIndex);
+    mSourceMatchController.DecrementMessageCount(aChild);
+
+    if (aChild.GetFirstQueuedMessage() == &aMessage)
+    {
+        aChild.SetFirstQueuedMessage((aChild.GetIndirectMessageCount() > 0)
+                                         ? FindNextIndirectMessage(aMessage.GetNext(), aChildIndex)
+                                         : nullptr);
+    }
+}
+
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint16_t childIndex;
+    uint16_t count;
     Message *message;
     Message *nextMessage;
 
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    count      = aChild.GetIndirectMessageCount();
+
+    // No message before the first queued message of the child is
+    // destined to it, and the search can stop after the last one.
+
+    for (message = aChild.GetFirstQueuedMessage(); (message != nullptr) && (count > 0); message = nextMessage)
     {
         nextMessage = message->GetNext();
 
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        if (message->GetChildMask(childIndex))
+        {
+            message->ClearChildMask(childIndex);
+            count--;
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+        }
     }
 
     aChild.SetIndirectMessage(nullptr);
+    aChild.SetFirstQueuedMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -186,17 +238,22 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        uint16_t count      = aChild.GetIndirectMessageCount();
+
+        Message *message    = aChild.GetFirstQueuedMessage();
 
-        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+        for (; (message != nullptr) && (count > 0); message = message->GetNext())
         {
             if (message->GetChildMask(childIndex))
             {
                 message->ClearChildMask(childIndex);
                 message->SetDirectTransmission();
+                count--;
             }
         }
 
         aChild.SetIndirectMessage(nullptr);
+        aChild.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -214,13 +271,25 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 }
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
+{
+    Message *message = aChild.GetFirstQueuedMessage();
+
+    if ((message != nullptr) && aSupervisionTypeOnly && (message->GetType() != Message::kTypeSupervision))
+    {
+        message = FindNextIndirectMessage(message->GetNext(), Get<ChildTable>().GetChildIndex(aChild),
+                                          aSupervisionTypeOnly);
+    }
+
+    return message;
+}
+
+Message *IndirectSender::FindNextIndirectMessage(Message *aMessage, uint16_t aChildIndex, bool aSupervisionTypeOnly)
 {
     Message *message;
-    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+    for (message = aMessage; message; message = message->GetNext())
     {
-        if (message->GetChildMask(childIndex) &&
+        if (message->GetChildMask(aChildIndex) &&
             (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
         {
             break;
@@ -540,8 +609,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
 
         if (message->GetChildMask(childIndex))
         {
-            message->ClearChildMask(childIndex);
-            mSourceMatchController.DecrementMessageCount(aChild);
+            ClearMessageForChild(*message, aChild, childIndex);
         }
 
         Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
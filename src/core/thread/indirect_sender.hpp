@@ -72,6 +72,7 @@ class IndirectSender : public InstanceLocator, public IndirectSenderBase, privat
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     friend class CslTxScheduler::Callbacks;
 #endif
+    friend class IndirectSenderTester;
 
 public:
     /**
@@ -100,6 +101,9 @@ public:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
 
+        Message *GetFirstQueuedMessage(void) { return mFirstQueuedMessage; }
+        void     SetFirstQueuedMessage(Message *aMessage) { mFirstQueuedMessage = aMessage; }
+
         uint16_t GetIndirectFragmentOffset(void) const { return mIndirectFragmentOffset; }
         void     SetIndirectFragmentOffset(uint16_t aFragmentOffset) { mIndirectFragmentOffset = aFragmentOffset; }
 
@@ -122,6 +126,7 @@ public:
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
         Message *mIndirectMessage;             // Current indirect message.
+        Message *mFirstQueuedMessage;          // First queued indirect message (in send queue order).
         uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
         bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
         bool     mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
@@ -176,6 +181,16 @@ public:
      */
     Error RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild);
 
+    /**
+     * This method removes a message for indirect transmission to all the sleepy children it is queued for.
+     *
+     * This method MUST be called before the message is removed from the send queue.
+     *
+     * @param[in] aMessage  The message to update.
+     *
+     */
+    void RemoveMessageFromSleepyChildren(Message &aMessage);
+
     /**
      * This method removes all added messages for a specific child and frees message (with no indirect/direct tx).
      *
@@ -219,6 +234,8 @@ private:
 
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
+    Message *FindNextIndirectMessage(Message *aMessage, uint16_t aChildIndex, bool aSupervisionTypeOnly = false);
+    void     ClearMessageForChild(Message &aMessage, Child &aChild, uint16_t aChildIndex);
     void     RequestMessageUpdate(Child &aChild);
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
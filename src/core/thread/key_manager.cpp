@@ -33,6 +33,8 @@
 
 #include "key_manager.hpp"
 
+#include <limits.h>
+
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -293,13 +295,55 @@ void KeyManager::UpdateKeyMaterial(void)
 
     Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prev.mKeys.mMacKey,
                                  cur.mKeys.mMacKey, next.mKeys.mMacKey);
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mMacKeySchedules[kPrevMacKeySchedule].SetKey(prev.mKeys.mMacKey);
+    mMacKeySchedules[kCurrMacKeySchedule].SetKey(cur.mKeys.mMacKey);
+    mMacKeySchedules[kNextMacKeySchedule].SetKey(next.mKeys.mMacKey);
+#endif
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     ComputeTrelKey(mKeySequence, mTrelKey);
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mMacKeySchedules[kTrelMacKeySchedule].SetKey(mTrelKey);
+#endif
 #endif
 }
 
+Crypto::AesEcb *KeyManager::GetMacKeySchedule(const Mac::Key &aKey)
+{
+    // The schedules are looked up by key value (not by reference) since
+    // the MAC keys in `SubMac` may also be set directly (raw link API).
+
+    Crypto::AesEcb *keySchedule = nullptr;
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    for (MacKeySchedule &macKeySchedule : mMacKeySchedules)
+    {
+        if (macKeySchedule.mKey == aKey)
+        {
+            ExitNow(keySchedule = &macKeySchedule.mAesEcb);
+        }
+    }
+
+exit:
+#else
+    OT_UNUSED_VARIABLE(aKey);
+#endif
+
+    return keySchedule;
+}
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+void KeyManager::MacKeySchedule::SetKey(const Mac::Key &aKey)
+{
+    mKey = aKey;
+    mAesEcb.SetKey(aKey.GetKey(), CHAR_BIT * Mac::Key::kSize);
+}
+#endif
+
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
 {
     VerifyOrExit(aKeySequence != mKeySequence, Get<Notifier>().SignalIfFirst(kEventThreadKeySeqCounterChanged));
@@ -47,6 +47,7 @@
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/mle_types.hpp"
@@ -292,6 +293,20 @@ public:
     const Mac::Key &GetTemporaryTrelMacKey(uint32_t aKeySequence);
 #endif
 
+    /**
+     * This method returns the expanded AES key schedule of a MAC key derived from the current key sequence.
+     *
+     * When `OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE` is set, the key schedules of the previous, current and next
+     * IEEE 802.15.4 MAC keys and of the current TREL MAC key are kept so that the frame security does not expand the
+     * key for every frame.
+     *
+     * @param[in]  aKey  A MAC key.
+     *
+     * @returns A pointer to an AES ECB object with @p aKey set, or nullptr if no key schedule is kept for @p aKey.
+     *
+     */
+    Crypto::AesEcb *GetMacKeySchedule(const Mac::Key &aKey);
+
     /**
      * This method returns the current MLE key.
      *
@@ -510,6 +525,27 @@ private:
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey);
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    struct MacKeySchedule
+    {
+        void SetKey(const Mac::Key &aKey);
+
+        Mac::Key       mKey;
+        Crypto::AesEcb mAesEcb;
+    };
+
+    enum : uint8_t
+    {
+        kPrevMacKeySchedule,
+        kCurrMacKeySchedule,
+        kNextMacKeySchedule,
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        kTrelMacKeySchedule,
+#endif
+        kNumMacKeySchedules,
+    };
+#endif
+
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
     void        HandleKeyRotationTimer(void);
@@ -532,6 +568,10 @@ private:
     Mac::Key mTemporaryTrelKey;
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    MacKeySchedule mMacKeySchedules[kNumMacKeySchedules];
+#endif
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
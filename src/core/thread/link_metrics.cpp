@@ -337,7 +337,7 @@ Error LinkMetrics::AppendLinkMetricsReport(Message &aMessage, const Message &aRe
     }
 
     tlv.SetLength(length);
-    aMessage.Write(startOffset, tlv);
+    SuccessOrExit(error = aMessage.Write(startOffset, tlv));
 
 exit:
     otLogDebgMle("AppendLinkMetricsReport, error:%s", ErrorToString(error));
@@ -1171,7 +1171,7 @@ int Lowpan::Decompress(Message &           aMessage,
             HostSwap16(aMessage.GetOffset() - currentOffset - sizeof(Ip6::Header) + aBufLength - compressedLength);
     }
 
-    aMessage.Write(currentOffset + Ip6::Header::kPayloadLengthFieldOffset, ip6PayloadLength);
+    SuccessOrExit(aMessage.Write(currentOffset + Ip6::Header::kPayloadLengthFieldOffset, ip6PayloadLength));
 
     error = kErrorNone;
 
@@ -1286,7 +1286,7 @@ uint16_t MeshHeader::WriteTo(Message &aMessage, uint16_t aOffset) const
     uint16_t headerLength;
 
     headerLength = WriteTo(frame);
-    aMessage.WriteBytes(aOffset, frame, headerLength);
+    IgnoreError(aMessage.WriteBytes(aOffset, frame, headerLength));
 
     return headerLength;
 }
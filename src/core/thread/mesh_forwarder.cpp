@@ -54,13 +54,13 @@
 
 namespace ot {
 
-void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
+void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame, Mac::FrameHeaderDescriptor &aHeader)
 {
     Clear();
 
-    if (kErrorNone != aFrame.GetSrcPanId(mPanId))
+    if (kErrorNone != aHeader.GetSrcPanId(mPanId))
     {
-        IgnoreError(aFrame.GetDstPanId(mPanId));
+        IgnoreError(aHeader.GetDstPanId(mPanId));
     }
 
     mChannel      = aFrame.GetChannel();
@@ -129,8 +129,7 @@ void MeshForwarder::Stop(void)
 
     while ((message = mSendQueue.GetHead()) != nullptr)
     {
-        mSendQueue.Dequeue(*message);
-        message->Free();
+        DequeueAndFreeMessage(*message);
     }
 
     while ((message = mReassemblyList.GetHead()) != nullptr)
@@ -208,24 +207,17 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
 
     OT_ASSERT(queue != nullptr);
 
+    LogMessage(kMessageEvict, aMessage, nullptr, kErrorNoBufs);
+
     if (queue == &mSendQueue)
     {
-#if OPENTHREAD_FTD
-        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-        {
-            IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
-        }
-#endif
-
-        if (mSendMessage == &aMessage)
-        {
-            mSendMessage = nullptr;
-        }
+        DequeueAndFreeMessage(aMessage);
+    }
+    else
+    {
+        queue->Dequeue(aMessage);
+        aMessage.Free();
     }
-
-    queue->Dequeue(aMessage);
-    LogMessage(kMessageEvict, aMessage, nullptr, kErrorNoBufs);
-    aMessage.Free();
 }
 
 void MeshForwarder::ResumeMessageTransmissions(void)
@@ -313,6 +305,7 @@ Message *MeshForwarder::GetDirectTransmission(void)
 #if OPENTHREAD_FTD
 
         case kErrorAddressQuery:
+            mIndirectSender.RemoveMessageFromSleepyChildren(*curMessage);
             mSendQueue.Dequeue(*curMessage);
             mResolvingQueue.Enqueue(*curMessage);
             continue;
@@ -320,9 +313,8 @@ Message *MeshForwarder::GetDirectTransmission(void)
 #endif
 
         default:
-            mSendQueue.Dequeue(*curMessage);
             LogMessage(kMessageDrop, *curMessage, nullptr, error);
-            curMessage->Free();
+            DequeueAndFreeMessage(*curMessage);
             continue;
         }
     }
@@ -1108,18 +1100,34 @@ void MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
 
     if (mSendMessage == &aMessage)
     {
-        mSendMessage       = nullptr;
         mMessageNextOffset = 0;
     }
 
-    mSendQueue.Dequeue(aMessage);
-    aMessage.Free();
+    DequeueAndFreeMessage(aMessage);
 
 exit:
     return;
 }
 
-void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
+void MeshForwarder::DequeueAndFreeMessage(Message &aMessage)
+{
+    // Every message leaving the send queue goes through here, so that
+    // no sleepy child keeps referring to it once it is freed.
+
+#if OPENTHREAD_FTD
+    mIndirectSender.RemoveMessageFromSleepyChildren(aMessage);
+#endif
+
+    if (mSendMessage == &aMessage)
+    {
+        mSendMessage = nullptr;
+    }
+
+    mSendQueue.Dequeue(aMessage);
+    aMessage.Free();
+}
+
+void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame, Mac::FrameHeaderDescriptor &aHeader)
 {
     ThreadLinkInfo linkInfo;
     Mac::Address   macDest;
@@ -1130,13 +1138,13 @@ void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
 
     VerifyOrExit(mEnabled, error = kErrorInvalidState);
 
-    SuccessOrExit(error = aFrame.GetSrcAddr(macSource));
-    SuccessOrExit(error = aFrame.GetDstAddr(macDest));
+    SuccessOrExit(error = aHeader.GetSrcAddr(macSource));
+    SuccessOrExit(error = aHeader.GetDstAddr(macDest));
 
-    linkInfo.SetFrom(aFrame);
+    linkInfo.SetFrom(aFrame, aHeader);
 
-    payload       = aFrame.GetPayload();
-    payloadLength = aFrame.GetPayloadLength();
+    payload       = aHeader.GetPayload();
+    payloadLength = aHeader.GetPayloadLength();
 
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
     Get<Utils::SupervisionListener>().UpdateOnReceive(macSource, linkInfo.IsLinkSecurityEnabled());
@@ -1297,7 +1305,7 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
 
         VerifyOrExit(message != nullptr, error = kErrorDrop);
 
-        message->WriteBytes(message->GetOffset(), aFrame, aFrameLength);
+        SuccessOrExit(error = message->WriteBytes(message->GetOffset(), aFrame, aFrameLength));
         message->MoveOffset(aFrameLength);
         message->AddRss(aLinkInfo.GetRss());
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
@@ -1415,7 +1423,7 @@ Error MeshForwarder::FrameToMessage(const uint8_t *     aFrame,
     aFrameLength -= static_cast<uint16_t>(headerLength);
 
     SuccessOrExit(error = aMessage->SetLength(aMessage->GetLength() + aFrameLength));
-    aMessage->WriteBytes(aMessage->GetOffset(), aFrame, aFrameLength);
+    SuccessOrExit(error = aMessage->WriteBytes(aMessage->GetOffset(), aFrame, aFrameLength));
     aMessage->MoveOffset(aFrameLength);
 
 exit:
@@ -136,10 +136,11 @@ public:
     /**
      * This method sets the `ThreadLinkInfo` from a given received frame.
      *
-     * @param[in] aFrame  A received frame.
+     * @param[in] aFrame   A received frame.
+     * @param[in] aHeader  The parsed MAC header of @p aFrame.
      *
      */
-    void SetFrom(const Mac::RxFrame &aFrame);
+    void SetFrom(const Mac::RxFrame &aFrame, Mac::FrameHeaderDescriptor &aHeader);
 };
 
 /**
@@ -460,13 +461,14 @@ private:
     void  RemoveMessage(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
-    void          HandleReceivedFrame(Mac::RxFrame &aFrame);
+    void          HandleReceivedFrame(Mac::RxFrame &aFrame, Mac::FrameHeaderDescriptor &aHeader);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     Neighbor *    UpdateNeighborOnSentFrame(Mac::TxFrame &aFrame, Error aError, const Mac::Address &aMacDest);
     void          UpdateNeighborLinkFailures(Neighbor &aNeighbor, Error aError, bool aAllowNeighborRemove);
     void          HandleSentFrame(Mac::TxFrame &aFrame, Error aError);
     void          UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDest, Neighbor *aNeighbor);
     void          RemoveMessageIfNoPendingTx(Message &aMessage);
+    void          DequeueAndFreeMessage(Message &aMessage);
 
     void        HandleTimeTick(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
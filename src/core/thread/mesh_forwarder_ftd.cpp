@@ -302,33 +302,19 @@ void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
+    Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = message->GetNext())
+    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
     {
+        nextMessage = message->GetNext();
+
         if (message->GetSubType() != Message::kSubTypeMleDataResponse)
         {
             continue;
         }
 
-        IgnoreError(message->Read(0, ip6Header));
-
-        if (!(ip6Header.GetDestination().IsMulticast()))
-        {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-            {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(*message, child));
-            }
-        }
-
-        if (mSendMessage == message)
-        {
-            mSendMessage = nullptr;
-        }
-
-        mSendQueue.Dequeue(*message);
         LogMessage(kMessageDrop, *message, nullptr, kErrorNone);
-        message->Free();
+        DequeueAndFreeMessage(*message);
     }
 }
 
@@ -775,7 +761,7 @@ void MeshForwarder::HandleMesh(uint8_t *             aFrame,
 
         SuccessOrExit(error = message->SetLength(meshHeader.GetHeaderLength() + aFrameLength));
         offset += meshHeader.WriteTo(*message, offset);
-        message->WriteBytes(offset, aFrame, aFrameLength);
+        SuccessOrExit(error = message->WriteBytes(offset, aFrame, aFrameLength));
         message->SetLinkInfo(aLinkInfo);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
@@ -1383,7 +1383,7 @@ exit:
     if (error == kErrorNone && length > 0)
     {
         tlv.SetLength(length);
-        aMessage.Write(startOffset, tlv);
+        error = aMessage.Write(startOffset, tlv);
     }
 
     return error;
@@ -2563,7 +2563,7 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         keySequence = Get<KeyManager>().GetCurrentKeySequence();
         header.SetKeyId(keySequence);
 
-        aMessage.WriteBytes(0, &header, header.GetLength());
+        SuccessOrExit(error = aMessage.WriteBytes(0, &header, header.GetLength()));
 
         Crypto::AesCcm::GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(),
                                       Mac::Frame::kSecEncMic32, nonce);
@@ -2582,7 +2582,7 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         {
             length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
             aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kEncrypt);
-            aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
+            SuccessOrExit(error = aMessage.WriteBytes(aMessage.GetOffset(), buf, length));
             aMessage.MoveOffset(length);
         }
 
@@ -2716,7 +2716,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
         length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
         aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kDecrypt);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
+        SuccessOrExit(error = aMessage.WriteBytes(aMessage.GetOffset(), buf, length));
 #endif
         aMessage.MoveOffset(length);
     }
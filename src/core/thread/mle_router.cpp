@@ -1660,6 +1660,7 @@ void MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::MessageI
         child->GetLinkInfo().AddRss(aMessageInfo.GetThreadLinkInfo()->GetRss());
         child->ResetLinkFailures();
         child->SetState(Neighbor::kStateParentRequest);
+        mChildTable.UpdateRloc16Index(*child);
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         child->SetTimeSyncEnabled(Tlv::Find<TimeRequestTlv>(aMessage, nullptr, 0) == kErrorNone);
 #endif
@@ -2276,6 +2277,7 @@ void MleRouter::HandleChildIdRequest(const Message &         aMessage,
     if (!child->IsStateValid())
     {
         child->SetState(Neighbor::kStateChildIdRequest);
+        mChildTable.UpdateRloc16Index(*child);
     }
     else
     {
@@ -2330,6 +2332,7 @@ void MleRouter::HandleChildIdRequest(const Message &         aMessage,
 
     case kRoleChild:
         child->SetState(Neighbor::kStateChildIdRequest);
+        mChildTable.UpdateRloc16Index(*child);
         IgnoreError(BecomeRouter(ThreadStatusTlv::kHaveChildIdRequest));
         break;
 
@@ -2993,7 +2996,7 @@ Error MleRouter::SendDiscoveryResponse(const Ip6::Address &aDestination, const M
         error = Tlv::Append<MeshCoP::JoinerUdpPortTlv>(*message, Get<MeshCoP::JoinerRouter>().GetJoinerUdpPort()));
 
     tlv.SetLength(static_cast<uint8_t>(message->GetLength() - startOffset));
-    message->Write(startOffset - sizeof(tlv), tlv);
+    SuccessOrExit(error = message->Write(startOffset - sizeof(tlv), tlv));
 
     delay = Random::NonCrypto::GetUint16InRange(0, kDiscoveryMaxJitter + 1);
 
@@ -3040,6 +3043,7 @@ Error MleRouter::SendChildIdResponse(Child &aChild)
 
         // allocate Child ID
         aChild.SetRloc16(rloc16);
+        mChildTable.UpdateRloc16Index(aChild);
     }
 
     SuccessOrExit(error = AppendAddress16(*message, aChild.GetRloc16()));
@@ -3150,6 +3154,7 @@ Error MleRouter::SendChildUpdateRequest(Child &aChild)
     {
         // only try to send a single Child Update Request message to an rx-on-when-idle child
         aChild.SetState(Child::kStateChildUpdateRequest);
+        mChildTable.UpdateRloc16Index(aChild);
     }
 
     Log(kMessageSend, kTypeChildUpdateRequestOfChild, destination, aChild.GetRloc16());
@@ -3395,6 +3400,11 @@ void MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
 
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.SetState(Neighbor::kStateInvalid);
+
+    if (mChildTable.Contains(aNeighbor))
+    {
+        mChildTable.UpdateRloc16Index(static_cast<Child &>(aNeighbor));
+    }
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
     aNeighbor.RemoveAllForwardTrackingSeriesInfo();
 #endif
@@ -3405,12 +3415,11 @@ exit:
 
 uint16_t MleRouter::GetNextHop(uint16_t aDestination)
 {
-    uint8_t       destinationId = RouterIdFromRloc16(aDestination);
-    uint8_t       routeCost;
-    uint8_t       linkCost;
-    uint16_t      rval = Mac::kShortAddrInvalid;
-    const Router *router;
-    const Router *nextHop;
+    uint8_t  destinationId = RouterIdFromRloc16(aDestination);
+    uint8_t  linkCost;
+    uint16_t rval = Mac::kShortAddrInvalid;
+    Router * router;
+    Router * nextHop;
 
     if (IsChild())
     {
@@ -3423,16 +3432,17 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         ExitNow(rval = aDestination);
     }
 
+    // Look up the destination and its next hop router entries once and
+    // derive both the direct link cost and the multi-hop route cost from them.
     router = mRouterTable.GetRouter(destinationId);
     VerifyOrExit(router != nullptr);
 
-    linkCost  = GetLinkCost(destinationId);
-    routeCost = GetRouteCost(aDestination);
+    linkCost = mRouterTable.GetLinkCost(*router);
+    nextHop  = mRouterTable.GetRouter(router->GetNextHop());
 
-    if ((routeCost + GetLinkCost(router->GetNextHop())) < linkCost)
+    if ((nextHop != nullptr) && (router->GetCost() + mRouterTable.GetLinkCost(*nextHop) < linkCost))
     {
-        nextHop = mRouterTable.GetRouter(router->GetNextHop());
-        VerifyOrExit(nextHop != nullptr && !nextHop->IsStateInvalid());
+        VerifyOrExit(!nextHop->IsStateInvalid());
 
         rval = Rloc16FromRouterId(router->GetNextHop());
     }
@@ -3447,14 +3457,20 @@ exit:
 
 uint8_t MleRouter::GetCost(uint16_t aRloc16)
 {
-    uint8_t routerId = RouterIdFromRloc16(aRloc16);
-    uint8_t cost     = GetLinkCost(routerId);
-    Router *router   = mRouterTable.GetRouter(routerId);
+    uint8_t cost = kMaxRouteCost;
+    Router *router;
+    Router *nextHop;
     uint8_t routeCost;
 
-    VerifyOrExit(router != nullptr && mRouterTable.GetRouter(router->GetNextHop()) != nullptr);
+    router = mRouterTable.GetRouter(RouterIdFromRloc16(aRloc16));
+    VerifyOrExit(router != nullptr);
+
+    cost = mRouterTable.GetLinkCost(*router);
+
+    nextHop = mRouterTable.GetRouter(router->GetNextHop());
+    VerifyOrExit(nextHop != nullptr);
 
-    routeCost = GetRouteCost(aRloc16) + GetLinkCost(router->GetNextHop());
+    routeCost = router->GetCost() + mRouterTable.GetLinkCost(*nextHop);
 
     if (cost > routeCost)
     {
@@ -3465,6 +3481,35 @@ exit:
     return cost;
 }
 
+void MleRouter::GetNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost)
+{
+    aNextHopRloc16 = GetNextHop(aDestRloc16);
+    aPathCost      = kMaxRouteCost;
+
+    VerifyOrExit(aNextHopRloc16 != Mac::kShortAddrInvalid);
+
+    if (IsChild())
+    {
+        aPathCost = LinkQualityToCost(mParent.GetLinkInfo().GetLinkQuality());
+    }
+    else if (RouterIdFromRloc16(aDestRloc16) == mRouterId)
+    {
+        aPathCost = 0;
+    }
+    else
+    {
+        aPathCost = GetCost(aDestRloc16);
+    }
+
+    if (aPathCost >= kMaxRouteCost)
+    {
+        aPathCost = kMaxRouteCost;
+    }
+
+exit:
+    return;
+}
+
 uint8_t MleRouter::GetRouteCost(uint16_t aRloc16) const
 {
     uint8_t       rval = kMaxRouteCost;
@@ -4075,7 +4120,7 @@ Error MleRouter::AppendChildAddresses(Message &aMessage, Child &aChild)
     }
 
     tlv.SetLength(length);
-    aMessage.Write(startOffset, tlv);
+    SuccessOrExit(error = aMessage.Write(startOffset, tlv));
 
 exit:
     return error;
@@ -4303,6 +4348,7 @@ void MleRouter::SetChildStateToValid(Child &aChild)
     VerifyOrExit(!aChild.IsStateValid());
 
     aChild.SetState(Neighbor::kStateValid);
+    mChildTable.UpdateRloc16Index(aChild);
     IgnoreError(mChildTable.StoreChild(aChild));
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
@@ -268,6 +268,18 @@ public:
      */
     uint8_t GetCost(uint16_t aRloc16);
 
+    /**
+     * This method returns the next hop and the path cost towards an RLOC16 destination.
+     *
+     * When acting as a child, the next hop is the parent and the path cost is the cost of the link to the parent.
+     *
+     * @param[in]  aDestRloc16     The RLOC16 of the destination.
+     * @param[out] aNextHopRloc16  A reference to output the RLOC16 of the next hop (`Mac::kShortAddrInvalid` if none).
+     * @param[out] aPathCost       A reference to output the path cost (`kMaxRouteCost` if no route is known).
+     *
+     */
+    void GetNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost);
+
     /**
      * This method returns the ROUTER_SELECTION_JITTER value.
      *
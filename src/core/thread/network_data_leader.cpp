@@ -64,6 +64,9 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    mLookupTable.Invalidate();
+#endif
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -113,6 +116,9 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
 {
     const PrefixTlv * prefix = nullptr;
     const ContextTlv *contextTlv;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    const LookupTable *table;
+#endif
 
     aContext.mPrefix.SetLength(0);
 
@@ -123,6 +129,24 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         aContext.mCompressFlag = true;
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    if ((table = GetLookupTable()) != nullptr)
+    {
+        for (const LookupTable::Prefix *entry = table->GetPrefixesBegin(); entry < table->GetPrefixesEnd(); entry++)
+        {
+            if (entry->mHasContext && (entry->mPrefix.GetLength() > aContext.mPrefix.GetLength()) &&
+                aAddress.MatchesPrefix(entry->mPrefix))
+            {
+                aContext.mPrefix       = entry->mPrefix;
+                aContext.mContextId    = entry->mContextId;
+                aContext.mCompressFlag = entry->mCompress;
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -140,6 +164,9 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         }
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+exit:
+#endif
     return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
 }
 
@@ -148,6 +175,9 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
     Error            error = kErrorNotFound;
     TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
     const PrefixTlv *prefix;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    const LookupTable *table;
+#endif
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -157,6 +187,20 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    if ((table = GetLookupTable()) != nullptr)
+    {
+        const LookupTable::Prefix *entry = table->FindPrefixWithContext(aContextId);
+
+        VerifyOrExit(entry != nullptr);
+
+        aContext.mPrefix       = entry->mPrefix;
+        aContext.mContextId    = entry->mContextId;
+        aContext.mCompressFlag = entry->mCompress;
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
     while ((prefix = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
         const ContextTlv *contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -180,9 +224,27 @@ bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
     const PrefixTlv *prefix = nullptr;
     bool             rval   = false;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    const LookupTable *table;
+#endif
 
     VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), rval = true);
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    if ((table = GetLookupTable()) != nullptr)
+    {
+        for (const LookupTable::Prefix *entry = table->GetPrefixesBegin(); entry < table->GetPrefixesEnd(); entry++)
+        {
+            if (entry->mIsOnMesh && aAddress.MatchesPrefix(entry->mPrefix))
+            {
+                ExitNow(rval = true);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         // check both stable and temporary Border Router TLVs
@@ -217,6 +279,14 @@ Error LeaderBase::RouteLookup(const Ip6::Address &aSource,
 {
     Error            error  = kErrorNoRoute;
     const PrefixTlv *prefix = nullptr;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    const LookupTable *table;
+
+    if ((table = GetLookupTable()) != nullptr)
+    {
+        ExitNow(error = RouteLookup(*table, aSource, aDestination, aPrefixMatchLength, aRloc16));
+    }
+#endif
 
     while ((prefix = FindNextMatchingPrefix(aSource, prefix)) != nullptr)
     {
@@ -279,10 +349,7 @@ Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
             {
                 if (bestRouteEntry == nullptr || entry->GetPreference() > bestRouteEntry->GetPreference() ||
                     (entry->GetPreference() == bestRouteEntry->GetPreference() &&
-                     (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                      (bestRouteEntry->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                       Get<Mle::MleRouter>().GetCost(entry->GetRloc()) <
-                           Get<Mle::MleRouter>().GetCost(bestRouteEntry->GetRloc())))))
+                     IsRouteTieBreakWinner(entry->GetRloc(), bestRouteEntry->GetRloc())))
                 {
                     bestRouteEntry  = entry;
                     bestMatchLength = prefixLength;
@@ -328,9 +395,7 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16
 
             if (route == nullptr || entry->GetPreference() > route->GetPreference() ||
                 (entry->GetPreference() == route->GetPreference() &&
-                 (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                  (route->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                   Get<Mle::MleRouter>().GetCost(entry->GetRloc()) < Get<Mle::MleRouter>().GetCost(route->GetRloc())))))
+                 IsRouteTieBreakWinner(entry->GetRloc(), route->GetRloc())))
             {
                 route = entry;
             }
@@ -350,6 +415,280 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16
     return error;
 }
 
+bool LeaderBase::IsRouteTieBreakWinner(uint16_t aRloc16, uint16_t aBestRloc16) const
+{
+    // Between two routes with the same preference, prefer the one
+    // through this device and otherwise the one with lower path cost.
+
+    Mle::MleRouter &mle    = Get<Mle::MleRouter>();
+    uint16_t        rloc16 = mle.GetRloc16();
+
+    return (aRloc16 == rloc16) || ((aBestRloc16 != rloc16) && (mle.GetCost(aRloc16) < mle.GetCost(aBestRloc16)));
+}
+
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+
+Error LeaderBase::RouteLookup(const LookupTable & aTable,
+                              const Ip6::Address &aSource,
+                              const Ip6::Address &aDestination,
+                              uint8_t *           aPrefixMatchLength,
+                              uint16_t *          aRloc16) const
+{
+    Error error = kErrorNoRoute;
+
+    for (const LookupTable::Prefix *prefix = aTable.GetPrefixesBegin(); prefix < aTable.GetPrefixesEnd(); prefix++)
+    {
+        if (!aSource.MatchesPrefix(prefix->mPrefix))
+        {
+            continue;
+        }
+
+        if (ExternalRouteLookup(aTable, prefix->mDomainId, aDestination, aPrefixMatchLength, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+
+        if (prefix->mNumDefaultRoutes > 0)
+        {
+            const LookupTable::Route *route = &aTable.GetRoute(prefix->mDefaultRoutesStart);
+
+            for (uint8_t i = 1; i < prefix->mNumDefaultRoutes; i++)
+            {
+                const LookupTable::Route &candidate = aTable.GetRoute(prefix->mDefaultRoutesStart + i);
+
+                if (IsRouteTieBreakWinner(candidate.mRloc16, route->mRloc16))
+                {
+                    route = &candidate;
+                }
+            }
+
+            if (aRloc16 != nullptr)
+            {
+                *aRloc16 = route->mRloc16;
+            }
+
+            if (aPrefixMatchLength)
+            {
+                *aPrefixMatchLength = 0;
+            }
+
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error LeaderBase::ExternalRouteLookup(const LookupTable & aTable,
+                                      uint8_t             aDomainId,
+                                      const Ip6::Address &aDestination,
+                                      uint8_t *           aPrefixMatchLength,
+                                      uint16_t *          aRloc16) const
+{
+    Error                     error           = kErrorNoRoute;
+    const LookupTable::Route *bestRoute       = nullptr;
+    uint8_t                   bestMatchLength = 0;
+
+    for (const LookupTable::Prefix *prefix = aTable.GetPrefixesBegin(); prefix < aTable.GetPrefixesEnd(); prefix++)
+    {
+        uint8_t prefixLength = prefix->mPrefix.GetLength();
+
+        if ((prefix->mDomainId != aDomainId) || (prefix->mNumExternalRoutes == 0))
+        {
+            continue;
+        }
+
+        if ((bestRoute != nullptr) && (prefixLength <= bestMatchLength))
+        {
+            continue;
+        }
+
+        if (!aDestination.MatchesPrefix(prefix->mPrefix))
+        {
+            continue;
+        }
+
+        for (uint8_t i = 0; i < prefix->mNumExternalRoutes; i++)
+        {
+            const LookupTable::Route &route = aTable.GetRoute(prefix->mExternalRoutesStart + i);
+
+            if (bestRoute == nullptr || route.mPreference > bestRoute->mPreference ||
+                (route.mPreference == bestRoute->mPreference &&
+                 IsRouteTieBreakWinner(route.mRloc16, bestRoute->mRloc16)))
+            {
+                bestRoute       = &route;
+                bestMatchLength = prefixLength;
+            }
+        }
+    }
+
+    if (bestRoute != nullptr)
+    {
+        if (aRloc16 != nullptr)
+        {
+            *aRloc16 = bestRoute->mRloc16;
+        }
+
+        if (aPrefixMatchLength != nullptr)
+        {
+            *aPrefixMatchLength = bestMatchLength;
+        }
+
+        error = kErrorNone;
+    }
+
+    return error;
+}
+
+const LeaderBase::LookupTable *LeaderBase::GetLookupTable(void) const
+{
+    // The table is rebuilt on first use after any change of the
+    // Network Data (which always changes its version).
+
+    if (!mLookupTable.IsBuiltFor(mVersion))
+    {
+        mLookupTable.Build(*this);
+    }
+
+    return mLookupTable.IsOverflowed() ? nullptr : &mLookupTable;
+}
+
+void LeaderBase::LookupTable::Build(const LeaderBase &aLeader)
+{
+    TlvIterator      tlvIterator(aLeader.GetTlvsStart(), aLeader.GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    mNumPrefixes  = 0;
+    mNumRoutes    = 0;
+    mVersion      = aLeader.mVersion;
+    mIsBuilt      = true;
+    mIsOverflowed = true;
+    memset(mContextIndexes, kInvalidIndex, sizeof(mContextIndexes));
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        VerifyOrExit(mNumPrefixes < kMaxPrefixes);
+
+        Prefix &               prefix     = mPrefixes[mNumPrefixes];
+        const ContextTlv *     contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        const BorderRouterTlv *borderRouter;
+        const HasRouteTlv *    hasRoute;
+        TlvIterator            borderRouterIterator(*prefixTlv);
+        TlvIterator            hasRouteIterator(*prefixTlv);
+
+        prefixTlv->CopyPrefixTo(prefix.mPrefix);
+        prefix.mDomainId   = prefixTlv->GetDomainId();
+        prefix.mIsOnMesh   = false;
+        prefix.mHasContext = (contextTlv != nullptr);
+        prefix.mCompress   = (contextTlv != nullptr) && contextTlv->IsCompress();
+        prefix.mContextId  = (contextTlv != nullptr) ? contextTlv->GetContextId() : 0;
+
+        if ((contextTlv != nullptr) && (mContextIndexes[prefix.mContextId] == kInvalidIndex))
+        {
+            mContextIndexes[prefix.mContextId] = mNumPrefixes;
+        }
+
+        // Only the first stable and first temporary Border Router TLVs
+        // are checked for the on-mesh flag (same as `IsOnMesh()`).
+        for (int i = 0; i < 2; i++)
+        {
+            borderRouter = prefixTlv->FindSubTlv<BorderRouterTlv>(/* aStable */ (i == 0));
+
+            if (borderRouter == nullptr)
+            {
+                continue;
+            }
+
+            for (const BorderRouterEntry *entry = borderRouter->GetFirstEntry(); entry <= borderRouter->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                prefix.mIsOnMesh |= entry->IsOnMesh();
+            }
+        }
+
+        prefix.mDefaultRoutesStart = mNumRoutes;
+        prefix.mNumDefaultRoutes   = 0;
+
+        while ((borderRouter = borderRouterIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            for (const BorderRouterEntry *entry = borderRouter->GetFirstEntry(); entry <= borderRouter->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                if (entry->IsDefaultRoute())
+                {
+                    SuccessOrExit(AddRoute(prefix.mDefaultRoutesStart, prefix.mNumDefaultRoutes, entry->GetRloc(),
+                                           entry->GetPreference()));
+                }
+            }
+        }
+
+        prefix.mExternalRoutesStart = mNumRoutes;
+        prefix.mNumExternalRoutes   = 0;
+
+        while ((hasRoute = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+        {
+            for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
+                 entry                      = entry->GetNext())
+            {
+                SuccessOrExit(AddRoute(prefix.mExternalRoutesStart, prefix.mNumExternalRoutes, entry->GetRloc(),
+                                       entry->GetPreference()));
+            }
+        }
+
+        mNumPrefixes++;
+    }
+
+    mIsOverflowed = false;
+
+exit:
+    return;
+}
+
+Error LeaderBase::LookupTable::AddRoute(uint8_t aStart, uint8_t &aNumRoutes, uint16_t aRloc16, int8_t aPreference)
+{
+    // Keeps only the routes with the highest preference in the
+    // `aNumRoutes` entries starting at `aStart` (last in `mRoutes`).
+
+    Error error = kErrorNone;
+
+    if (aNumRoutes > 0)
+    {
+        VerifyOrExit(aPreference >= mRoutes[aStart].mPreference);
+
+        if (aPreference > mRoutes[aStart].mPreference)
+        {
+            mNumRoutes = aStart;
+            aNumRoutes = 0;
+        }
+    }
+
+    VerifyOrExit(mNumRoutes < kMaxRoutes, error = kErrorNoBufs);
+
+    mRoutes[mNumRoutes].mRloc16     = aRloc16;
+    mRoutes[mNumRoutes].mPreference = aPreference;
+    mNumRoutes++;
+    aNumRoutes++;
+
+exit:
+    return error;
+}
+
+const LeaderBase::LookupTable::Prefix *LeaderBase::LookupTable::FindPrefixWithContext(uint8_t aContextId) const
+{
+    const Prefix *prefix = nullptr;
+
+    VerifyOrExit(aContextId < kNumContextIds);
+    VerifyOrExit(mContextIndexes[aContextId] != kInvalidIndex);
+
+    prefix = &mPrefixes[mContextIndexes[aContextId]];
+
+exit:
+    return prefix;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+
 Error LeaderBase::SetNetworkData(uint8_t        aVersion,
                                  uint8_t        aStableVersion,
                                  bool           aStableOnly,
@@ -374,6 +713,10 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
         RemoveTemporaryData(mTlvs, mLength);
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    mLookupTable.Build(*this);
+#endif
+
 #if OPENTHREAD_FTD
     // Synchronize internal 6LoWPAN Context ID Set with recently obtained Network Data.
     if (Get<Mle::MleRouter>().IsLeader())
@@ -290,6 +290,88 @@ private:
                               uint16_t *          aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16) const;
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
+    bool  IsRouteTieBreakWinner(uint16_t aRloc16, uint16_t aBestRloc16) const;
+
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    /**
+     * This class is a lookup table compiled from the Network Data Prefix TLVs (kept in the order of the TLVs so that
+     * lookups give the same results as parsing the TLVs).
+     *
+     * Only the route entries with the highest preference of each Prefix TLV are kept, since entries with a lower
+     * preference can never be selected. The final choice among them depends on the current path costs and is made at
+     * lookup time.
+     *
+     */
+    class LookupTable
+    {
+    public:
+        enum : uint8_t
+        {
+            kMaxPrefixes   = OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_MAX_PREFIXES,
+            kMaxRoutes     = 2 * kMaxPrefixes,
+            kNumContextIds = 16,
+            kInvalidIndex  = 0xff,
+        };
+
+        struct Route
+        {
+            uint16_t mRloc16;
+            int8_t   mPreference;
+        };
+
+        struct Prefix
+        {
+            Ip6::Prefix mPrefix;
+            uint8_t     mDomainId;
+            bool        mIsOnMesh;
+            bool        mHasContext;
+            bool        mCompress;
+            uint8_t     mContextId;
+            uint8_t     mDefaultRoutesStart;
+            uint8_t     mNumDefaultRoutes;
+            uint8_t     mExternalRoutesStart;
+            uint8_t     mNumExternalRoutes;
+        };
+
+        LookupTable(void) { Invalidate(); }
+
+        void Invalidate(void) { mIsBuilt = false; }
+        bool IsBuiltFor(uint8_t aVersion) const { return mIsBuilt && (mVersion == aVersion); }
+        bool IsOverflowed(void) const { return mIsOverflowed; }
+        void Build(const LeaderBase &aLeader);
+
+        const Prefix *GetPrefixesBegin(void) const { return &mPrefixes[0]; }
+        const Prefix *GetPrefixesEnd(void) const { return &mPrefixes[mNumPrefixes]; }
+        const Route & GetRoute(uint8_t aIndex) const { return mRoutes[aIndex]; }
+        const Prefix *FindPrefixWithContext(uint8_t aContextId) const;
+
+    private:
+        Error AddRoute(uint8_t aStart, uint8_t &aNumRoutes, uint16_t aRloc16, int8_t aPreference);
+
+        Prefix  mPrefixes[kMaxPrefixes];
+        Route   mRoutes[kMaxRoutes];
+        uint8_t mContextIndexes[kNumContextIds]; // Context ID -> index in `mPrefixes` (or `kInvalidIndex`).
+        uint8_t mNumPrefixes;
+        uint8_t mNumRoutes;
+        uint8_t mVersion;
+        bool    mIsBuilt;
+        bool    mIsOverflowed;
+    };
+
+    const LookupTable *GetLookupTable(void) const;
+    Error              RouteLookup(const LookupTable & aTable,
+                                   const Ip6::Address &aSource,
+                                   const Ip6::Address &aDestination,
+                                   uint8_t *           aPrefixMatchLength,
+                                   uint16_t *          aRloc16) const;
+    Error              ExternalRouteLookup(const LookupTable & aTable,
+                                           uint8_t             aDomainId,
+                                           const Ip6::Address &aDestination,
+                                           uint8_t *           aPrefixMatchLength,
+                                           uint16_t *          aRloc16) const;
+
+    mutable LookupTable mLookupTable;
+#endif
 };
 
 /**
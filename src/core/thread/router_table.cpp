@@ -194,6 +194,8 @@ void RouterTable::UpdateAllocation(void)
         router.Clear();
         router.SetRloc16(0xffff);
     }
+
+    memcpy(mRouterIdMap, indexMap, sizeof(mRouterIdMap));
 }
 
 Router *RouterTable::Allocate(void)
@@ -380,13 +382,15 @@ Router *RouterTable::GetNeighbor(const Mac::Address &aMacAddress)
 const Router *RouterTable::GetRouter(uint8_t aRouterId) const
 {
     const Router *router = nullptr;
-    uint16_t      rloc16;
+    uint8_t       index;
 
     // Skip if invalid router id is passed.
-    VerifyOrExit(aRouterId < Mle::kInvalidRouterId);
+    VerifyOrExit(aRouterId <= Mle::kMaxRouterId);
+
+    index = mRouterIdMap[aRouterId];
+    VerifyOrExit(index != Mle::kInvalidRouterId);
 
-    rloc16 = Mle::Mle::Rloc16FromRouterId(aRouterId);
-    router = FindRouter(Router::AddressMatcher(rloc16, Router::kInStateAny));
+    router = &mRouters[index];
 
 exit:
     return router;
@@ -371,6 +371,7 @@ private:
     Router           mRouters[Mle::kMaxRouters];
     Mle::RouterIdSet mAllocatedRouterIds;
     uint8_t          mRouterIdReuseDelay[Mle::kMaxRouterId + 1];
+    uint8_t          mRouterIdMap[Mle::kMaxRouterId + 1]; // Router ID -> index in `mRouters` (or `kInvalidRouterId`).
     TimeMilli        mRouterIdSequenceLastUpdated;
     uint8_t          mRouterIdSequence;
     uint8_t          mActiveRouterCount;
@@ -51,6 +51,7 @@ namespace ot {
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+    , mUpdateTask(aInstance, SourceMatchController::HandleUpdateTask)
 {
     ClearTable();
 }
@@ -125,46 +126,11 @@ void SourceMatchController::Enable(bool aEnable)
 
 void SourceMatchController::AddEntry(Child &aChild)
 {
-    aChild.SetIndirectSourceMatchPending(true);
-
-    if (!IsEnabled())
-    {
-        SuccessOrExit(AddPendingEntries());
-        Enable(true);
-    }
-    else
-    {
-        VerifyOrExit(AddAddress(aChild) == kErrorNone, Enable(false));
-        aChild.SetIndirectSourceMatchPending(false);
-    }
-
-exit:
-    return;
-}
-
-Error SourceMatchController::AddAddress(const Child &aChild)
-{
-    Error error = kErrorNone;
-
-    if (aChild.IsIndirectSourceMatchShort())
-    {
-        error = Get<Radio>().AddSrcMatchShortEntry(aChild.GetRloc16());
-
-        otLogDebgMac("SrcAddrMatch - Adding short addr: 0x%04x -- %s (%d)", aChild.GetRloc16(), ErrorToString(error),
-                     error);
-    }
-    else
-    {
-        Mac::ExtAddress address;
-
-        address.Set(aChild.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
-        error = Get<Radio>().AddSrcMatchExtEntry(address);
-
-        otLogDebgMac("SrcAddrMatch - Adding addr: %s -- %s (%d)", aChild.GetExtAddress().ToString().AsCString(),
-                     ErrorToString(error), error);
-    }
+    // The entry is added from `mUpdateTask` so that the entries of all the children which get an indirect message in
+    // the same run (e.g., a multicast to all sleepy children) are pushed to the radio together.
 
-    return error;
+    aChild.SetIndirectSourceMatchPending(true);
+    mUpdateTask.Post();
 }
 
 void SourceMatchController::ClearEntry(Child &aChild)
@@ -178,6 +144,14 @@ void SourceMatchController::ClearEntry(Child &aChild)
         ExitNow();
     }
 
+    if (!IsEnabled())
+    {
+        // The whole table is replaced before source matching is enabled again, which also drops this entry. Removing
+        // the entry may free up space, so try again now.
+        mUpdateTask.Post();
+        ExitNow();
+    }
+
     if (aChild.IsIndirectSourceMatchShort())
     {
         error = Get<Radio>().ClearSrcMatchShortEntry(aChild.GetRloc16());
@@ -196,11 +170,26 @@ void SourceMatchController::ClearEntry(Child &aChild)
                      ErrorToString(error), error);
     }
 
-    SuccessOrExit(error);
+    OT_UNUSED_VARIABLE(error);
 
-    if (!IsEnabled())
+exit:
+    return;
+}
+
+void SourceMatchController::HandleUpdateTask(Tasklet &aTasklet)
+{
+    aTasklet.Get<SourceMatchController>().HandleUpdateTask();
+}
+
+void SourceMatchController::HandleUpdateTask(void)
+{
+    if (IsEnabled())
+    {
+        VerifyOrExit(UpdateTable(kAddPendingEntries) == kErrorNone, Enable(false));
+    }
+    else
     {
-        SuccessOrExit(AddPendingEntries());
+        SuccessOrExit(UpdateTable(kReplaceAllEntries));
         Enable(true);
     }
 
@@ -208,23 +197,107 @@ exit:
     return;
 }
 
-Error SourceMatchController::AddPendingEntries(void)
+Error SourceMatchController::UpdateTable(UpdateMode aMode)
 {
-    Error error = kErrorNone;
+    Error             error = kErrorNone;
+    Mac::ShortAddress shortAddresses[kMaxBatchEntries];
+    Mac::ExtAddress   extAddresses[kMaxBatchEntries];
+    uint16_t          numShortAddresses = 0;
+    uint16_t          numExtAddresses   = 0;
+    bool              replaceShort      = (aMode == kReplaceAllEntries);
+    bool              replaceExt        = (aMode == kReplaceAllEntries);
 
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
     {
-        if (child.IsIndirectSourceMatchPending())
+        if ((aMode == kAddPendingEntries) ? !child.IsIndirectSourceMatchPending()
+                                          : (child.GetIndirectMessageCount() == 0))
+        {
+            continue;
+        }
+
+        if (child.IsIndirectSourceMatchShort())
+        {
+            shortAddresses[numShortAddresses++] = child.GetRloc16();
+
+            if (numShortAddresses == kMaxBatchEntries)
+            {
+                SuccessOrExit(error = UpdateShortEntries(shortAddresses, numShortAddresses, replaceShort));
+                numShortAddresses = 0;
+            }
+        }
+        else
         {
-            SuccessOrExit(error = AddAddress(child));
-            child.SetIndirectSourceMatchPending(false);
+            extAddresses[numExtAddresses++].Set(child.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+
+            if (numExtAddresses == kMaxBatchEntries)
+            {
+                SuccessOrExit(error = UpdateExtEntries(extAddresses, numExtAddresses, replaceExt));
+                numExtAddresses = 0;
+            }
         }
     }
 
+    if (numShortAddresses > 0 || replaceShort)
+    {
+        SuccessOrExit(error = UpdateShortEntries(shortAddresses, numShortAddresses, replaceShort));
+    }
+
+    if (numExtAddresses > 0 || replaceExt)
+    {
+        SuccessOrExit(error = UpdateExtEntries(extAddresses, numExtAddresses, replaceExt));
+    }
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    {
+        child.SetIndirectSourceMatchPending(false);
+    }
+
 exit:
     return error;
 }
 
+Error SourceMatchController::UpdateShortEntries(const Mac::ShortAddress *aShortAddresses,
+                                                uint16_t                 aNumEntries,
+                                                bool &                   aReplace)
+{
+    Error error;
+
+    if (aReplace)
+    {
+        error    = Get<Radio>().SetSrcMatchShortEntries(aShortAddresses, aNumEntries);
+        aReplace = false;
+    }
+    else
+    {
+        error = Get<Radio>().AddSrcMatchShortEntries(aShortAddresses, aNumEntries);
+    }
+
+    otLogDebgMac("SrcAddrMatch - Adding %u short addrs -- %s (%d)", aNumEntries, ErrorToString(error), error);
+
+    return error;
+}
+
+Error SourceMatchController::UpdateExtEntries(const Mac::ExtAddress *aExtAddresses,
+                                              uint16_t               aNumEntries,
+                                              bool &                 aReplace)
+{
+    Error error;
+
+    if (aReplace)
+    {
+        error    = Get<Radio>().SetSrcMatchExtEntries(aExtAddresses, aNumEntries);
+        aReplace = false;
+    }
+    else
+    {
+        error = Get<Radio>().AddSrcMatchExtEntries(aExtAddresses, aNumEntries);
+    }
+
+    otLogDebgMac("SrcAddrMatch - Adding %u ext addrs -- %s (%d)", aNumEntries, ErrorToString(error), error);
+
+    return error;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
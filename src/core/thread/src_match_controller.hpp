@@ -41,6 +41,8 @@
 #include "common/error.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
+#include "mac/mac_types.hpp"
 
 namespace ot {
 
@@ -141,12 +143,12 @@ private:
     void Enable(bool aEnable);
 
     /**
-     * This method adds an entry to source match table for a given child and updates the state of source matching
-     * feature accordingly.
+     * This method adds an entry to source match table for a given child.
      *
-     * If the entry is added successfully, source matching feature is enabled (if not already enabled) after ensuring
-     * that there are no remaining pending entries. If the entry cannot be added (no space in source match table),
-     * the child is marked to remember the pending entry and source matching is disabled.
+     * The child is marked to remember the pending entry and the entries of all such children are added together
+     * from a tasklet. If source matching is enabled and the entries cannot be added (no space in source match table),
+     * source matching is disabled. If source matching is disabled, the whole table is replaced and source matching is
+     * enabled once all the entries fit.
      *
      * @param[in] aChild    A reference to the child.
      *
@@ -157,36 +159,43 @@ private:
      * This method clears an entry in source match table for a given child and updates the state of source matching
      * feature accordingly.
      *
-     * If the entry is removed successfully and frees up space in the source match table, any remaining pending
-     * entries are added. If all pending entries are successfully added, source matching is enabled.
+     * If source matching is disabled, the entry is dropped when the table is replaced before source matching is
+     * enabled again. The replacement is attempted again as removing the entry may free up space.
      *
      * @param[in] aChild    A reference to the child.
      *
      */
     void ClearEntry(Child &aChild);
 
-    /**
-     * This method adds a given child's address (short or extended address depending on child's setting) to the source
-     * source match table (@sa SetSrcMatchAsShort.
-     *
-     * @param[in] aChild            A reference to the child
-     *
-     * @retval kErrorNone     Child's address was added successfully to the source match table.
-     * @retval kErrorNoBufs   No available space in the source match table.
-     *
-     */
-    Error AddAddress(const Child &aChild);
+    enum UpdateMode : uint8_t
+    {
+        kAddPendingEntries, // Add the entries of the children marked with a pending entry.
+        kReplaceAllEntries, // Replace the table with the entries of all the children with indirect messages.
+    };
+
+    enum : uint16_t
+    {
+        kMaxBatchEntries = 32, // Max number of entries passed to the radio in one update.
+    };
+
+    static void HandleUpdateTask(Tasklet &aTasklet);
+    void        HandleUpdateTask(void);
 
     /**
-     * This method adds all pending entries to the source match table.
+     * This method updates the source match table in batches of up to `kMaxBatchEntries` entries.
+     *
+     * @param[in] aMode  The update mode.
      *
-     * @retval kErrorNone     All pending entries were successfully added.
+     * @retval kErrorNone     All the entries were successfully added.
      * @retval kErrorNoBufs   No available space in the source match table.
      *
      */
-    Error AddPendingEntries(void);
+    Error UpdateTable(UpdateMode aMode);
+    Error UpdateShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries, bool &aReplace);
+    Error UpdateExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries, bool &aReplace);
 
-    bool mEnabled;
+    bool    mEnabled;
+    Tasklet mUpdateTask;
 };
 
 /**
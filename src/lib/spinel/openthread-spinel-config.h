@@ -65,4 +65,21 @@
 #define OPENTHREAD_SPINEL_CONFIG_RESET_CONNECTION 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT
+ *
+ * Defines the max number of spinel property updates which may be in flight to the RCP at the same time.
+ *
+ * Property updates whose failure the host cannot recover from (e.g. PAN ID, MAC addresses, MAC key) are sent without
+ * waiting for the response, and their result is checked when the response arrives. Each in flight update holds a
+ * spinel transaction id, the value must be less than 14 so that one is always left for a synchronous request and one
+ * for the radio frame transmission.
+ *
+ * 0 means to wait for the response of every request.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT
+#define OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT 4
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
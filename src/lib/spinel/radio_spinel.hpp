@@ -104,6 +104,33 @@ namespace Spinel {
 template <typename InterfaceType, typename ProcessContextType> class RadioSpinel
 {
 public:
+    enum : uint8_t
+    {
+        kNumRcpLatencyBuckets = 12, ///< Number of buckets in the RCP round trip latency histogram.
+    };
+
+    enum : uint32_t
+    {
+        kRcpLatencyFirstBucketUs = 128, ///< Upper bound of the first RCP latency bucket (in microseconds).
+    };
+
+    /**
+     * This structure represents the round trip latency histogram of the spinel requests sent to the RCP.
+     *
+     * `mBuckets[0]` counts the responses received within `kRcpLatencyFirstBucketUs`, each following bucket doubles
+     * the upper bound of the previous one and the last bucket counts all the slower responses. Radio frame
+     * transmissions are not included.
+     *
+     */
+    struct RcpLatencyHistogram
+    {
+        uint32_t mBuckets[kNumRcpLatencyBuckets]; ///< The number of responses per latency bucket.
+        uint32_t mMaxLatencyUs;                   ///< The maximum round trip latency (in microseconds).
+        uint32_t mPipelinedRequests;              ///< The number of requests sent without waiting for the response.
+        uint32_t mPipelinedFailures;              ///< The number of pipelined requests which failed.
+        uint8_t  mMaxPipelinedInFlight;           ///< The maximum number of pipelined requests in flight.
+    };
+
     /**
      * This constructor initializes the spinel based OpenThread transceiver.
      *
@@ -454,6 +481,93 @@ public:
      */
     otError ClearSrcMatchExtEntries(void);
 
+    /**
+     * This method adds a list of short addresses to the source address match table.
+     *
+     * The addresses are sent in as few spinel frames as possible when the RCP supports multiple entries in a single
+     * insert command (RCP API version 4 and above), and one at a time otherwise.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses to be added.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully added all the short addresses to the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     */
+    otError AddSrcMatchShortEntries(const uint16_t *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method adds a list of extended addresses to the source address match table.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be added stored in little-endian byte
+     *                            order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully added all the extended addresses to the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     */
+    otError AddSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method removes a list of short addresses from the source address match table.
+     *
+     * All the addresses are removed even if some of them are not in the table.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses to be removed.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully removed all the short addresses from the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_ADDRESS         At least one of the short addresses is not in source address match table.
+     */
+    otError RemoveSrcMatchShortEntries(const uint16_t *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method removes a list of extended addresses from the source address match table.
+     *
+     * All the addresses are removed even if some of them are not in the table.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be removed stored in little-endian
+     *                            byte order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully removed all the extended addresses from the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_ADDRESS         At least one of the extended addresses is not in source address match table.
+     */
+    otError RemoveSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method replaces all the short addresses in the source address match table with a given list.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully replaced the short addresses in the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     */
+    otError SetSrcMatchShortEntries(const uint16_t *aShortAddresses, uint16_t aNumEntries);
+
+    /**
+     * This method replaces all the extended addresses in the source address match table with a given list.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses stored in little-endian byte order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     *
+     * @retval  OT_ERROR_NONE               Successfully replaced the extended addresses in the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     */
+    otError SetSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+
     /**
      * This method begins the energy scan sequence on the radio.
      *
@@ -555,6 +669,28 @@ public:
      */
     uint64_t GetTxRadioEndUs(void) const { return mTxRadioEndUs; }
 
+    /**
+     * This method returns the timeout timepoint for the pipelined requests in flight.
+     *
+     * @returns The timeout timepoint for the oldest pipelined request, or `UINT64_MAX` when there is none.
+     *
+     */
+    uint64_t GetPipelinedRequestsEndUs(void) const;
+
+    /**
+     * This method returns the RCP round trip latency histogram.
+     *
+     * @returns A reference to the RCP round trip latency histogram.
+     *
+     */
+    const RcpLatencyHistogram &GetRcpLatencyHistogram(void) const { return mRcpLatencyHistogram; }
+
+    /**
+     * This method resets the RCP round trip latency histogram.
+     *
+     */
+    void ResetRcpLatencyHistogram(void);
+
     /**
      * This method processes any pending the I/O data.
      *
@@ -744,11 +880,13 @@ public:
 private:
     enum
     {
-        kMaxSpinelFrame        = SpinelInterface::kMaxFrameSize,
-        kMaxWaitTime           = 2000, ///< Max time to wait for response in milliseconds.
-        kVersionStringSize     = 128,  ///< Max size of version string.
-        kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
-        kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kMaxSpinelFrame             = SpinelInterface::kMaxFrameSize,
+        kMaxWaitTime                = 2000, ///< Max time to wait for response in milliseconds.
+        kVersionStringSize          = 128,  ///< Max size of version string.
+        kCapsBufferSize             = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
+        kChannelMaskBufferSize      = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kNumTids                    = 16,   ///< Number of spinel transaction ids, including the reserved 0.
+        kMaxSrcMatchEntriesPerFrame = 32,   ///< Max source match entries per frame (fits the RCP's 512 bytes buffer).
     };
 
     enum State
@@ -768,6 +906,12 @@ private:
     otError CheckRadioCapabilities(void);
     otError CheckRcpApiVersion(bool aSupportsRcpApiVersion);
 
+    uint16_t GetSrcMatchEntriesPerFrame(uint32_t aCommand, uint16_t aNumEntries) const;
+    otError  SendSrcMatchShortEntries(uint32_t aCommand, const uint16_t *aShortAddresses, uint16_t aNumEntries);
+    otError  SendSrcMatchExtEntries(uint32_t aCommand, const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+    otError  UpdateSrcMatchShortEntries(uint32_t aCommand, const uint16_t *aShortAddresses, uint16_t aNumEntries);
+    otError  UpdateSrcMatchExtEntries(uint32_t aCommand, const otExtAddress *aExtAddresses, uint16_t aNumEntries);
+
     /**
      * This method triggers a state transfer of the state machine.
      *
@@ -856,6 +1000,24 @@ private:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * This method updates a spinel property of OpenThread transceiver without waiting for the response.
+     *
+     * The response is handled when it is received, a failure is treated as fatal. When the max number of pipelined
+     * requests are in flight, this method first waits for the oldest one to complete. When pipelining is disabled
+     * this method is the same as `Set()`.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack property value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE               Successfully sent the property update.
+     * @retval  OT_ERROR_BUSY               Failed due to no transaction id available.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError SetPipelined(spinel_prop_key_t aKey, const char *aFormat, ...);
+
     spinel_tid_t GetNextTid(void);
     void         FreeTid(spinel_tid_t tid) { mCmdTidsInUse &= ~(1 << tid); }
 
@@ -877,6 +1039,14 @@ private:
                                         const char *      aFormat,
                                         va_list           aArgs);
     otError WaitResponse(void);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    otError RequestPipelinedV(uint32_t          aExpectedCommand,
+                              uint32_t          aCommand,
+                              spinel_prop_key_t aKey,
+                              const char *      aFormat,
+                              va_list           aArgs);
+    otError WaitPipelinedRequests(uint8_t aMaxInFlight);
+#endif
     otError SendReset(void);
     otError SendCommand(uint32_t          command,
                         spinel_prop_key_t key,
@@ -909,6 +1079,16 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    void HandlePipelinedResponse(spinel_tid_t      aTid,
+                                 uint32_t          aCommand,
+                                 spinel_prop_key_t aKey,
+                                 const uint8_t *   aBuffer,
+                                 uint16_t          aLength);
+    void ClearPipelinedRequests(void);
+#endif
+
+    void RecordRcpLatency(uint64_t aSentTimeUs);
 
     void RadioReceive(void);
 
@@ -922,6 +1102,10 @@ private:
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     void RestoreProperties(void);
+    void SaveSrcMatchShortEntry(uint16_t aShortAddress);
+    void SaveSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    void EraseSrcMatchShortEntry(uint16_t aShortAddress);
+    void EraseSrcMatchExtEntry(const otExtAddress &aExtAddress);
 #endif
 
     otInstance *mInstance;
@@ -939,6 +1123,25 @@ private:
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
+    uint64_t          mWaitingSentUs;   ///< The time when the current transaction was sent.
+
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    static_assert(OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT < 14,
+                  "OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT must be less than 14");
+
+    struct PipelinedRequest
+    {
+        uint64_t          mSentUs;          ///< The time when the request was sent.
+        spinel_prop_key_t mKey;             ///< The property key of the request.
+        uint32_t          mExpectedCommand; ///< Expected response command of the request.
+    };
+
+    uint16_t         mPipelinedTids;               ///< Transaction ids of the pipelined requests in flight.
+    uint8_t          mPipelinedInFlight;           ///< Number of the pipelined requests in flight.
+    PipelinedRequest mPipelinedRequests[kNumTids]; ///< Pipelined requests indexed by transaction id.
+#endif
+
+    RcpLatencyHistogram mRcpLatencyHistogram;
 
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -961,8 +1164,9 @@ private:
     State mState;
     bool  mIsPromiscuous : 1;     ///< Promiscuous mode.
     bool  mIsReady : 1;           ///< NCP ready.
-    bool  mSupportsLogStream : 1; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
-    bool  mIsTimeSynced : 1;      ///< Host has calculated the time difference between host and RCP.
+    bool  mSupportsLogStream : 1;     ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
+    bool  mSupportsSrcMatchBatch : 1; ///< RCP supports multiple entries in a source match insert or remove command.
+    bool  mIsTimeSynced : 1;          ///< Host has calculated the time difference between host and RCP.
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
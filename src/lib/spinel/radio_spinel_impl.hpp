@@ -184,6 +184,11 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mWaitingSentUs(0)
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    , mPipelinedTids(0)
+    , mPipelinedInFlight(0)
+#endif
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -194,6 +199,7 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mIsPromiscuous(false)
     , mIsReady(false)
     , mSupportsLogStream(false)
+    , mSupportsSrcMatchBatch(false)
     , mIsTimeSynced(false)
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     , mRcpFailureCount(0)
@@ -217,6 +223,7 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mRadioTimeOffset(0)
 {
     mVersion[0] = '\0';
+    ResetRcpLatencyHistogram();
 }
 
 template <typename InterfaceType, typename ProcessContextType>
@@ -414,6 +421,9 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::CheckRcpApiVersion(bool
         DieNow(OT_EXIT_RADIO_SPINEL_INCOMPATIBLE);
     }
 
+    // Source match insert and remove commands carry multiple entries since RCP API version 4.
+    mSupportsSrcMatchBatch = (rcpApiVersion >= 4);
+
 exit:
     return error;
 }
@@ -569,10 +579,17 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
+        RecordRcpLatency(mWaitingSentUs);
         HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    else if (mPipelinedTids & (1 << SPINEL_HEADER_GET_TID(header)))
+    {
+        HandlePipelinedResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len));
+    }
+#endif
     else if (mTxRadioTid == SPINEL_HEADER_GET_TID(header))
     {
         if (mState == kStateTransmitting)
@@ -825,6 +842,96 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandlePipelinedResponse(spinel_tid_t      aTid,
+                                                                             uint32_t          aCommand,
+                                                                             spinel_prop_key_t aKey,
+                                                                             const uint8_t *   aBuffer,
+                                                                             uint16_t          aLength)
+{
+    const PipelinedRequest &request = mPipelinedRequests[aTid];
+    otError                 error   = OT_ERROR_NONE;
+
+    RecordRcpLatency(request.mSentUs);
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        error = (unpacked > 0) ? SpinelStatusToOtError(status) : OT_ERROR_PARSE;
+    }
+    else if (aKey != request.mKey || aCommand != request.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+    mPipelinedTids &= ~(1 << aTid);
+    mPipelinedInFlight--;
+    FreeTid(aTid);
+
+    if (error != OT_ERROR_NONE)
+    {
+        // The caller of a pipelined request has already moved on, so a failure cannot be reported back to it.
+        mRcpLatencyHistogram.mPipelinedFailures++;
+        otLogCritPlat("Failed to update property %s: %s", spinel_prop_key_to_cstr(request.mKey),
+                      otThreadErrorToString(error));
+        SuccessOrDie(error);
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::ClearPipelinedRequests(void)
+{
+    mPipelinedTids     = 0;
+    mPipelinedInFlight = 0;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+
+template <typename InterfaceType, typename ProcessContextType>
+uint64_t RadioSpinel<InterfaceType, ProcessContextType>::GetPipelinedRequestsEndUs(void) const
+{
+    uint64_t endUs = UINT64_MAX;
+
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    for (spinel_tid_t tid = 1; tid < kNumTids; tid++)
+    {
+        if ((mPipelinedTids & (1 << tid)) && (mPipelinedRequests[tid].mSentUs + kMaxWaitTime * US_PER_MS < endUs))
+        {
+            endUs = mPipelinedRequests[tid].mSentUs + kMaxWaitTime * US_PER_MS;
+        }
+    }
+#endif
+
+    return endUs;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::RecordRcpLatency(uint64_t aSentTimeUs)
+{
+    uint64_t latency = otPlatTimeGet() - aSentTimeUs;
+    uint8_t  bucket  = 0;
+
+    while (bucket < kNumRcpLatencyBuckets - 1 && latency >= (static_cast<uint64_t>(kRcpLatencyFirstBucketUs) << bucket))
+    {
+        bucket++;
+    }
+
+    mRcpLatencyHistogram.mBuckets[bucket]++;
+
+    if (latency > mRcpLatencyHistogram.mMaxLatencyUs)
+    {
+        mRcpLatencyHistogram.mMaxLatencyUs = static_cast<uint32_t>(OT_MIN(latency, static_cast<uint64_t>(UINT32_MAX)));
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::ResetRcpLatencyHistogram(void)
+{
+    memset(&mRcpLatencyHistogram, 0, sizeof(mRcpLatencyHistogram));
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 void RadioSpinel<InterfaceType, ProcessContextType>::HandleValueIs(spinel_prop_key_t aKey,
                                                                    const uint8_t *   aBuffer,
@@ -1084,6 +1191,11 @@ void RadioSpinel<InterfaceType, ProcessContextType>::ProcessRadioStateMachine(vo
         otLogWarnPlat("radio tx timeout");
         HandleRcpTimeout();
     }
+    else if (otPlatTimeGet() >= GetPipelinedRequestsEndUs())
+    {
+        otLogWarnPlat("pipelined request timeout");
+        HandleRcpTimeout();
+    }
 }
 
 template <typename InterfaceType, typename ProcessContextType>
@@ -1128,7 +1240,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetShortAddress(uint16_t
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mShortAddress != aAddress);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
     mShortAddress = aAddress;
 
 exit:
@@ -1144,11 +1256,11 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetMacKey(uint8_t
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_KEY,
-                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                                  SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                              aKeyIdMode, aKeyId, aPrevKey.m8, sizeof(otMacKey), aCurrKey.m8, sizeof(otMacKey),
-                              aNextKey.m8, sizeof(otMacKey)));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_RCP_MAC_KEY,
+                                       SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                           SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                       aKeyIdMode, aKeyId, aPrevKey.m8, sizeof(otMacKey), aCurrKey.m8,
+                                       sizeof(otMacKey), aNextKey.m8, sizeof(otMacKey)));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mKeyIdMode = aKeyIdMode;
@@ -1168,7 +1280,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetMacFrameCounter(uint3
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, aMacFrameCounter));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, aMacFrameCounter));
 
 exit:
     return error;
@@ -1187,7 +1299,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetExtendedAddress(const
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
     mExtendedAddress = aExtAddress;
 
 exit:
@@ -1200,7 +1312,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetPanId(uint16_t aPanId
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mPanId != aPanId);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
     mPanId = aPanId;
 
 exit:
@@ -1210,7 +1322,7 @@ exit:
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::EnableSrcMatch(bool aEnable)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+    return SetPipelined(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
 }
 
 template <typename InterfaceType, typename ProcessContextType>
@@ -1221,17 +1333,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchShortEntry(ui
     SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
-
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
-    {
-        if (mSrcMatchShortEntries[i] == aShortAddress)
-        {
-            ExitNow();
-        }
-    }
-    mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
-    ++mSrcMatchShortEntryCount;
+    SaveSrcMatchShortEntry(aShortAddress);
 #endif
 
 exit:
@@ -1247,17 +1349,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchExtEntry(cons
                       Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
-
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
-    {
-        if (memcmp(aExtAddress.m8, mSrcMatchExtEntries[i].m8, OT_EXT_ADDRESS_SIZE) == 0)
-        {
-            ExitNow();
-        }
-    }
-    mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
-    ++mSrcMatchExtEntryCount;
+    SaveSrcMatchExtEntry(aExtAddress);
 #endif
 
 exit:
@@ -1272,15 +1364,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchShortEntry(
     SuccessOrExit(error = Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
-    {
-        if (mSrcMatchShortEntries[i] == aShortAddress)
-        {
-            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[mSrcMatchShortEntryCount - 1];
-            --mSrcMatchShortEntryCount;
-            break;
-        }
-    }
+    EraseSrcMatchShortEntry(aShortAddress);
 #endif
 
 exit:
@@ -1296,15 +1380,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchExtEntry(co
                       Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
-    {
-        if (memcmp(mSrcMatchExtEntries[i].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0)
-        {
-            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[mSrcMatchExtEntryCount - 1];
-            --mSrcMatchExtEntryCount;
-            break;
-        }
-    }
+    EraseSrcMatchExtEntry(aExtAddress);
 #endif
 
 exit:
@@ -1316,7 +1392,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchShortEntrie
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchShortEntryCount = 0;
@@ -1331,7 +1407,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchExtEntries(
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
+    SuccessOrExit(error = SetPipelined(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchExtEntryCount = 0;
@@ -1341,6 +1417,250 @@ exit:
     return error;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchShortEntries(const uint16_t *aShortAddresses,
+                                                                                uint16_t        aNumEntries)
+{
+    return UpdateSrcMatchShortEntries(SPINEL_CMD_PROP_VALUE_INSERT, aShortAddresses, aNumEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchExtEntries(const otExtAddress *aExtAddresses,
+                                                                              uint16_t            aNumEntries)
+{
+    return UpdateSrcMatchExtEntries(SPINEL_CMD_PROP_VALUE_INSERT, aExtAddresses, aNumEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::RemoveSrcMatchShortEntries(const uint16_t *aShortAddresses,
+                                                                                   uint16_t        aNumEntries)
+{
+    return UpdateSrcMatchShortEntries(SPINEL_CMD_PROP_VALUE_REMOVE, aShortAddresses, aNumEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::RemoveSrcMatchExtEntries(const otExtAddress *aExtAddresses,
+                                                                                 uint16_t            aNumEntries)
+{
+    return UpdateSrcMatchExtEntries(SPINEL_CMD_PROP_VALUE_REMOVE, aExtAddresses, aNumEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SetSrcMatchShortEntries(const uint16_t *aShortAddresses,
+                                                                                uint16_t        aNumEntries)
+{
+    return (aNumEntries == 0) ? ClearSrcMatchShortEntries()
+                              : UpdateSrcMatchShortEntries(SPINEL_CMD_PROP_VALUE_SET, aShortAddresses, aNumEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SetSrcMatchExtEntries(const otExtAddress *aExtAddresses,
+                                                                              uint16_t            aNumEntries)
+{
+    return (aNumEntries == 0) ? ClearSrcMatchExtEntries()
+                              : UpdateSrcMatchExtEntries(SPINEL_CMD_PROP_VALUE_SET, aExtAddresses, aNumEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+uint16_t RadioSpinel<InterfaceType, ProcessContextType>::GetSrcMatchEntriesPerFrame(uint32_t aCommand,
+                                                                                    uint16_t aNumEntries) const
+{
+    uint16_t maxEntries = 1;
+
+    // Setting the list replaces the table with all the entries in the frame on any RCP, while older RCPs only process
+    // the first entry of an insert or remove command.
+    if (aCommand == SPINEL_CMD_PROP_VALUE_SET || mSupportsSrcMatchBatch)
+    {
+        maxEntries = kMaxSrcMatchEntriesPerFrame;
+    }
+
+    return OT_MIN(aNumEntries, maxEntries);
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SendSrcMatchShortEntries(uint32_t        aCommand,
+                                                                                 const uint16_t *aShortAddresses,
+                                                                                 uint16_t        aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t buffer[kMaxSrcMatchEntriesPerFrame * sizeof(uint16_t)];
+
+    assert(aNumEntries <= kMaxSrcMatchEntriesPerFrame);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        Encoding::LittleEndian::WriteUint16(aShortAddresses[i], &buffer[i * sizeof(uint16_t)]);
+    }
+
+    switch (aCommand)
+    {
+    case SPINEL_CMD_PROP_VALUE_SET:
+        error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_DATA_S, buffer,
+                    static_cast<uint32_t>(aNumEntries * sizeof(uint16_t)));
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_INSERT:
+        error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_DATA_S, buffer,
+                       static_cast<uint32_t>(aNumEntries * sizeof(uint16_t)));
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_REMOVE:
+        error = Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_DATA_S, buffer,
+                       static_cast<uint32_t>(aNumEntries * sizeof(uint16_t)));
+        break;
+
+    default:
+        assert(false);
+        break;
+    }
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SendSrcMatchExtEntries(uint32_t            aCommand,
+                                                                               const otExtAddress *aExtAddresses,
+                                                                               uint16_t            aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    assert(aNumEntries <= kMaxSrcMatchEntriesPerFrame);
+
+    switch (aCommand)
+    {
+    case SPINEL_CMD_PROP_VALUE_SET:
+        error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_DATA_S, aExtAddresses[0].m8,
+                    static_cast<uint32_t>(aNumEntries * sizeof(otExtAddress)));
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_INSERT:
+        error = Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_DATA_S, aExtAddresses[0].m8,
+                       static_cast<uint32_t>(aNumEntries * sizeof(otExtAddress)));
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_REMOVE:
+        error = Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_DATA_S, aExtAddresses[0].m8,
+                       static_cast<uint32_t>(aNumEntries * sizeof(otExtAddress)));
+        break;
+
+    default:
+        assert(false);
+        break;
+    }
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::UpdateSrcMatchShortEntries(uint32_t        aCommand,
+                                                                                   const uint16_t *aShortAddresses,
+                                                                                   uint16_t        aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (aNumEntries > 0)
+    {
+        uint16_t numEntries = GetSrcMatchEntriesPerFrame(aCommand, aNumEntries);
+        otError  frameError = SendSrcMatchShortEntries(aCommand, aShortAddresses, numEntries);
+
+        // A remove command removes all the entries in the frame which are in the table.
+        if (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE && frameError == OT_ERROR_NO_ADDRESS)
+        {
+            error = frameError;
+        }
+        else
+        {
+            VerifyOrExit(frameError == OT_ERROR_NONE, error = frameError);
+        }
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            mSrcMatchShortEntryCount = 0;
+        }
+
+        for (uint16_t i = 0; i < numEntries; i++)
+        {
+            if (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE)
+            {
+                EraseSrcMatchShortEntry(aShortAddresses[i]);
+            }
+            else
+            {
+                SaveSrcMatchShortEntry(aShortAddresses[i]);
+            }
+        }
+#endif
+
+        aShortAddresses += numEntries;
+        aNumEntries -= numEntries;
+
+        // The remaining entries are added to the list set by the first frame.
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            aCommand = SPINEL_CMD_PROP_VALUE_INSERT;
+        }
+    }
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::UpdateSrcMatchExtEntries(uint32_t            aCommand,
+                                                                                 const otExtAddress *aExtAddresses,
+                                                                                 uint16_t            aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (aNumEntries > 0)
+    {
+        uint16_t numEntries = GetSrcMatchEntriesPerFrame(aCommand, aNumEntries);
+        otError  frameError = SendSrcMatchExtEntries(aCommand, aExtAddresses, numEntries);
+
+        // A remove command removes all the entries in the frame which are in the table.
+        if (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE && frameError == OT_ERROR_NO_ADDRESS)
+        {
+            error = frameError;
+        }
+        else
+        {
+            VerifyOrExit(frameError == OT_ERROR_NONE, error = frameError);
+        }
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            mSrcMatchExtEntryCount = 0;
+        }
+
+        for (uint16_t i = 0; i < numEntries; i++)
+        {
+            if (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE)
+            {
+                EraseSrcMatchExtEntry(aExtAddresses[i]);
+            }
+            else
+            {
+                SaveSrcMatchExtEntry(aExtAddresses[i]);
+            }
+        }
+#endif
+
+        aExtAddresses += numEntries;
+        aNumEntries -= numEntries;
+
+        // The remaining entries are added to the list set by the first frame.
+        if (aCommand == SPINEL_CMD_PROP_VALUE_SET)
+        {
+            aCommand = SPINEL_CMD_PROP_VALUE_INSERT;
+        }
+    }
+
+exit:
+    return error;
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::GetTransmitPower(int8_t &aPower)
 {
@@ -1637,6 +1957,33 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::Remove(spinel_prop_key_t
     return error;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SetPipelined(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError error;
+    va_list args;
+
+    assert(mWaitingTid == 0);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    do
+    {
+        RecoverFromRcpFailure();
+#endif
+        va_start(args, aFormat);
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+        error = RequestPipelinedV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+#else
+        error = RequestWithExpectedCommandV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+#endif
+        va_end(args);
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    } while (mRcpFailed);
+#endif
+
+    return error;
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::WaitResponse(void)
 {
@@ -1677,11 +2024,19 @@ spinel_tid_t RadioSpinel<InterfaceType, ProcessContextType>::GetNextTid(void)
 {
     spinel_tid_t tid = 0;
 
-    if (((1 << mCmdNextTid) & mCmdTidsInUse) == 0)
+    // Pipelined requests may complete out of the allocation order, so skip over the ids still in use.
+    for (uint8_t i = 1; i < kNumTids; i++)
     {
-        tid         = mCmdNextTid;
+        spinel_tid_t candidate = mCmdNextTid;
+
         mCmdNextTid = SPINEL_GET_NEXT_TID(mCmdNextTid);
-        mCmdTidsInUse |= (1 << tid);
+
+        if (((1 << candidate) & mCmdTidsInUse) == 0)
+        {
+            tid = candidate;
+            mCmdTidsInUse |= (1 << tid);
+            break;
+        }
     }
 
     return tid;
@@ -1764,9 +2119,10 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::RequestV(uint32_t
     }
     else
     {
-        mWaitingKey = aKey;
-        mWaitingTid = tid;
-        error       = WaitResponse();
+        mWaitingKey    = aKey;
+        mWaitingTid    = tid;
+        mWaitingSentUs = otPlatTimeGet();
+        error          = WaitResponse();
     }
 
 exit:
@@ -1835,6 +2191,81 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::RequestWithExpectedComma
     return error;
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::RequestPipelinedV(uint32_t          aExpectedCommand,
+                                                                          uint32_t          aCommand,
+                                                                          spinel_prop_key_t aKey,
+                                                                          const char *      aFormat,
+                                                                          va_list           aArgs)
+{
+    otError      error;
+    spinel_tid_t tid;
+
+    SuccessOrExit(error = WaitPipelinedRequests(OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT - 1));
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    VerifyOrExit(!mRcpFailed);
+#endif
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mPipelinedRequests[tid].mSentUs          = otPlatTimeGet();
+    mPipelinedRequests[tid].mKey             = aKey;
+    mPipelinedRequests[tid].mExpectedCommand = aExpectedCommand;
+    mPipelinedTids |= (1 << tid);
+    mPipelinedInFlight++;
+
+    mRcpLatencyHistogram.mPipelinedRequests++;
+
+    if (mPipelinedInFlight > mRcpLatencyHistogram.mMaxPipelinedInFlight)
+    {
+        mRcpLatencyHistogram.mMaxPipelinedInFlight = mPipelinedInFlight;
+    }
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::WaitPipelinedRequests(uint8_t aMaxInFlight)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (mPipelinedInFlight > aMaxInFlight)
+    {
+        uint64_t end = GetPipelinedRequestsEndUs();
+        uint64_t now = otPlatTimeGet();
+        uint64_t remain;
+
+        if (end <= now)
+        {
+            HandleRcpTimeout();
+            ExitNow();
+        }
+
+        remain = end - now;
+
+        if (mSpinelInterface.WaitForFrame(remain) != OT_ERROR_NONE)
+        {
+            HandleRcpTimeout();
+            ExitNow();
+        }
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+
 template <typename InterfaceType, typename ProcessContextType>
 void RadioSpinel<InterfaceType, ProcessContextType>::HandleTransmitDone(uint32_t          aCommand,
                                                                         spinel_prop_key_t aKey,
@@ -2226,6 +2657,9 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RecoverFromRcpFailure(void)
     mError        = OT_ERROR_NONE;
     mIsReady      = false;
     mIsTimeSynced = false;
+#if OPENTHREAD_SPINEL_CONFIG_PIPELINED_REQUEST_MAX_COUNT > 0
+    ClearPipelinedRequests();
+#endif
 
     if (mResetRadioOnStartup)
     {
@@ -2298,16 +2732,20 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
             Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, networkInfo.GetMacFrameCounter()));
     }
 
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    for (uint16_t i = 0, numEntries; i < mSrcMatchShortEntryCount; i += numEntries)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
+        uint32_t command = (i == 0) ? SPINEL_CMD_PROP_VALUE_SET : SPINEL_CMD_PROP_VALUE_INSERT;
+
+        numEntries = GetSrcMatchEntriesPerFrame(command, static_cast<uint16_t>(mSrcMatchShortEntryCount - i));
+        SuccessOrDie(SendSrcMatchShortEntries(command, &mSrcMatchShortEntries[i], numEntries));
     }
 
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    for (uint16_t i = 0, numEntries; i < mSrcMatchExtEntryCount; i += numEntries)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
+        uint32_t command = (i == 0) ? SPINEL_CMD_PROP_VALUE_SET : SPINEL_CMD_PROP_VALUE_INSERT;
+
+        numEntries = GetSrcMatchEntriesPerFrame(command, static_cast<uint16_t>(mSrcMatchExtEntryCount - i));
+        SuccessOrDie(SendSrcMatchExtEntries(command, &mSrcMatchExtEntries[i], numEntries));
     }
 
     if (mCcaEnergyDetectThresholdSet)
@@ -2348,6 +2786,72 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
 
     CalcRcpTimeOffset();
 }
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::SaveSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            ExitNow();
+        }
+    }
+    mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
+    ++mSrcMatchShortEntryCount;
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::SaveSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    {
+        if (memcmp(aExtAddress.m8, mSrcMatchExtEntries[i].m8, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            ExitNow();
+        }
+    }
+    mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
+    ++mSrcMatchExtEntryCount;
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::EraseSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[mSrcMatchShortEntryCount - 1];
+            --mSrcMatchShortEntryCount;
+            break;
+        }
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::EraseSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    {
+        if (memcmp(mSrcMatchExtEntries[i].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[mSrcMatchExtEntryCount - 1];
+            --mSrcMatchExtEntryCount;
+            break;
+        }
+    }
+}
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
 template <typename InterfaceType, typename ProcessContextType>
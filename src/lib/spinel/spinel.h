@@ -377,7 +377,7 @@
  * Please see section "Spinel definition compatibility guideline" for more details.
  *
  */
-#define SPINEL_RCP_API_VERSION 3
+#define SPINEL_RCP_API_VERSION 4
 
 /**
  * @def SPINEL_MIN_HOST_SUPPORTED_RCP_API_VERSION
@@ -2097,6 +2097,14 @@ enum
     /** Format: `A(S)`
      * Required Capability: SPINEL_CAP_MAC_RAW or SPINEL_CAP_CONFIG_RADIO
      *
+     * Setting the list replaces all the short addresses in the source match
+     * table.
+     *
+     * Since RCP API version 4, the value of an insert or remove command may
+     * contain multiple short addresses (`A(S)`). An insert stops at the first
+     * address which cannot be added. A remove processes all the addresses and
+     * fails if any of them is not in the table.
+     *
      */
     SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES = SPINEL_PROP_MAC_EXT__BEGIN + 4,
 
@@ -2104,6 +2112,13 @@ enum
     /** Format: `A(E)`
      *  Required Capability: SPINEL_CAP_MAC_RAW or SPINEL_CAP_CONFIG_RADIO
      *
+     * Setting the list replaces all the extended addresses in the source match
+     * table.
+     *
+     * Since RCP API version 4, the value of an insert or remove command may
+     * contain multiple extended addresses (`A(E)`), handled the same way as
+     * for `SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES`.
+     *
      */
     SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES = SPINEL_PROP_MAC_EXT__BEGIN + 5,
 
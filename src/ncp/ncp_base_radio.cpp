@@ -295,12 +295,23 @@ exit:
 
 template <> otError NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>(void)
 {
-    otError  error = OT_ERROR_NONE;
-    uint16_t shortAddress;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = mDecoder.ReadUint16(shortAddress));
+    // Remove all the addresses, even if some of them are not in the table
+    do
+    {
+        uint16_t shortAddress;
+        otError  removeError;
+
+        SuccessOrExit(error = mDecoder.ReadUint16(shortAddress));
 
-    error = otLinkRawSrcMatchClearShortEntry(mInstance, shortAddress);
+        removeError = otLinkRawSrcMatchClearShortEntry(mInstance, shortAddress);
+
+        if (removeError != OT_ERROR_NONE)
+        {
+            error = removeError;
+        }
+    } while (mDecoder.GetRemainingLengthInStruct() >= sizeof(uint16_t));
 
 exit:
     return error;
@@ -308,13 +319,23 @@ exit:
 
 template <> otError NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES>(void)
 {
-    otError             error = OT_ERROR_NONE;
-    const otExtAddress *extAddress;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = mDecoder.ReadEui64(extAddress));
-    ;
+    // Remove all the addresses, even if some of them are not in the table
+    do
+    {
+        const otExtAddress *extAddress;
+        otError             removeError;
+
+        SuccessOrExit(error = mDecoder.ReadEui64(extAddress));
 
-    error = otLinkRawSrcMatchClearExtEntry(mInstance, extAddress);
+        removeError = otLinkRawSrcMatchClearExtEntry(mInstance, extAddress);
+
+        if (removeError != OT_ERROR_NONE)
+        {
+            error = removeError;
+        }
+    } while (mDecoder.GetRemainingLengthInStruct() >= sizeof(otExtAddress));
 
 exit:
     return error;
@@ -322,12 +343,15 @@ exit:
 
 template <> otError NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>(void)
 {
-    otError  error = OT_ERROR_NONE;
-    uint16_t shortAddress;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = mDecoder.ReadUint16(shortAddress));
+    do
+    {
+        uint16_t shortAddress;
 
-    error = otLinkRawSrcMatchAddShortEntry(mInstance, shortAddress);
+        SuccessOrExit(error = mDecoder.ReadUint16(shortAddress));
+        SuccessOrExit(error = otLinkRawSrcMatchAddShortEntry(mInstance, shortAddress));
+    } while (mDecoder.GetRemainingLengthInStruct() >= sizeof(uint16_t));
 
 exit:
     return error;
@@ -335,12 +359,15 @@ exit:
 
 template <> otError NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES>(void)
 {
-    otError             error      = OT_ERROR_NONE;
-    const otExtAddress *extAddress = nullptr;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = mDecoder.ReadEui64(extAddress));
+    do
+    {
+        const otExtAddress *extAddress = nullptr;
 
-    error = otLinkRawSrcMatchAddExtEntry(mInstance, extAddress);
+        SuccessOrExit(error = mDecoder.ReadEui64(extAddress));
+        SuccessOrExit(error = otLinkRawSrcMatchAddExtEntry(mInstance, extAddress));
+    } while (mDecoder.GetRemainingLengthInStruct() >= sizeof(otExtAddress));
 
 exit:
     return error;
@@ -172,6 +172,72 @@ const char *otSysGetThreadNetifName(void);
  */
 unsigned int otSysGetThreadNetifIndex(void);
 
+/**
+ * This structure represents the counters of the IPv6 packets exchanged with the Thread network interface.
+ *
+ * The packets per wakeup can be derived as `mTxPackets / mTxWakeups` and `mRxFlushedPackets / mRxFlushWakeups`.
+ *
+ */
+typedef struct otSysNetifCounters
+{
+    uint32_t mTxWakeups;         ///< The number of times the Thread network interface was readable.
+    uint32_t mTxPackets;         ///< The number of packets read from the Thread network interface.
+    uint32_t mTxMaxBatchPackets; ///< The maximum number of packets read on a single wakeup.
+    uint32_t mTxBudgetExhausted; ///< The number of wakeups which read as many packets as allowed.
+    uint32_t mRxPackets;         ///< The number of packets written to the Thread network interface.
+    uint32_t mRxQueuedPackets;   ///< The number of packets queued because the interface was not writable.
+    uint32_t mRxDroppedPackets;  ///< The number of packets dropped because the queue was full or write failed.
+    uint32_t mRxFlushWakeups;    ///< The number of times the queued packets were written on a writable event.
+    uint32_t mRxFlushedPackets;  ///< The number of queued packets written on writable events.
+} otSysNetifCounters;
+
+/**
+ * This function returns the counters of the IPv6 packets exchanged with the Thread network interface.
+ *
+ * @returns A pointer to the Thread network interface counters.
+ *
+ */
+const otSysNetifCounters *otSysGetNetifCounters(void);
+
+/**
+ * This function resets the counters of the IPv6 packets exchanged with the Thread network interface.
+ *
+ */
+void otSysResetNetifCounters(void);
+
+#define OT_SYS_RCP_LATENCY_BUCKETS 12 ///< Number of buckets in `otSysRcpLatencyHistogram`.
+
+/**
+ * This structure represents the round trip latency histogram of the spinel requests sent to the RCP.
+ *
+ * `mBuckets[0]` counts the responses received within 128 microseconds, each following bucket doubles the upper bound
+ * of the previous one and the last bucket counts all the responses slower than 131 milliseconds. Radio frame
+ * transmissions are not included.
+ *
+ */
+typedef struct otSysRcpLatencyHistogram
+{
+    uint32_t mBuckets[OT_SYS_RCP_LATENCY_BUCKETS]; ///< The number of responses per latency bucket.
+    uint32_t mMaxLatency;                          ///< The maximum round trip latency (in microseconds).
+    uint32_t mPipelinedRequests;                   ///< The number of requests sent without waiting for the response.
+    uint32_t mPipelinedFailures;                   ///< The number of pipelined requests which failed.
+    uint8_t  mMaxPipelinedInFlight;                ///< The maximum number of pipelined requests in flight.
+} otSysRcpLatencyHistogram;
+
+/**
+ * This function gets the round trip latency histogram of the spinel requests sent to the RCP.
+ *
+ * @param[out]  aHistogram  A pointer to where the histogram is placed.
+ *
+ */
+void otSysGetRcpLatencyHistogram(otSysRcpLatencyHistogram *aHistogram);
+
+/**
+ * This function resets the round trip latency histogram of the spinel requests sent to the RCP.
+ *
+ */
+void otSysResetRcpLatencyHistogram(void);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
@@ -28,8 +28,14 @@
 
 #include "posix/platform/mainloop.hpp"
 
+#include "platform-posix.h"
+
 #include <assert.h>
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#endif
+
 #include "core/common/code_utils.hpp"
 
 namespace ot {
@@ -58,12 +64,141 @@ void Manager::Remove(Source &aSource)
     aSource.mNext = nullptr;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+static uint32_t EventsToEpollEvents(uint8_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & Descriptor::kEventRead)
+    {
+        events |= EPOLLIN;
+    }
+
+    if (aEvents & Descriptor::kEventWrite)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (aEvents & Descriptor::kEventError)
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+static uint8_t EventsFromEpollEvents(uint32_t aEpollEvents, uint8_t aRegisteredEvents)
+{
+    uint8_t events = 0;
+
+    if (aEpollEvents & EPOLLIN)
+    {
+        events |= Descriptor::kEventRead;
+    }
+
+    if (aEpollEvents & EPOLLOUT)
+    {
+        events |= Descriptor::kEventWrite;
+    }
+
+    if (aEpollEvents & EPOLLPRI)
+    {
+        events |= Descriptor::kEventError;
+    }
+
+    // `EPOLLERR` and `EPOLLHUP` are reported even when not registered.
+    // Like `select()` does, they make the descriptor readable and
+    // writable, so the handler finds the error on its normal read or
+    // write.
+    if (aEpollEvents & (EPOLLERR | EPOLLHUP))
+    {
+        events |= (Descriptor::kEventRead | Descriptor::kEventWrite);
+    }
+
+    events &= aRegisteredEvents;
+
+    if ((events == 0) && (aEpollEvents & (EPOLLERR | EPOLLHUP)))
+    {
+        events = aRegisteredEvents;
+    }
+
+    return events;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+void Manager::Register(Descriptor &aDescriptor, uint8_t aEvents)
+{
+    assert(aEvents != 0);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    {
+        struct epoll_event event;
+
+        if (mEpollFd < 0)
+        {
+            mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+            VerifyOrDie(mEpollFd >= 0, OT_EXIT_ERROR_ERRNO);
+        }
+
+        event.events   = EventsToEpollEvents(aEvents);
+        event.data.ptr = &aDescriptor;
+
+        VerifyOrDie(epoll_ctl(mEpollFd, aDescriptor.IsRegistered() ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, aDescriptor.mFd,
+                              &event) == 0,
+                    OT_EXIT_ERROR_ERRNO);
+    }
+#endif
+
+    if (!aDescriptor.IsRegistered())
+    {
+        aDescriptor.mNext = mDescriptors;
+        mDescriptors      = &aDescriptor;
+    }
+
+    aDescriptor.mEvents = aEvents;
+}
+
+void Manager::Unregister(Descriptor &aDescriptor)
+{
+    VerifyOrExit(aDescriptor.IsRegistered());
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    VerifyOrDie(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aDescriptor.mFd, nullptr) == 0, OT_EXIT_ERROR_ERRNO);
+#endif
+
+    for (Descriptor **pnext = &mDescriptors; *pnext != nullptr; pnext = &(*pnext)->mNext)
+    {
+        if (*pnext == &aDescriptor)
+        {
+            *pnext = aDescriptor.mNext;
+            break;
+        }
+    }
+
+    // The descriptor may still be waiting to be dispatched in the current iteration.
+    for (uint16_t i = 0; i < mNumReadyDescriptors; i++)
+    {
+        if (mReadyDescriptors[i] == &aDescriptor)
+        {
+            mReadyDescriptors[i] = nullptr;
+        }
+    }
+
+    aDescriptor.mEvents = 0;
+    aDescriptor.mNext   = nullptr;
+
+exit:
+    return;
+}
+
 void Manager::Update(otSysMainloopContext &aContext)
 {
     for (Source *source = mSources; source != nullptr; source = source->mNext)
     {
         source->Update(aContext);
     }
+
+    UpdateDescriptors(aContext);
 }
 
 void Manager::Process(const otSysMainloopContext &aContext)
@@ -72,8 +207,142 @@ void Manager::Process(const otSysMainloopContext &aContext)
     {
         source->Process(aContext);
     }
+
+    ProcessDescriptors(aContext);
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+void Manager::UpdateDescriptors(otSysMainloopContext &aContext)
+{
+    // All the registered descriptors are waited for through the epoll file descriptor.
+
+    VerifyOrExit(mDescriptors != nullptr);
+
+    FD_SET(mEpollFd, &aContext.mReadFdSet);
+
+    if (aContext.mMaxFd < mEpollFd)
+    {
+        aContext.mMaxFd = mEpollFd;
+    }
+
+exit:
+    return;
+}
+
+void Manager::ProcessDescriptors(const otSysMainloopContext &aContext)
+{
+    struct epoll_event events[kMaxReadyDescriptors];
+    int                numEvents;
+
+    VerifyOrExit(mDescriptors != nullptr && FD_ISSET(mEpollFd, &aContext.mReadFdSet));
+
+    numEvents = epoll_wait(mEpollFd, events, kMaxReadyDescriptors, /* aTimeout */ 0);
+
+    if (numEvents < 0)
+    {
+        VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        mReadyDescriptors[i] = static_cast<Descriptor *>(events[i].data.ptr);
+        mReadyEvents[i]      = EventsFromEpollEvents(events[i].events, mReadyDescriptors[i]->mEvents);
+    }
+
+    mNumReadyDescriptors = static_cast<uint16_t>(numEvents);
+
+    for (uint16_t i = 0; i < mNumReadyDescriptors; i++)
+    {
+        if (mReadyDescriptors[i] != nullptr)
+        {
+            mReadyDescriptors[i]->mHandler(*mReadyDescriptors[i], mReadyEvents[i]);
+        }
+    }
+
+    mNumReadyDescriptors = 0;
+
+exit:
+    return;
+}
+
+#else // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+void Manager::UpdateDescriptors(otSysMainloopContext &aContext)
+{
+    for (Descriptor *descriptor = mDescriptors; descriptor != nullptr; descriptor = descriptor->mNext)
+    {
+        if (descriptor->mEvents & Descriptor::kEventRead)
+        {
+            FD_SET(descriptor->mFd, &aContext.mReadFdSet);
+        }
+
+        if (descriptor->mEvents & Descriptor::kEventWrite)
+        {
+            FD_SET(descriptor->mFd, &aContext.mWriteFdSet);
+        }
+
+        if (descriptor->mEvents & Descriptor::kEventError)
+        {
+            FD_SET(descriptor->mFd, &aContext.mErrorFdSet);
+        }
+
+        if (aContext.mMaxFd < descriptor->mFd)
+        {
+            aContext.mMaxFd = descriptor->mFd;
+        }
+    }
+}
+
+void Manager::ProcessDescriptors(const otSysMainloopContext &aContext)
+{
+    // The ready descriptors are collected first since the handlers may unregister descriptors.
+
+    for (Descriptor *descriptor = mDescriptors; descriptor != nullptr; descriptor = descriptor->mNext)
+    {
+        uint8_t events = 0;
+
+        if ((descriptor->mEvents & Descriptor::kEventRead) && FD_ISSET(descriptor->mFd, &aContext.mReadFdSet))
+        {
+            events |= Descriptor::kEventRead;
+        }
+
+        if ((descriptor->mEvents & Descriptor::kEventWrite) && FD_ISSET(descriptor->mFd, &aContext.mWriteFdSet))
+        {
+            events |= Descriptor::kEventWrite;
+        }
+
+        if ((descriptor->mEvents & Descriptor::kEventError) && FD_ISSET(descriptor->mFd, &aContext.mErrorFdSet))
+        {
+            events |= Descriptor::kEventError;
+        }
+
+        if (events != 0)
+        {
+            mReadyDescriptors[mNumReadyDescriptors] = descriptor;
+            mReadyEvents[mNumReadyDescriptors]      = events;
+
+            if (++mNumReadyDescriptors == kMaxReadyDescriptors)
+            {
+                break;
+            }
+        }
+    }
+
+    for (uint16_t i = 0; i < mNumReadyDescriptors; i++)
+    {
+        if (mReadyDescriptors[i] != nullptr)
+        {
+            mReadyDescriptors[i]->mHandler(*mReadyDescriptors[i], mReadyEvents[i]);
+        }
+    }
+
+    mNumReadyDescriptors = 0;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
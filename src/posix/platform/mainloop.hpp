@@ -34,6 +34,10 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
+#include <stdint.h>
+
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -69,6 +73,86 @@ private:
     Source *mNext = nullptr;
 };
 
+/**
+ * This class represents a file descriptor which stays registered in the mainloop.
+ *
+ * Unlike a `Source`, a registered `Descriptor` is not added to the mainloop context on every iteration and its handler
+ * is only called when the file descriptor is ready.
+ *
+ */
+class Descriptor
+{
+    friend class Manager;
+
+public:
+    /**
+     * Event flags.
+     *
+     */
+    enum : uint8_t
+    {
+        kEventRead  = 1 << 0, ///< The file descriptor is readable.
+        kEventWrite = 1 << 1, ///< The file descriptor is writable.
+        kEventError = 1 << 2, ///< An error condition is pending on the file descriptor.
+    };
+
+    /**
+     * This function pointer is called when the file descriptor is ready.
+     *
+     * @param[in]   aDescriptor     A reference to the descriptor.
+     * @param[in]   aEvents         The ready events (bitwise OR of `kEvent*` flags).
+     *
+     */
+    typedef void (*Handler)(Descriptor &aDescriptor, uint8_t aEvents);
+
+    /**
+     * This constructor initializes the descriptor.
+     *
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aHandler    The handler called when the file descriptor is ready.
+     * @param[in]   aContext    A pointer to arbitrary context information.
+     *
+     */
+    Descriptor(int aFd, Handler aHandler, void *aContext)
+        : mFd(aFd)
+        , mHandler(aHandler)
+        , mContext(aContext)
+    {
+    }
+
+    /**
+     * This method returns the file descriptor.
+     *
+     * @returns The file descriptor.
+     *
+     */
+    int GetFd(void) const { return mFd; }
+
+    /**
+     * This method returns the context information.
+     *
+     * @returns The pointer to the context information.
+     *
+     */
+    void *GetContext(void) const { return mContext; }
+
+    /**
+     * This method indicates whether the descriptor is registered in the mainloop.
+     *
+     * @retval TRUE     The descriptor is registered.
+     * @retval FALSE    The descriptor is not registered.
+     *
+     */
+    bool IsRegistered(void) const { return mEvents != 0; }
+
+private:
+    int         mFd;
+    Handler     mHandler;
+    void *      mContext;
+    uint8_t     mEvents = 0;
+    Descriptor *mNext   = nullptr;
+};
+
 /**
  * This class manages mainloop.
  *
@@ -108,6 +192,29 @@ public:
      */
     void Remove(Source &aSource);
 
+    /**
+     * This method registers a descriptor in the mainloop, or updates the events of a registered descriptor.
+     *
+     * The descriptor stays registered until `Unregister()` is called, which MUST happen before its file descriptor is
+     * closed.
+     *
+     * @param[in]   aDescriptor     A reference to the descriptor.
+     * @param[in]   aEvents         The events to wait for (bitwise OR of `Descriptor::kEvent*` flags, non-zero).
+     *
+     */
+    void Register(Descriptor &aDescriptor, uint8_t aEvents);
+
+    /**
+     * This method unregisters a descriptor from the mainloop.
+     *
+     * This method may be called from a descriptor handler, including for other descriptors ready in the same
+     * iteration. It does nothing if the descriptor is not registered.
+     *
+     * @param[in]   aDescriptor     A reference to the descriptor.
+     *
+     */
+    void Unregister(Descriptor &aDescriptor);
+
     /**
      * This function returns the Mainloop singleton.
      *
@@ -117,7 +224,22 @@ public:
     static Manager &Get(void);
 
 private:
-    Source *mSources = nullptr;
+    enum : uint16_t
+    {
+        kMaxReadyDescriptors = 64, ///< Max number of ready descriptors dispatched in one iteration.
+    };
+
+    void UpdateDescriptors(otSysMainloopContext &aContext);
+    void ProcessDescriptors(const otSysMainloopContext &aContext);
+
+    Source *    mSources     = nullptr;
+    Descriptor *mDescriptors = nullptr;
+    Descriptor *mReadyDescriptors[kMaxReadyDescriptors];
+    uint8_t     mReadyEvents[kMaxReadyDescriptors];
+    uint16_t    mNumReadyDescriptors = 0;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    int mEpollFd = -1;
+#endif
 };
 
 } // namespace Mainloop
@@ -162,6 +162,18 @@ unsigned int otSysGetThreadNetifIndex(void)
     return gNetifIndex;
 }
 
+static otSysNetifCounters sNetifCounters;
+
+const otSysNetifCounters *otSysGetNetifCounters(void)
+{
+    return &sNetifCounters;
+}
+
+void otSysResetNetifCounters(void)
+{
+    memset(&sNetifCounters, 0, sizeof(sNetifCounters));
+}
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 #include "posix/platform/ip6_utils.hpp"
 
@@ -267,7 +279,11 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t   kMaxIp6Size   = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint16_t kMaxBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_BATCH_SIZE;
+
+static otMessageQueue sRxQueue;           ///< Packets waiting for the TUN device to become writable.
+static uint16_t       sRxQueueLength = 0; ///< Number of packets in `sRxQueue`.
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -749,25 +765,32 @@ void platformNetifStateChange(otInstance *aInstance, otChangedFlags aFlags)
 #endif
 }
 
-static void processReceive(otMessage *aMessage, void *aContext)
+/**
+ * This function writes an IPv6 packet from the Thread network to the TUN device.
+ *
+ * @param[in]  aMessage  The IPv6 packet. It is not freed by this function.
+ *
+ * @retval OT_ERROR_NONE     The packet was written.
+ * @retval OT_ERROR_BUSY     The TUN device is not writable now, the packet should be written again later.
+ * @retval OT_ERROR_NO_BUFS  The packet is too large.
+ * @retval OT_ERROR_FAILED   Failed to write the packet.
+ *
+ */
+static otError writeTunPacket(otMessage *aMessage)
 {
-    OT_UNUSED_VARIABLE(aContext);
-
     char     packet[kMaxIp6Size + 4];
     otError  error     = OT_ERROR_NONE;
     uint16_t length    = otMessageGetLength(aMessage);
     size_t   offset    = 0;
     uint16_t maxLength = sizeof(packet) - 4;
+    ssize_t  rval;
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
     offset += 4;
 #endif
 
-    assert(sInstance == aContext);
     assert(length <= kMaxIp6Size);
 
-    VerifyOrExit(sTunFd > 0);
-
     VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
@@ -783,10 +806,88 @@ static void processReceive(otMessage *aMessage, void *aContext)
     length += 4;
 #endif
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    rval = write(sTunFd, packet, length);
+    if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        ExitNow(error = OT_ERROR_BUSY);
+    }
+
+    VerifyOrExit(rval == length, perror("write"); error = OT_ERROR_FAILED);
+
+    sNetifCounters.mRxPackets++;
+
+exit:
+    return error;
+}
+
+/**
+ * This function writes the queued IPv6 packets to the TUN device, until it is not writable anymore.
+ *
+ * @returns The number of packets written.
+ *
+ */
+static uint16_t flushReceiveQueue(void)
+{
+    otMessage *message;
+    uint16_t   count = 0;
+
+    while ((message = otMessageQueueGetHead(&sRxQueue)) != nullptr)
+    {
+        otError error = writeTunPacket(message);
+
+        if (error == OT_ERROR_BUSY)
+        {
+            break;
+        }
+
+        otMessageQueueDequeue(&sRxQueue, message);
+        sRxQueueLength--;
+        otMessageFree(message);
+
+        if (error == OT_ERROR_NONE)
+        {
+            count++;
+        }
+        else
+        {
+            sNetifCounters.mRxDroppedPackets++;
+            otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
+        }
+    }
+
+    return count;
+}
+
+static void processReceive(otMessage *aMessage, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    otError error = OT_ERROR_NONE;
+
+    assert(sInstance == aContext);
+
+    VerifyOrExit(sTunFd > 0);
+
+    // Keep the order of the packets: write directly only when no earlier packet is waiting for the TUN device.
+    if (sRxQueueLength == 0)
+    {
+        error = writeTunPacket(aMessage);
+        VerifyOrExit(error == OT_ERROR_BUSY);
+    }
+
+    VerifyOrExit(sRxQueueLength < kMaxBatchSize, error = OT_ERROR_NO_BUFS);
+
+    otMessageQueueEnqueue(&sRxQueue, aMessage);
+    sRxQueueLength++;
+    sNetifCounters.mRxQueuedPackets++;
+    aMessage = nullptr;
+    error    = OT_ERROR_NONE;
 
 exit:
-    otMessageFree(aMessage);
+    if (aMessage != nullptr)
+    {
+        otMessageFree(aMessage);
+    }
 
     if (error == OT_ERROR_NONE)
     {
@@ -794,11 +895,21 @@ exit:
     }
     else
     {
+        sNetifCounters.mRxDroppedPackets++;
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+/**
+ * This function reads an IPv6 packet from the TUN device and sends it to the Thread network.
+ *
+ * @retval OT_ERROR_NONE          A packet was read and sent.
+ * @retval OT_ERROR_NOT_FOUND     No packet is pending on the TUN device.
+ * @retval OT_ERROR_NO_BUFS       A packet was read but could not be sent due to lack of message buffers.
+ * @retval OT_ERROR_FAILED        Failed to read from the TUN device.
+ *
+ */
+static otError transmitTunPacket(otInstance *aInstance)
 {
     otMessage *message = nullptr;
     ssize_t    rval;
@@ -806,11 +917,16 @@ static void processTransmit(otInstance *aInstance)
     otError    error  = OT_ERROR_NONE;
     size_t     offset = 0;
 
-    assert(sInstance == aInstance);
-
     rval = read(sTunFd, packet, sizeof(packet));
+    if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        ExitNow(error = OT_ERROR_NOT_FOUND);
+    }
+
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
+    sNetifCounters.mTxPackets++;
+
     {
         otMessageSettings settings;
 
@@ -849,10 +965,50 @@ exit:
     {
         otLogInfoPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
-    else
+    else if (error != OT_ERROR_NOT_FOUND)
     {
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    uint16_t count = 0;
+
+    assert(sInstance == aInstance);
+
+    // Drain the packets pending on the TUN device (up to `kMaxBatchSize`) instead of waiting for a new wakeup per
+    // packet. Stop early when there are no message buffers left, the remaining packets are read on the next wakeup.
+    while (count < kMaxBatchSize)
+    {
+        otError error = transmitTunPacket(aInstance);
+
+        if (error == OT_ERROR_NOT_FOUND || error == OT_ERROR_FAILED)
+        {
+            break;
+        }
+
+        count++;
+
+        if (error == OT_ERROR_NO_BUFS)
+        {
+            break;
+        }
+    }
+
+    sNetifCounters.mTxWakeups++;
+
+    if (count > sNetifCounters.mTxMaxBatchPackets)
+    {
+        sNetifCounters.mTxMaxBatchPackets = count;
+    }
+
+    if (count == kMaxBatchSize)
+    {
+        sNetifCounters.mTxBudgetExhausted++;
+    }
 }
 
 static void logAddrEvent(bool isAdd, bool isUnicast, struct sockaddr_in6 &addr6, otError error)
@@ -1353,6 +1509,10 @@ exit:
 
 void platformNetifDeinit(void)
 {
+    // The queued messages belong to the OpenThread instance, which is already finalized at this point.
+    otMessageQueueInit(&sRxQueue);
+    sRxQueueLength = 0;
+
     if (sTunFd != -1)
     {
         close(sTunFd);
@@ -1704,6 +1864,8 @@ void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
 
     otIp6SetReceiveFilterEnabled(aInstance, true);
     otIcmp6SetEchoMode(aInstance, OT_ICMP6_ECHO_HANDLER_DISABLED);
+    otMessageQueueInit(&sRxQueue);
+    sRxQueueLength = 0;
     otIp6SetReceiveCallback(aInstance, processReceive, aInstance);
     otIp6SetAddressCallback(aInstance, processAddressChange, aInstance);
 #if OPENTHREAD_POSIX_MULTICAST_PROMISCUOUS_REQUIRED
@@ -1715,8 +1877,6 @@ void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
 
 void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd)
 {
-    OT_UNUSED_VARIABLE(aWriteFdSet);
-
     VerifyOrExit(gNetifIndex > 0);
 
     assert(sTunFd >= 0);
@@ -1725,6 +1885,12 @@ void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *a
 
     FD_SET(sTunFd, aReadFdSet);
     FD_SET(sTunFd, aErrorFdSet);
+
+    if (sRxQueueLength > 0)
+    {
+        FD_SET(sTunFd, aWriteFdSet);
+    }
+
     FD_SET(sNetlinkFd, aReadFdSet);
     FD_SET(sNetlinkFd, aErrorFdSet);
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
@@ -1754,7 +1920,6 @@ exit:
 
 void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, const fd_set *aErrorFdSet)
 {
-    OT_UNUSED_VARIABLE(aWriteFdSet);
     VerifyOrExit(gNetifIndex > 0);
 
     if (FD_ISSET(sTunFd, aErrorFdSet))
@@ -1777,6 +1942,12 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
     }
 #endif
 
+    if (FD_ISSET(sTunFd, aWriteFdSet))
+    {
+        sNetifCounters.mRxFlushWakeups++;
+        sNetifCounters.mRxFlushedPackets += flushReceiveQueue();
+    }
+
     if (FD_ISSET(sTunFd, aReadFdSet))
     {
         processTransmit(sInstance);
@@ -187,6 +187,44 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_EXTERNAL_ROUTE_NUM 8
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAX_UDP_SOCKETS
+ *
+ * This macro defines the max number of platform UDP sockets open at the same time. One is used by every open
+ * OpenThread UDP socket, including the ones opened through the `otUdp*` APIs.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAX_UDP_SOCKETS
+#define OPENTHREAD_POSIX_CONFIG_MAX_UDP_SOCKETS 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_BATCH_SIZE
+ *
+ * This macro defines the max number of IPv6 packets read from the Thread network interface on a single wakeup, and the
+ * max number of IPv6 packets queued for the Thread network interface while it is not writable.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_BATCH_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to wait for the descriptors registered in the mainloop with epoll, which adds a single file descriptor
+ * to the `select()` file descriptor sets. Otherwise the registered descriptors are added to the file descriptor sets
+ * on every mainloop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#ifdef __linux__
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 1
+#else
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+#endif
+
 #ifdef __APPLE__
 
 /**
@@ -299,6 +299,11 @@ void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMax
         }
     }
 
+    if (sRadioSpinel.GetPipelinedRequestsEndUs() < deadline)
+    {
+        deadline = sRadioSpinel.GetPipelinedRequestsEndUs();
+    }
+
     if (now < deadline)
     {
         uint64_t remain = deadline - now;
@@ -396,6 +401,85 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
     SuccessOrDie(sRadioSpinel.ClearSrcMatchExtEntries());
 }
 
+static void ReverseExtAddresses(const otExtAddress *aExtAddresses, uint16_t aNumEntries, otExtAddress *aReversed)
+{
+    for (uint16_t entry = 0; entry < aNumEntries; entry++)
+    {
+        for (size_t i = 0; i < sizeof(otExtAddress); i++)
+        {
+            aReversed[entry].m8[i] = aExtAddresses[entry].m8[sizeof(otExtAddress) - 1 - i];
+        }
+    }
+}
+
+otError otPlatRadioAddSrcMatchShortEntries(otInstance *          aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.AddSrcMatchShortEntries(aShortAddresses, aNumEntries);
+}
+
+otError otPlatRadioAddSrcMatchExtEntries(otInstance *aInstance, const otExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    otError      error = OT_ERROR_NONE;
+    otExtAddress addrs[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+
+    VerifyOrExit(aNumEntries <= OT_ARRAY_LENGTH(addrs), error = OT_ERROR_NO_BUFS);
+    ReverseExtAddresses(aExtAddresses, aNumEntries, addrs);
+    error = sRadioSpinel.AddSrcMatchExtEntries(addrs, aNumEntries);
+
+exit:
+    return error;
+}
+
+otError otPlatRadioRemoveSrcMatchShortEntries(otInstance *          aInstance,
+                                              const otShortAddress *aShortAddresses,
+                                              uint16_t              aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.RemoveSrcMatchShortEntries(aShortAddresses, aNumEntries);
+}
+
+otError otPlatRadioRemoveSrcMatchExtEntries(otInstance *        aInstance,
+                                            const otExtAddress *aExtAddresses,
+                                            uint16_t            aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    otError      error = OT_ERROR_NONE;
+    otExtAddress addrs[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+
+    VerifyOrExit(aNumEntries <= OT_ARRAY_LENGTH(addrs), error = OT_ERROR_NO_ADDRESS);
+    ReverseExtAddresses(aExtAddresses, aNumEntries, addrs);
+    error = sRadioSpinel.RemoveSrcMatchExtEntries(addrs, aNumEntries);
+
+exit:
+    return error;
+}
+
+otError otPlatRadioSetSrcMatchShortEntries(otInstance *          aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.SetSrcMatchShortEntries(aShortAddresses, aNumEntries);
+}
+
+otError otPlatRadioSetSrcMatchExtEntries(otInstance *aInstance, const otExtAddress *aExtAddresses, uint16_t aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    otError      error = OT_ERROR_NONE;
+    otExtAddress addrs[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+
+    VerifyOrExit(aNumEntries <= OT_ARRAY_LENGTH(addrs), error = OT_ERROR_NO_BUFS);
+    ReverseExtAddresses(aExtAddresses, aNumEntries, addrs);
+    error = sRadioSpinel.SetSrcMatchExtEntries(addrs, aNumEntries);
+
+exit:
+    return error;
+}
+
 otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -625,3 +709,20 @@ otError otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChannel, uint32_t a
     OT_UNUSED_VARIABLE(aDuration);
     return OT_ERROR_NOT_IMPLEMENTED;
 }
+
+void otSysGetRcpLatencyHistogram(otSysRcpLatencyHistogram *aHistogram)
+{
+    static_assert(OT_SYS_RCP_LATENCY_BUCKETS == decltype(sRadioSpinel)::kNumRcpLatencyBuckets,
+                  "OT_SYS_RCP_LATENCY_BUCKETS does not match the RCP latency histogram");
+
+    memcpy(aHistogram->mBuckets, sRadioSpinel.GetRcpLatencyHistogram().mBuckets, sizeof(aHistogram->mBuckets));
+    aHistogram->mMaxLatency           = sRadioSpinel.GetRcpLatencyHistogram().mMaxLatencyUs;
+    aHistogram->mPipelinedRequests    = sRadioSpinel.GetRcpLatencyHistogram().mPipelinedRequests;
+    aHistogram->mPipelinedFailures    = sRadioSpinel.GetRcpLatencyHistogram().mPipelinedFailures;
+    aHistogram->mMaxPipelinedInFlight = sRadioSpinel.GetRcpLatencyHistogram().mMaxPipelinedInFlight;
+}
+
+void otSysResetRcpLatencyHistogram(void)
+{
+    sRadioSpinel.ResetRcpLatencyHistogram();
+}
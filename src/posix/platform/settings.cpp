@@ -40,8 +40,11 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <openthread/platform/misc.h>
@@ -56,9 +59,45 @@
 
 static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
 
+/*
+ * The settings file is a log of records, each starting with a 16-bit key followed by a 16-bit length:
+ *
+ *   - `[key][length][value]` adds a value for the key (`length` is less than `kReplaceMarker`). A settings file
+ *     which only contains such records is the same as the one written by the previous (non-log) implementation.
+ *   - `[key][kReplaceMarker][length][value]` deletes all the values of the key and then adds the given value.
+ *   - `[key][kDeleteMarker][index]` deletes the value at `index` (or all the values if it is `kDeleteAllIndex`).
+ *
+ * The live records are indexed in memory when the file is loaded, so lookups do not read the file and updates are
+ * appended to the file. The file is compacted (the live values are copied to a swap file which then replaces the
+ * settings file) once the deleted records take more space than the live ones, and always when the settings are
+ * deinitialized, so that a cleanly closed settings file only contains `[key][length][value]` records and can still
+ * be read by the previous implementation. A record which was not completely written (e.g., due to a crash) is
+ * dropped when the file is loaded.
+ *
+ */
+static const uint16_t kReplaceMarker         = 0xfffe;
+static const uint16_t kDeleteMarker          = 0xffff;
+static const uint16_t kDeleteAllIndex        = 0xffff;
+static const off_t    kMinCompactGarbageSize = 4096;
+
+struct SettingsRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    off_t    mOffset; // The offset of the value in the settings file.
+};
+
 static int sSettingsFd = -1;
 
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd);
+// The live records, in the order they were added.
+static SettingsRecord *sRecords    = nullptr;
+static size_t          sNumRecords = 0;
+static size_t          sMaxRecords = 0;
+
+// The size of the settings file (the end of the log) and the size the
+// live records would take in a compacted file.
+static off_t sFileSize = 0;
+static off_t sLiveSize = 0;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 static const uint16_t *sKeys       = nullptr;
@@ -155,19 +194,222 @@ static void swapPersist(otInstance *aInstance, int aFd)
     sSettingsFd = aFd;
 }
 
-static void swapDiscard(otInstance *aInstance, int aFd)
+static void indexAdd(uint16_t aKey, uint16_t aLength, off_t aOffset)
 {
-    char swapFileName[kMaxFileNameSize];
+    if (sNumRecords == sMaxRecords)
+    {
+        size_t          maxRecords = (sMaxRecords == 0) ? 16 : 2 * sMaxRecords;
+        SettingsRecord *records    = static_cast<SettingsRecord *>(realloc(sRecords, maxRecords * sizeof(*records)));
+
+        VerifyOrDie(records != nullptr, OT_EXIT_FAILURE);
+        sRecords    = records;
+        sMaxRecords = maxRecords;
+    }
+
+    sRecords[sNumRecords].mKey    = aKey;
+    sRecords[sNumRecords].mLength = aLength;
+    sRecords[sNumRecords].mOffset = aOffset;
+    sNumRecords++;
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(aInstance, swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+    sLiveSize += sizeof(aKey) + sizeof(aLength) + aLength;
 }
 
-void otPlatSettingsInit(otInstance *aInstance)
+/**
+ * This function finds a live record in the index.
+ *
+ * @param[in]  aKey    The key associated with the requested setting.
+ * @param[in]  aIndex  The index of the value among the values of @p aKey.
+ *
+ * @returns A pointer to the record, or nullptr if not found.
+ *
+ */
+static SettingsRecord *indexFind(uint16_t aKey, int aIndex)
+{
+    SettingsRecord *record = nullptr;
+
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        if (sRecords[i].mKey == aKey && aIndex-- == 0)
+        {
+            ExitNow(record = &sRecords[i]);
+        }
+    }
+
+exit:
+    return record;
+}
+
+/**
+ * This function removes live records from the index.
+ *
+ * @param[in]  aKey    The key associated with the setting.
+ * @param[in]  aIndex  The index of the value to be removed. If set to -1, all values for this @p aKey are removed.
+ *
+ * @retval OT_ERROR_NONE        The given key and index was found and removed.
+ * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the index.
+ *
+ */
+static otError indexRemove(uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+    size_t  count = 0;
+    int     index = 0;
+
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        const SettingsRecord &record = sRecords[i];
+
+        if (record.mKey == aKey && (aIndex == -1 || aIndex == index++))
+        {
+            sLiveSize -= sizeof(record.mKey) + sizeof(record.mLength) + record.mLength;
+            error = OT_ERROR_NONE;
+            continue;
+        }
+
+        sRecords[count++] = record;
+    }
+
+    sNumRecords = count;
+
+    return error;
+}
+
+static bool readUint16(off_t aOffset, uint16_t &aValue)
+{
+    return pread(sSettingsFd, &aValue, sizeof(aValue), aOffset) == sizeof(aValue);
+}
+
+/**
+ * This function loads the settings file and builds the index of the live records.
+ *
+ * An incomplete record at the end of the file (e.g., due to a crash while it was written) is truncated.
+ *
+ */
+static void settingsLoad(void)
+{
+    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
+    off_t       offset = 0;
+
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
+
+    sNumRecords = 0;
+    sLiveSize   = 0;
+
+    while (offset < size)
+    {
+        uint16_t key;
+        uint16_t length;
+        off_t    valueOffset = offset + sizeof(key) + sizeof(length);
+
+        VerifyOrExit(readUint16(offset, key) && readUint16(offset + sizeof(key), length));
+
+        if (length == kDeleteMarker)
+        {
+            uint16_t index;
+
+            VerifyOrExit(readUint16(valueOffset, index));
+            IgnoreError(indexRemove(key, (index == kDeleteAllIndex) ? -1 : index));
+            offset = valueOffset + sizeof(index);
+            continue;
+        }
+
+        if (length == kReplaceMarker)
+        {
+            VerifyOrExit(readUint16(valueOffset, length));
+            valueOffset += sizeof(length);
+            VerifyOrExit(valueOffset + length <= size);
+            IgnoreError(indexRemove(key, -1));
+        }
+
+        VerifyOrExit(valueOffset + length <= size);
+        indexAdd(key, length, valueOffset);
+        offset = valueOffset + length;
+    }
+
+exit:
+    if (offset != size)
+    {
+        otLogWarnPlat("Dropped incomplete record at offset %ld in settings file", static_cast<long>(offset));
+        VerifyOrDie(ftruncate(sSettingsFd, offset) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    sFileSize = offset;
+}
+
+/**
+ * This function rewrites the settings file with only the live records.
+ *
+ */
+static void settingsCompact(otInstance *aInstance)
+{
+    int   swapFd = swapOpen(aInstance);
+    off_t offset = 0;
+
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        SettingsRecord &record = sRecords[i];
+
+        VerifyOrDie(write(swapFd, &record.mKey, sizeof(record.mKey)) == sizeof(record.mKey) &&
+                        write(swapFd, &record.mLength, sizeof(record.mLength)) == sizeof(record.mLength),
+                    OT_EXIT_FAILURE);
+
+        VerifyOrDie(lseek(sSettingsFd, record.mOffset, SEEK_SET) == record.mOffset, OT_EXIT_ERROR_ERRNO);
+        swapWrite(aInstance, swapFd, record.mLength);
+
+        offset += sizeof(record.mKey) + sizeof(record.mLength);
+        record.mOffset = offset;
+        offset += record.mLength;
+    }
+
+    swapPersist(aInstance, swapFd);
+
+    assert(offset == sLiveSize);
+    sFileSize = offset;
+}
+
+static void settingsCompactIfNeeded(otInstance *aInstance)
 {
-    otError error = OT_ERROR_NONE;
+    off_t garbageSize = sFileSize - sLiveSize;
+
+    if (garbageSize >= kMinCompactGarbageSize && garbageSize > sLiveSize)
+    {
+        settingsCompact(aInstance);
+    }
+}
 
+/**
+ * This function appends a record to the settings file.
+ *
+ * @param[in]  aHeader        A pointer to the record header (16-bit words).
+ * @param[in]  aHeaderLength  The length of the header in bytes.
+ * @param[in]  aValue         A pointer to the value of the record (can be nullptr if @p aValueLength is zero).
+ * @param[in]  aValueLength   The length of the value in bytes.
+ *
+ * @returns The offset of the value in the settings file.
+ *
+ */
+static off_t settingsAppend(const uint16_t *aHeader, size_t aHeaderLength, const uint8_t *aValue, uint16_t aValueLength)
+{
+    struct iovec iov[2];
+    off_t        valueOffset = sFileSize + static_cast<off_t>(aHeaderLength);
+    ssize_t      length      = static_cast<ssize_t>(aHeaderLength + aValueLength);
+
+    iov[0].iov_base = const_cast<uint16_t *>(aHeader);
+    iov[0].iov_len  = aHeaderLength;
+    iov[1].iov_base = const_cast<uint8_t *>(aValue);
+    iov[1].iov_len  = aValueLength;
+
+    VerifyOrDie(lseek(sSettingsFd, sFileSize, SEEK_SET) == sFileSize, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(writev(sSettingsFd, iov, 2) == length, OT_EXIT_FAILURE);
+    VerifyOrDie(fsync(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+
+    sFileSize += length;
+
+    return valueOffset;
+}
+
+void otPlatSettingsInit(otInstance *aInstance)
+{
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     otPosixSecureSettingsInit(aInstance);
 #endif
@@ -190,48 +432,39 @@ void otPlatSettingsInit(otInstance *aInstance)
 
     VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-    }
-
-exit:
-    if (error == OT_ERROR_PARSE)
-    {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
-    }
+    settingsLoad();
+    settingsCompactIfNeeded(aInstance);
 }
 
 void otPlatSettingsDeinit(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     otPosixSecureSettingsDeinit(aInstance);
 #endif
 
     assert(sSettingsFd != -1);
+
+    // Leave the file in the plain layout (without replace or delete records).
+    if (sFileSize != sLiveSize)
+    {
+        settingsCompact(aInstance);
+    }
+
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
+
+    free(sRecords);
+    sRecords    = nullptr;
+    sNumRecords = 0;
+    sMaxRecords = 0;
 }
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    otError               error = OT_ERROR_NONE;
+    const SettingsRecord *record;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -240,59 +473,30 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint
     }
 #endif
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    record = indexFind(aKey, aIndex);
+    VerifyOrExit(record != nullptr, error = OT_ERROR_NOT_FOUND);
 
-    while (offset < size)
+    if (aValueLength)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        if (key == aKey)
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            uint16_t readLength = (record->mLength <= *aValueLength ? record->mLength : *aValueLength);
+
+            VerifyOrDie(pread(sSettingsFd, aValue, readLength, record->mOffset) == readLength, OT_EXIT_FAILURE);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = record->mLength;
     }
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
     return error;
 }
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int     swapFd = -1;
-    otError error  = OT_ERROR_NONE;
+    otError  error     = OT_ERROR_NONE;
+    uint16_t header[3] = {aKey, kReplaceMarker, aValueLength};
+    off_t    offset;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -301,37 +505,23 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     }
 #endif
 
-    switch (platformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    default:
-        assert(false);
-        break;
-    }
+    VerifyOrExit(aValueLength < kReplaceMarker, error = OT_ERROR_NO_BUFS);
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
+    offset = settingsAppend(header, sizeof(header), aValue, aValueLength);
+    IgnoreError(indexRemove(aKey, -1));
+    indexAdd(aKey, aValueLength, offset);
 
-    swapPersist(aInstance, swapFd);
+    settingsCompactIfNeeded(aInstance);
 
-#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 exit:
-#endif
     return error;
 }
 
 otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-
-    otError error  = OT_ERROR_NONE;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    int     swapFd = swapOpen(aInstance);
+    otError  error     = OT_ERROR_NONE;
+    uint16_t header[2] = {aKey, aValueLength};
+    off_t    offset;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -340,134 +530,34 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     }
 #endif
 
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(aInstance, swapFd, static_cast<uint16_t>(size));
-    }
+    VerifyOrExit(aValueLength < kReplaceMarker, error = OT_ERROR_NO_BUFS);
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    offset = settingsAppend(header, sizeof(header), aValue, aValueLength);
+    indexAdd(aKey, aValueLength, offset);
 
-#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 exit:
-#endif
+    OT_UNUSED_VARIABLE(aInstance);
     return error;
 }
 
 otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
-    otError error;
+    otError  error;
+    uint16_t header[3] = {aKey, kDeleteMarker, static_cast<uint16_t>((aIndex == -1) ? kDeleteAllIndex : aIndex)};
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
     {
-        error = otPosixSecureSettingsDelete(aInstance, aKey, aIndex);
+        ExitNow(error = otPosixSecureSettingsDelete(aInstance, aKey, aIndex));
     }
-    else
 #endif
-    {
-        error = platformSettingsDelete(aInstance, aKey, aIndex, nullptr);
-    }
-
-    return error;
-}
-
-/**
- * This function removes a setting either from swap file or persisted file.
- *
- * @param[in]  aInstance  The OpenThread instance structure.
- * @param[in]  aKey       The key associated with the requested setting.
- * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
- * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
- *
- * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
- *
- * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
- * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
- *
- */
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
-{
-    OT_UNUSED_VARIABLE(aInstance);
 
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen(aInstance);
+    SuccessOrExit(error = indexRemove(aKey, aIndex));
+    IgnoreReturnValue(settingsAppend(header, sizeof(header), nullptr, 0));
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
-
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(aInstance, swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
-
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
-
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
-
-        swapWrite(aInstance, swapFd, length);
-    }
+    settingsCompactIfNeeded(aInstance);
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
-
-    if (aSwapFd != nullptr)
-    {
-        *aSwapFd = swapFd;
-    }
-    else if (error == OT_ERROR_NONE)
-    {
-        swapPersist(aInstance, swapFd);
-    }
-    else if (error == OT_ERROR_NOT_FOUND)
-    {
-        swapDiscard(aInstance, swapFd);
-    }
-
     return error;
 }
 
@@ -479,6 +569,10 @@ void otPlatSettingsWipe(otInstance *aInstance)
 #endif
 
     VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+
+    sNumRecords = 0;
+    sFileSize   = 0;
+    sLiveSize   = 0;
 }
 
 #ifndef SELF_TEST
@@ -494,6 +588,15 @@ void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
     memset(aIeeeEui64, 0, sizeof(uint64_t));
 }
 
+static uint64_t getNowUs(void)
+{
+    struct timespec now;
+
+    VerifyOrDie(clock_gettime(CLOCK_MONOTONIC, &now) == 0, OT_EXIT_ERROR_ERRNO);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
 int main()
 {
     otInstance *instance = nullptr;
@@ -629,6 +732,127 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify records persist across re-initialization
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 4) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 2, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 2, -1) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        // verify the file was compacted to the plain layout on deinit
+        assert(lseek(sSettingsFd, 0, SEEK_END) ==
+               static_cast<off_t>(4 * sizeof(uint16_t) + sizeof(data) / 2 + sizeof(data) / 4));
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 4);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        assert(otPlatSettingsGet(instance, 2, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify an incomplete record at the end of the file is dropped
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data)) == OT_ERROR_NONE);
+    {
+        off_t    size = lseek(sSettingsFd, 0, SEEK_END);
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(ftruncate(sSettingsFd, size - 1) == 0);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance);
+
+        assert(lseek(sSettingsFd, 0, SEEK_END) == size - static_cast<off_t>(2 * sizeof(uint16_t) + sizeof(data)));
+        assert(otPlatSettingsGet(instance, 1, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+
+        // verify records appended after the recovery are kept
+        assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 2) == OT_ERROR_NONE);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance);
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the file is compacted and stays consistent after many updates
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        data[0] = static_cast<uint8_t>(i);
+        assert(otPlatSettingsSet(instance, 1, data, sizeof(data)) == OT_ERROR_NONE);
+    }
+    assert(lseek(sSettingsFd, 0, SEEK_END) < 2 * kMinCompactGarbageSize);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NONE);
+    }
+    data[0] = 0;
+    otPlatSettingsWipe(instance);
+
+    // measure the throughput of the settings operations
+    {
+        const uint16_t kNumKeys       = 16;
+        const uint32_t kNumIterations = 1000;
+        uint8_t        value[sizeof(data)];
+        uint16_t       length;
+        uint64_t       start;
+
+        for (uint16_t key = 0; key < kNumKeys; key++)
+        {
+            assert(otPlatSettingsSet(instance, key, data, sizeof(data)) == OT_ERROR_NONE);
+        }
+
+        start = getNowUs();
+        for (uint32_t i = 0; i < kNumIterations; i++)
+        {
+            length = sizeof(value);
+            assert(otPlatSettingsGet(instance, i % kNumKeys, 0, value, &length) == OT_ERROR_NONE);
+        }
+        printf("Get: %u operations in %" PRIu64 " us\n", kNumIterations, getNowUs() - start);
+
+        start = getNowUs();
+        for (uint32_t i = 0; i < kNumIterations; i++)
+        {
+            assert(otPlatSettingsSet(instance, i % kNumKeys, data, sizeof(data)) == OT_ERROR_NONE);
+        }
+        printf("Set: %u operations in %" PRIu64 " us\n", kNumIterations, getNowUs() - start);
+
+        start = getNowUs();
+        for (uint32_t i = 0; i < kNumIterations; i++)
+        {
+            assert(otPlatSettingsAdd(instance, kNumKeys, data, sizeof(data)) == OT_ERROR_NONE);
+            assert(otPlatSettingsDelete(instance, kNumKeys, 0) == OT_ERROR_NONE);
+        }
+        printf("Add/Delete: %u operations in %" PRIu64 " us\n", kNumIterations, getNowUs() - start);
+    }
+    otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
     return 0;
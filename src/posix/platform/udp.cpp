@@ -52,6 +52,7 @@
 #include <openthread/platform/udp.h>
 
 #include "common/code_utils.hpp"
+#include "common/new.hpp"
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
 
@@ -60,19 +61,53 @@
 #include "posix/platform/udp.hpp"
 
 using namespace ot::Posix::Ip6Utils;
+using ot::Posix::Mainloop::Descriptor;
 
 namespace {
 
-constexpr size_t kMaxUdpSize = 1280;
+constexpr size_t   kMaxUdpSize    = 1280;
+constexpr uint16_t kMaxUdpSockets = OPENTHREAD_POSIX_CONFIG_MAX_UDP_SOCKETS;
 
-void *FdToHandle(int aFd)
+// The handle of a platform UDP socket is the mainloop descriptor of its file descriptor. The descriptors are taken
+// from a fixed pool, as the number of platform UDP sockets follows the number of OpenThread UDP sockets.
+alignas(alignof(Descriptor)) char sDescriptorsRaw[kMaxUdpSockets * sizeof(Descriptor)];
+bool                              sDescriptorsInUse[kMaxUdpSockets];
+
+Descriptor *GetDescriptorAt(uint16_t aIndex)
+{
+    return reinterpret_cast<Descriptor *>(sDescriptorsRaw) + aIndex;
+}
+
+Descriptor *NewDescriptor(int aFd, otUdpSocket *aUdpSocket)
 {
-    return reinterpret_cast<void *>(aFd);
+    Descriptor *descriptor = nullptr;
+
+    for (uint16_t i = 0; i < kMaxUdpSockets; i++)
+    {
+        if (!sDescriptorsInUse[i])
+        {
+            sDescriptorsInUse[i] = true;
+            descriptor = new (GetDescriptorAt(i)) Descriptor(aFd, ot::Posix::Udp::HandleSocketEvent, aUdpSocket);
+            break;
+        }
+    }
+
+    return descriptor;
+}
+
+void FreeDescriptor(Descriptor &aDescriptor)
+{
+    sDescriptorsInUse[&aDescriptor - GetDescriptorAt(0)] = false;
+}
+
+Descriptor *DescriptorFromHandle(void *aHandle)
+{
+    return static_cast<Descriptor *>(aHandle);
 }
 
 int FdFromHandle(void *aHandle)
 {
-    return static_cast<int>(reinterpret_cast<long>(aHandle));
+    return (aHandle != nullptr) ? DescriptorFromHandle(aHandle)->GetFd() : -1;
 }
 
 bool IsLinkLocal(const struct in6_addr &aAddress)
@@ -234,15 +269,25 @@ exit:
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError     error = OT_ERROR_NONE;
+    int         fd;
+    Descriptor *descriptor;
 
     assert(aUdpSocket->mHandle == nullptr);
 
     fd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
-    aUdpSocket->mHandle = FdToHandle(fd);
+    descriptor = NewDescriptor(fd, aUdpSocket);
+
+    if (descriptor == nullptr)
+    {
+        close(fd);
+        ExitNow(error = OT_ERROR_NO_BUFS);
+    }
+
+    aUdpSocket->mHandle = descriptor;
+    ot::Posix::Udp::Get().Register(*aUdpSocket);
 
 exit:
     return error;
@@ -250,16 +295,18 @@ exit:
 
 otError otPlatUdpClose(otUdpSocket *aUdpSocket)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError     error = OT_ERROR_NONE;
+    Descriptor *descriptor;
 
     // Only call `close()` on platform UDP sockets.
     // Platform UDP sockets always have valid `mHandle` upon creation.
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
-    fd = FdFromHandle(aUdpSocket->mHandle);
-    VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
+    descriptor = DescriptorFromHandle(aUdpSocket->mHandle);
+    ot::Posix::Mainloop::Manager::Get().Unregister(*descriptor);
+    VerifyOrExit(0 == close(descriptor->GetFd()), error = OT_ERROR_FAILED);
 
+    FreeDescriptor(*descriptor);
     aUdpSocket->mHandle = nullptr;
 
 exit:
@@ -546,32 +593,6 @@ exit:
 namespace ot {
 namespace Posix {
 
-void Udp::Update(otSysMainloopContext &aContext)
-{
-    VerifyOrExit(gNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(mInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd;
-
-        if (socket->mHandle == nullptr)
-        {
-            continue;
-        }
-
-        fd = FdFromHandle(socket->mHandle);
-        FD_SET(fd, &aContext.mReadFdSet);
-
-        if (aContext.mMaxFd < fd)
-        {
-            aContext.mMaxFd = fd;
-        }
-    }
-
-exit:
-    return;
-}
-
 void Udp::Init(otInstance *aInstance, const char *aIfName)
 {
     if (aIfName == nullptr)
@@ -591,15 +612,31 @@ void Udp::Init(otInstance *aInstance, const char *aIfName)
     assert(gNetifIndex != 0);
 
     mInstance = aInstance;
-    Mainloop::Manager::Get().Add(*this);
+
+    for (otUdpSocket *socket = otUdpGetSockets(mInstance); socket != nullptr; socket = socket->mNext)
+    {
+        Register(*socket);
+    }
 }
 
 void Udp::Deinit(void)
 {
     // TODO All platform sockets should be closed
 
+    VerifyOrExit(mInstance != nullptr);
+
+    for (otUdpSocket *socket = otUdpGetSockets(mInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle != nullptr)
+        {
+            Mainloop::Manager::Get().Unregister(*DescriptorFromHandle(socket->mHandle));
+        }
+    }
+
     mInstance = nullptr;
-    Mainloop::Manager::Get().Remove(*this);
+
+exit:
+    return;
 }
 
 Udp &Udp::Get(void)
@@ -609,50 +646,50 @@ Udp &Udp::Get(void)
     return sInstance;
 }
 
-void Udp::Process(const otSysMainloopContext &aContext)
+void Udp::Register(otUdpSocket &aUdpSocket)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    // Sockets are only watched once the platform UDP is initialized, sockets opened before are registered from
+    // `Init()`.
+    VerifyOrExit(mInstance != nullptr && aUdpSocket.mHandle != nullptr);
 
-    for (otUdpSocket *socket = otUdpGetSockets(mInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd = FdFromHandle(socket->mHandle);
+    Mainloop::Manager::Get().Register(*DescriptorFromHandle(aUdpSocket.mHandle), Descriptor::kEventRead);
 
-        if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet))
-        {
-            otMessageInfo messageInfo;
-            otMessage *   message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+exit:
+    return;
+}
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+void Udp::HandleSocketEvent(Descriptor &aDescriptor, uint8_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aEvents);
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+    Get().ProcessSocket(*static_cast<otUdpSocket *>(aDescriptor.GetContext()));
+}
 
-            message = otUdpNewMessage(mInstance, &msgSettings);
+void Udp::ProcessSocket(otUdpSocket &aUdpSocket)
+{
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    otMessageInfo     messageInfo;
+    otMessage *       message = nullptr;
+    uint8_t           payload[kMaxUdpSize];
+    uint16_t          length = sizeof(payload);
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mSockPort = aUdpSocket.mSockName.mPort;
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+    SuccessOrExit(receivePacket(FdFromHandle(aUdpSocket.mHandle), payload, length, messageInfo));
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
-            break;
-        }
-    }
+    message = otUdpNewMessage(mInstance, &msgSettings);
+    VerifyOrExit(message != nullptr);
 
-    return;
+    SuccessOrExit(otMessageAppend(message, payload, length));
+
+    aUdpSocket.mHandler(aUdpSocket.mContext, message, &messageInfo);
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
 }
 
 } // namespace Posix
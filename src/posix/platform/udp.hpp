@@ -28,23 +28,28 @@
 #ifndef OT_POSIX_PLATFORM_UDP_HPP_
 #define OT_POSIX_PLATFORM_UDP_HPP_
 
+#include <openthread/udp.h>
+
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
 
 namespace ot {
 namespace Posix {
 
-class Udp : public Mainloop::Source, private NonCopyable
+class Udp : private NonCopyable
 {
 public:
     static Udp &Get(void);
 
     void Init(otInstance *aInstance, const char *aIfName);
     void Deinit(void);
-    void Update(otSysMainloopContext &aContext) override;
-    void Process(const otSysMainloopContext &aContext) override;
+    void Register(otUdpSocket &aUdpSocket);
+
+    static void HandleSocketEvent(Mainloop::Descriptor &aDescriptor, uint8_t aEvents);
 
 private:
+    void ProcessSocket(otUdpSocket &aUdpSocket);
+
     otInstance *mInstance = nullptr;
 };
 
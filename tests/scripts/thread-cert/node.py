@@ -2389,6 +2389,13 @@ class NodeImpl:
         self._expect_done()
         return router_list
 
+    def get_next_hop_and_path_cost(self, rloc16: int):
+        cmd = 'nexthop 0x%04x' % rloc16
+        self.send_command(cmd)
+        result = self._expect_command_output(cmd)[0]
+        next_hop, path_cost = result.split(' cost:')
+        return int(next_hop, 16), int(path_cost)
+
     def router_table(self):
         cmd = 'router table'
         self.send_command(cmd)
@@ -2513,6 +2520,31 @@ class NodeImpl:
         self.send_command(cmd)
         self._expect_done()
 
+    def dns_get_cache_counters(self):
+        """
+        Returns the DNS client cache counters as a dictionary (string key and int value).
+
+        Example output:
+        {
+            'Hits': 3
+            'Misses': 2
+            'Coalesced': 1
+        }
+        """
+        cmd = 'dns cache'
+        self.send_command(cmd)
+        output = self._expect_command_output(cmd)
+        counters = {}
+        for line in output:
+            k, v = line.split(': ')
+            counters[k] = int(v)
+        return counters
+
+    def dns_flush_cache(self):
+        cmd = 'dns cache flush'
+        self.send_command(cmd)
+        self._expect_done()
+
     def dns_resolve(self, hostname, server=None, port=53):
         cmd = f'dns resolve {hostname}'
         if server is not None:
@@ -117,6 +117,24 @@ class TestDnssd(thread_cert.TestCase):
         self.assertEqual(set(ipaddress.IPv6Address(ip) for ip, _ in answers),
                          set(map(ipaddress.IPv6Address, client2_addrs)))
 
+        #---------------------------------------------------------------
+        # Resolve address again (answered from DNS client cache)
+
+        counters = client1.dns_get_cache_counters()
+
+        answers = client1.dns_resolve(f"host2.{DOMAIN}", server.get_mleid(), 53)
+        self.assertEqual(set(ipaddress.IPv6Address(ip) for ip, _ in answers),
+                         set(map(ipaddress.IPv6Address, client2_addrs)))
+        self.assertEqual(client1.dns_get_cache_counters()['Hits'], counters['Hits'] + 1)
+        self.assertEqual(client1.dns_get_cache_counters()['Misses'], counters['Misses'])
+
+        client1.dns_flush_cache()
+
+        answers = client1.dns_resolve(f"host2.{DOMAIN}", server.get_mleid(), 53)
+        self.assertEqual(set(ipaddress.IPv6Address(ip) for ip, _ in answers),
+                         set(map(ipaddress.IPv6Address, client2_addrs)))
+        self.assertEqual(client1.dns_get_cache_counters()['Misses'], counters['Misses'] + 1)
+
         #---------------------------------------------------------------
         # Browsing for services
 
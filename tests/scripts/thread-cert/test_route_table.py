@@ -81,6 +81,23 @@ class TestRouteTable(thread_cert.TestCase):
             router_table = _node.router_table()
             self.assertEqual(set(router_table), router_ids)
 
+        leader_rloc16 = self.nodes[LEADER].get_addr16()
+        router1_rloc16 = self.nodes[ROUTER1].get_addr16()
+        router2_rloc16 = self.nodes[ROUTER2].get_addr16()
+
+        # The leader reaches ROUTER2 through ROUTER1 and itself directly.
+        next_hop, path_cost = self.nodes[LEADER].get_next_hop_and_path_cost(router2_rloc16)
+        self.assertEqual(next_hop, router1_rloc16)
+        self.assertEqual(path_cost, 2)
+
+        next_hop, path_cost = self.nodes[LEADER].get_next_hop_and_path_cost(router1_rloc16)
+        self.assertEqual(next_hop, router1_rloc16)
+        self.assertEqual(path_cost, 1)
+
+        next_hop, path_cost = self.nodes[LEADER].get_next_hop_and_path_cost(leader_rloc16)
+        self.assertEqual(next_hop, leader_rloc16)
+        self.assertEqual(path_cost, 0)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,232 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "mac/mac.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+class AddressResolverTester
+{
+public:
+    enum : uint16_t
+    {
+        kCacheEntries = AddressResolver::kCacheEntries,
+    };
+
+    static uint16_t GetNumCacheEntries(const AddressResolver &aResolver)
+    {
+        AddressResolver::Iterator  iterator;
+        AddressResolver::EntryInfo info;
+        uint16_t                   num = 0;
+
+        memset(&iterator, 0, sizeof(iterator));
+
+        while (aResolver.GetNextCacheEntry(info, iterator) == kErrorNone)
+        {
+            num++;
+        }
+
+        return num;
+    }
+
+    static void VerifyCacheIndex(const AddressResolver &aResolver)
+    {
+        // Verify that every cache entry is reachable from its home slot
+        // in the hash index.
+
+        AddressResolver::Iterator  iterator;
+        AddressResolver::EntryInfo info;
+        uint16_t                   numIndexed = 0;
+
+        for (uint16_t index : aResolver.mCacheIndex)
+        {
+            if (index != AddressResolver::kInvalidIndex)
+            {
+                numIndexed++;
+            }
+        }
+
+        VerifyOrQuit(numIndexed == GetNumCacheEntries(aResolver), "Cache index and lists are out of sync");
+
+        memset(&iterator, 0, sizeof(iterator));
+
+        while (aResolver.GetNextCacheEntry(info, iterator) == kErrorNone)
+        {
+            const Ip6::Address &target = static_cast<const Ip6::Address &>(info.mTarget);
+            uint16_t            slot   = AddressResolver::GetCacheIndexSlot(target);
+
+            while (!aResolver.mCacheEntryPool.GetEntryAt(aResolver.mCacheIndex[slot]).Matches(target))
+            {
+                slot = AddressResolver::GetNextCacheIndexSlot(slot);
+                VerifyOrQuit(aResolver.mCacheIndex[slot] != AddressResolver::kInvalidIndex, "Entry not in index");
+            }
+        }
+    }
+};
+
+static void PrepareEid(Ip6::Address &aEid, uint16_t aIndex)
+{
+    SuccessOrQuit(aEid.FromString("fd00:1234:5678:9abc::"));
+    Random::NonCrypto::FillBuffer(aEid.GetIid().mFields.m8, sizeof(Ip6::InterfaceIdentifier));
+    aEid.GetIid().mFields.m16[3] = aIndex;
+}
+
+static uint16_t Rloc16ForIndex(uint16_t aIndex)
+{
+    return static_cast<uint16_t>(0x0400 + aIndex);
+}
+
+void TestAddressResolverCache(void)
+{
+    enum : uint16_t
+    {
+        kNumEntries      = AddressResolverTester::kCacheEntries,
+        kNumLookupRounds = 200,
+    };
+
+    Instance *        instance = static_cast<Instance *>(testInitInstance());
+    Ip6::Address      eids[kNumEntries + 1];
+    Ip6::Address      extraEid;
+    Mac::ShortAddress rloc16;
+    Mac::ShortAddress dest;
+    uint32_t          startTime;
+    uint32_t          duration;
+
+    VerifyOrQuit(instance != nullptr);
+
+    AddressResolver &resolver = instance->Get<AddressResolver>();
+
+    printf("TestAddressResolverCache() with %u cache entries", kNumEntries);
+
+    dest = instance->Get<Mac::Mac>().GetShortAddress();
+
+    // Fill the cache with snooped entries and then use (resolve) all
+    // of them in order so that they move to the cached list.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        PrepareEid(eids[i], i);
+        resolver.UpdateSnoopedCacheEntry(eids[i], Rloc16ForIndex(i), dest);
+    }
+
+    VerifyOrQuit(AddressResolverTester::GetNumCacheEntries(resolver) == kNumEntries);
+    AddressResolverTester::VerifyCacheIndex(resolver);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        SuccessOrQuit(resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false));
+        VerifyOrQuit(rloc16 == Rloc16ForIndex(i));
+    }
+
+    // Add a new entry and verify that the least recently used entry
+    // (first one) is evicted.
+
+    PrepareEid(extraEid, kNumEntries);
+    resolver.UpdateSnoopedCacheEntry(extraEid, Rloc16ForIndex(kNumEntries), dest);
+
+    VerifyOrQuit(AddressResolverTester::GetNumCacheEntries(resolver) == kNumEntries);
+    AddressResolverTester::VerifyCacheIndex(resolver);
+
+    VerifyOrQuit(resolver.Resolve(eids[0], rloc16, false) == kErrorNotFound, "LRU entry was not evicted");
+    SuccessOrQuit(resolver.Resolve(extraEid, rloc16, false));
+    VerifyOrQuit(rloc16 == Rloc16ForIndex(kNumEntries));
+
+    for (uint16_t i = 1; i < kNumEntries; i++)
+    {
+        SuccessOrQuit(resolver.Resolve(eids[i], rloc16, false));
+        VerifyOrQuit(rloc16 == Rloc16ForIndex(i));
+    }
+
+    // Remove every other entry and verify that the remaining ones are
+    // still found (checks deletion from the open-addressing index).
+
+    for (uint16_t i = 1; i < kNumEntries; i += 2)
+    {
+        resolver.Remove(eids[i]);
+        AddressResolverTester::VerifyCacheIndex(resolver);
+    }
+
+    for (uint16_t i = 1; i < kNumEntries; i++)
+    {
+        Error error = resolver.Resolve(eids[i], rloc16, false);
+
+        VerifyOrQuit((i % 2 == 1) ? (error == kErrorNotFound) : (error == kErrorNone));
+    }
+
+    // Remove all entries with an RLOC16.
+
+    resolver.Remove(Rloc16ForIndex(kNumEntries));
+    VerifyOrQuit(resolver.Resolve(extraEid, rloc16, false) == kErrorNotFound);
+    AddressResolverTester::VerifyCacheIndex(resolver);
+
+    // Refill the cache and measure the lookup time.
+
+    resolver.Clear();
+    VerifyOrQuit(AddressResolverTester::GetNumCacheEntries(resolver) == 0);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        resolver.UpdateSnoopedCacheEntry(eids[i], Rloc16ForIndex(i), dest);
+    }
+
+    AddressResolverTester::VerifyCacheIndex(resolver);
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t round = 0; round < kNumLookupRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumEntries; i++)
+        {
+            SuccessOrQuit(resolver.Resolve(eids[i], rloc16, false));
+        }
+    }
+
+    duration = otPlatAlarmMicroGetNow() - startTime;
+
+    printf(" - %u lookups in %u usec -- PASS\n", kNumLookupRounds * kNumEntries, duration);
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestAddressResolverCache();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
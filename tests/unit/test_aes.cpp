@@ -26,6 +26,10 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <limits.h>
+
+#include <mbedtls/ccm.h>
+
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
@@ -137,10 +141,203 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0);
 }
 
+/**
+ * Compares the throughput of AES-CCM on small IEEE 802.15.4 frames when the key is expanded for every frame and when
+ * an already expanded key is used, and verifies both give the same result.
+ */
+void TestMacFrameThroughput(void)
+{
+    enum : uint16_t
+    {
+        kHeaderLength = 23,
+        kTagLength    = 4,
+        kMaxPayload   = 100,
+        kIterations   = 5000,
+    };
+
+    const uint16_t kPayloadLengths[] = {8, 32, 64, kMaxPayload};
+
+    uint8_t            key[ot::Crypto::AesEcb::kBlockSize];
+    uint8_t            nonce[ot::Crypto::AesCcm::kNonceSize];
+    uint8_t            frame[kHeaderLength + kMaxPayload + kTagLength];
+    uint8_t            expectedFrame[sizeof(frame)];
+    ot::Crypto::AesEcb expandedKey;
+
+    for (uint8_t i = 0; i < sizeof(key); i++)
+    {
+        key[i] = i;
+    }
+
+    memset(nonce, 0xa5, sizeof(nonce));
+    expandedKey.SetKey(key, CHAR_BIT * sizeof(key));
+
+    for (uint16_t payloadLength : kPayloadLengths)
+    {
+        uint32_t startTime;
+        uint32_t setKeyDuration;
+        uint32_t expandedKeyDuration;
+
+        memset(frame, 0x5a, sizeof(frame));
+        startTime = otPlatAlarmMicroGetNow();
+
+        for (uint16_t iter = 0; iter < kIterations; iter++)
+        {
+            ot::Crypto::AesCcm aesCcm;
+
+            aesCcm.SetKey(key, sizeof(key));
+            aesCcm.Init(kHeaderLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+            aesCcm.Header(frame, kHeaderLength);
+            aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, payloadLength, ot::Crypto::AesCcm::kEncrypt);
+            aesCcm.Finalize(frame + kHeaderLength + payloadLength);
+        }
+
+        setKeyDuration = otPlatAlarmMicroGetNow() - startTime;
+        memcpy(expectedFrame, frame, sizeof(frame));
+
+        memset(frame, 0x5a, sizeof(frame));
+        startTime = otPlatAlarmMicroGetNow();
+
+        for (uint16_t iter = 0; iter < kIterations; iter++)
+        {
+            ot::Crypto::AesCcm aesCcm;
+
+            aesCcm.SetKey(expandedKey);
+            aesCcm.Init(kHeaderLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+            aesCcm.Header(frame, kHeaderLength);
+            aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, payloadLength, ot::Crypto::AesCcm::kEncrypt);
+            aesCcm.Finalize(frame + kHeaderLength + payloadLength);
+        }
+
+        expandedKeyDuration = otPlatAlarmMicroGetNow() - startTime;
+
+        VerifyOrQuit(memcmp(frame, expectedFrame, sizeof(frame)) == 0);
+
+        printf("AES-CCM %3u byte payload x %u: key expanded per frame %u usec, expanded key %u usec\n", payloadLength,
+               kIterations, setKeyDuration, expandedKeyDuration);
+    }
+}
+
+void TestAesCcmAgainstMbedtls(void)
+{
+    enum : uint16_t
+    {
+        kHeaderLength = 23,
+        kTagLength    = 4,
+        kFcsLength    = 2,
+        kMaxPayload   = 127 - kHeaderLength - kTagLength - kFcsLength,
+        kChunkLength  = 5,
+        kIterations   = 5000,
+    };
+
+    const uint16_t kPayloadLengths[] = {0, 1, 15, 16, 17, 31, 32, 33, 64, kMaxPayload};
+
+    uint8_t             key[ot::Crypto::AesEcb::kBlockSize];
+    uint8_t             nonce[ot::Crypto::AesCcm::kNonceSize];
+    uint8_t             plainText[kHeaderLength + kMaxPayload];
+    uint8_t             frame[kHeaderLength + kMaxPayload + kTagLength];
+    uint8_t             expectedFrame[sizeof(frame)];
+    ot::Crypto::AesEcb  expandedKey;
+    mbedtls_ccm_context ccm;
+    uint32_t            startTime;
+    uint32_t            mbedtlsDuration;
+    uint32_t            aesCcmDuration;
+
+    for (uint8_t i = 0; i < sizeof(key); i++)
+    {
+        key[i] = 0x40 + i;
+    }
+
+    for (uint16_t i = 0; i < sizeof(plainText); i++)
+    {
+        plainText[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    memset(nonce, 0x3c, sizeof(nonce));
+    expandedKey.SetKey(key, CHAR_BIT * sizeof(key));
+
+    mbedtls_ccm_init(&ccm);
+    VerifyOrQuit(mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, key, CHAR_BIT * sizeof(key)) == 0);
+
+    for (uint16_t payloadLength : kPayloadLengths)
+    {
+        ot::Crypto::AesCcm aesCcm;
+        uint8_t *          payload = frame + kHeaderLength;
+        uint8_t *          tag     = payload + payloadLength;
+
+        memcpy(expectedFrame, plainText, kHeaderLength);
+        VerifyOrQuit(mbedtls_ccm_encrypt_and_tag(&ccm, payloadLength, nonce, sizeof(nonce), plainText, kHeaderLength,
+                                                 plainText + kHeaderLength, expectedFrame + kHeaderLength,
+                                                 expectedFrame + kHeaderLength + payloadLength, kTagLength) == 0);
+
+        // Encrypt the whole payload at once.
+
+        memcpy(frame, plainText, kHeaderLength + payloadLength);
+        aesCcm.SetKey(expandedKey);
+        aesCcm.Init(kHeaderLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(payload, payload, payloadLength, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+        VerifyOrQuit(memcmp(frame, expectedFrame, kHeaderLength + payloadLength + kTagLength) == 0);
+
+        // Decrypt the payload in chunks not aligned to the block size.
+
+        aesCcm.Init(kHeaderLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+        aesCcm.Header(frame, kHeaderLength);
+
+        for (uint16_t offset = 0; offset < payloadLength; offset += kChunkLength)
+        {
+            uint16_t length = OT_MIN(static_cast<uint16_t>(kChunkLength), payloadLength - offset);
+
+            aesCcm.Payload(payload + offset, payload + offset, length, ot::Crypto::AesCcm::kDecrypt);
+        }
+
+        aesCcm.Finalize(tag);
+        VerifyOrQuit(memcmp(frame, plainText, kHeaderLength + payloadLength) == 0);
+        VerifyOrQuit(memcmp(tag, expectedFrame + kHeaderLength + payloadLength, kTagLength) == 0);
+    }
+
+    // Compare the throughput on 127-byte frames.
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t iter = 0; iter < kIterations; iter++)
+    {
+        mbedtls_ccm_encrypt_and_tag(&ccm, kMaxPayload, nonce, sizeof(nonce), plainText, kHeaderLength,
+                                    plainText + kHeaderLength, expectedFrame + kHeaderLength,
+                                    expectedFrame + kHeaderLength + kMaxPayload, kTagLength);
+    }
+
+    mbedtlsDuration = otPlatAlarmMicroGetNow() - startTime;
+    startTime       = otPlatAlarmMicroGetNow();
+
+    for (uint16_t iter = 0; iter < kIterations; iter++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        memcpy(frame, plainText, sizeof(plainText));
+        aesCcm.SetKey(expandedKey);
+        aesCcm.Init(kHeaderLength, kMaxPayload, kTagLength, nonce, sizeof(nonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kMaxPayload, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(frame + kHeaderLength + kMaxPayload);
+    }
+
+    aesCcmDuration = otPlatAlarmMicroGetNow() - startTime;
+
+    VerifyOrQuit(memcmp(frame, expectedFrame, sizeof(frame)) == 0);
+
+    printf("AES-CCM 127 byte frame x %u: mbedtls %u usec, AesCcm %u usec\n", kIterations, mbedtlsDuration,
+           aesCcmDuration);
+
+    mbedtls_ccm_free(&ccm);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestMacFrameThroughput();
+    TestAesCcmAgainstMbedtls();
     printf("All tests passed\n");
     return 0;
 }
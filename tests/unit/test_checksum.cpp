@@ -128,7 +128,7 @@ void CorruptMessage(Message &aMessage)
 
     byte ^= (1 << bitOffset);
 
-    aMessage.Write(byteOffset, byte);
+    SuccessOrQuit(aMessage.Write(byteOffset, byte));
 }
 
 void TestUdpMessageChecksum(void)
@@ -159,7 +159,7 @@ void TestUdpMessageChecksum(void)
 
         Random::NonCrypto::FillBuffer(reinterpret_cast<uint8_t *>(&udpHeader), sizeof(udpHeader));
         udpHeader.SetChecksum(0);
-        message->Write(0, udpHeader);
+        SuccessOrQuit(message->Write(0, udpHeader));
 
         if (size > sizeof(udpHeader))
         {
@@ -167,7 +167,7 @@ void TestUdpMessageChecksum(void)
             uint16_t payloadSize = size - sizeof(udpHeader);
 
             Random::NonCrypto::FillBuffer(buffer, payloadSize);
-            message->WriteBytes(sizeof(udpHeader), &buffer[0], payloadSize);
+            SuccessOrQuit(message->WriteBytes(sizeof(udpHeader), &buffer[0], payloadSize));
         }
 
         SuccessOrQuit(messageInfo.GetSockAddr().FromString(kSourceAddress));
@@ -176,7 +176,8 @@ void TestUdpMessageChecksum(void)
         // Verify that the `Checksum::UpdateMessageChecksum` correctly
         // updates the checksum field in the UDP header on the message.
 
-        Checksum::UpdateMessageChecksum(*message, messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(), Ip6::kProtoUdp);
+        SuccessOrQuit(Checksum::UpdateMessageChecksum(*message, messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(),
+                                                      Ip6::kProtoUdp));
 
         SuccessOrQuit(message->Read(message->GetOffset(), udpHeader));
         VerifyOrQuit(udpHeader.GetChecksum() != 0);
@@ -230,7 +231,7 @@ void TestIcmp6MessageChecksum(void)
 
         Random::NonCrypto::FillBuffer(reinterpret_cast<uint8_t *>(&icmp6Header), sizeof(icmp6Header));
         icmp6Header.SetChecksum(0);
-        message->Write(0, icmp6Header);
+        SuccessOrQuit(message->Write(0, icmp6Header));
 
         if (size > sizeof(icmp6Header))
         {
@@ -238,7 +239,7 @@ void TestIcmp6MessageChecksum(void)
             uint16_t payloadSize = size - sizeof(icmp6Header);
 
             Random::NonCrypto::FillBuffer(buffer, payloadSize);
-            message->WriteBytes(sizeof(icmp6Header), &buffer[0], payloadSize);
+            SuccessOrQuit(message->WriteBytes(sizeof(icmp6Header), &buffer[0], payloadSize));
         }
 
         SuccessOrQuit(messageInfo.GetSockAddr().FromString(kSourceAddress));
@@ -247,8 +248,8 @@ void TestIcmp6MessageChecksum(void)
         // Verify that the `Checksum::UpdateMessageChecksum` correctly
         // updates the checksum field in the ICMP6 header on the message.
 
-        Checksum::UpdateMessageChecksum(*message, messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(),
-                                        Ip6::kProtoIcmp6);
+        SuccessOrQuit(Checksum::UpdateMessageChecksum(*message, messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(),
+                                                      Ip6::kProtoIcmp6));
 
         SuccessOrQuit(message->Read(message->GetOffset(), icmp6Header));
         VerifyOrQuit(icmp6Header.GetChecksum() != 0, "Failed to update checksum");
@@ -291,6 +292,102 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestAddDataSplits(void)
+    {
+        // Verify that `AddData()` gives the same result as a byte at a
+        // time `AddUint8()` loop for all buffer alignments, lengths and
+        // split points (i.e., odd chunk boundaries across buffers).
+
+        enum : uint16_t
+        {
+            kMaxLength = 80,
+        };
+
+        uint8_t buffer[kMaxLength + sizeof(uint64_t)];
+
+        for (uint16_t iter = 0; iter < 20; iter++)
+        {
+            Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+            for (uint16_t start = 0; start < sizeof(uint64_t); start++)
+            {
+                for (uint16_t length = 0; length <= kMaxLength; length++)
+                {
+                    Checksum expected;
+
+                    for (uint16_t i = 0; i < length; i++)
+                    {
+                        expected.AddUint8(buffer[start + i]);
+                    }
+
+                    for (uint16_t split = 0; split <= length; split++)
+                    {
+                        Checksum checksum;
+
+                        checksum.AddData(&buffer[start], split);
+                        checksum.AddData(&buffer[start + split], length - split);
+
+                        VerifyOrQuit(checksum.GetValue() == expected.GetValue());
+                        VerifyOrQuit(checksum.mAtOddIndex == expected.mAtOddIndex);
+                    }
+                }
+            }
+        }
+    }
+
+    static void TestAddDataThroughput(void)
+    {
+        // Compares the throughput of `AddData()` against a byte at a
+        // time `AddUint8()` loop over a typical IPv6 datagram size.
+
+        enum : uint16_t
+        {
+            kLength     = 1280,
+            kIterations = 2000,
+        };
+
+        uint8_t  buffer[kLength];
+        uint16_t byteLoopValue = 0;
+        uint16_t addDataValue  = 0;
+        uint32_t startTime;
+        uint32_t byteLoopDuration;
+        uint32_t addDataDuration;
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        startTime = otPlatAlarmMicroGetNow();
+
+        for (uint16_t iter = 0; iter < kIterations; iter++)
+        {
+            Checksum checksum;
+
+            for (uint16_t i = 0; i < kLength; i++)
+            {
+                checksum.AddUint8(buffer[i]);
+            }
+
+            byteLoopValue = checksum.GetValue();
+        }
+
+        byteLoopDuration = otPlatAlarmMicroGetNow() - startTime;
+        startTime        = otPlatAlarmMicroGetNow();
+
+        for (uint16_t iter = 0; iter < kIterations; iter++)
+        {
+            Checksum checksum;
+
+            checksum.AddData(buffer, kLength);
+            addDataValue = checksum.GetValue();
+        }
+
+        addDataDuration = otPlatAlarmMicroGetNow() - startTime;
+
+        VerifyOrQuit(byteLoopValue == addDataValue);
+
+        printf("Checksum over %u x %u bytes: byte loop %u usec, AddData %u usec\n", kIterations, kLength,
+               byteLoopDuration, addDataDuration);
+    }
 };
 
 } // namespace ot
@@ -300,6 +397,8 @@ int main(void)
     ot::ChecksumTester::TestExampleVector();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
+    ot::ChecksumTester::TestAddDataSplits();
+    ot::ChecksumTester::TestAddDataThroughput();
     printf("All tests passed\n");
     return 0;
 }
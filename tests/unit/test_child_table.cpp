@@ -334,6 +334,7 @@ void TestChildTable(void)
         child->SetState(testChildList[i].mState);
         child->SetRloc16(testChildList[i].mRloc16);
         child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress)));
+        table->UpdateRloc16Index(*child);
 
         VerifyChildTableContent(*table, i + 1, testChildList);
     }
@@ -356,6 +357,7 @@ void TestChildTable(void)
         child->SetState(testChildList[i - 1].mState);
         child->SetRloc16(testChildList[i - 1].mRloc16);
         child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress)));
+        table->UpdateRloc16Index(*child);
 
         VerifyChildTableContent(*table, testListLength - i + 1, &testChildList[i - 1]);
     }
@@ -383,6 +385,7 @@ void TestChildTable(void)
 
         VerifyOrQuit(child != nullptr, "GetNewChild() failed");
         child->SetState(Child::kStateValid);
+        table->UpdateRloc16Index(*child);
     }
 
     VerifyOrQuit(table->GetNewChild() == nullptr, "GetNewChild() did not fail when table was full");
@@ -392,11 +395,169 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+void TestChildTableLookupHints(void)
+{
+    static constexpr uint16_t kRloc16Base = 0x8000;
+    static constexpr uint32_t kNumLookups = 100000;
+
+    ChildTable * table;
+    Child *      child;
+    Child *      first;
+    Child *      last;
+    Mac::Address address;
+    uint16_t     numChildren;
+    uint32_t     startTime;
+    uint32_t     duration;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test ChildTable lookups after in-place changes");
+
+    // Fill the table, then look up every child so that lookup hints
+    // are populated for all entries.
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Mac::ExtAddress extAddress;
+
+        child = table->GetNewChild();
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+        memset(&extAddress, 0, sizeof(extAddress));
+        extAddress.m8[6] = static_cast<uint8_t>(i >> 8);
+        extAddress.m8[7] = static_cast<uint8_t>(i & 0xff);
+
+        child->SetState(Child::kStateValid);
+        child->SetRloc16(kRloc16Base + i + 1);
+        child->SetExtAddress(extAddress);
+        table->UpdateRloc16Index(*child);
+    }
+
+    numChildren = table->GetNumChildren(Child::kInStateValid);
+    VerifyOrQuit(numChildren == kMaxChildren);
+
+    for (Child &entry : table->Iterate(Child::kInStateValid))
+    {
+        VerifyOrQuit(table->FindChild(entry.GetRloc16(), Child::kInStateValid) == &entry);
+        VerifyOrQuit(table->FindChild(entry.GetExtAddress(), Child::kInStateValid) == &entry);
+    }
+
+    // Swap the addresses of the first and last entries in place (as
+    // `MleRouter` does through `Neighbor` setters) and verify that the
+    // now stale extended address hints are not trusted and that the
+    // RLOC16 index follows the updates.
+
+    first = table->GetChildAtIndex(0);
+    last  = table->GetChildAtIndex(kMaxChildren - 1);
+
+    {
+        uint16_t        rloc16     = first->GetRloc16();
+        Mac::ExtAddress extAddress = first->GetExtAddress();
+
+        first->SetRloc16(last->GetRloc16());
+        first->SetExtAddress(last->GetExtAddress());
+        last->SetRloc16(rloc16);
+        last->SetExtAddress(extAddress);
+        table->UpdateRloc16Index(*first);
+        table->UpdateRloc16Index(*last);
+
+        VerifyOrQuit(table->FindChild(rloc16, Child::kInStateValid) == last);
+        VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValid) == last);
+        VerifyOrQuit(table->FindChild(first->GetRloc16(), Child::kInStateValid) == first);
+        VerifyOrQuit(table->FindChild(first->GetExtAddress(), Child::kInStateValid) == first);
+    }
+
+    // A hinted entry that no longer matches the state filter must not
+    // be returned.
+
+    last->SetState(Child::kStateInvalid);
+    table->UpdateRloc16Index(*last);
+    VerifyOrQuit(table->FindChild(last->GetRloc16(), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(last->GetExtAddress(), Child::kInStateValid) == nullptr);
+
+    address.SetExtended(last->GetExtAddress());
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(address, Child::kInStateAnyExceptInvalid) == nullptr);
+
+    last->SetState(Child::kStateValid);
+    table->UpdateRloc16Index(*last);
+    VerifyOrQuit(table->FindChild(address, Child::kInStateValid) == last);
+    VerifyOrQuit(table->FindChild(last->GetRloc16(), Child::kInStateValid) == last);
+
+    // RLOC16s that cannot belong to a child miss without a search:
+    // router RLOC16s (Child ID zero), unallocated Child IDs, and Child
+    // IDs under a different Router ID.
+
+    VerifyOrQuit(table->FindChild(kRloc16Base, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(kRloc16Base + kMaxChildren + 1, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(0x0401, Child::kInStateAnyExceptInvalid) == nullptr);
+
+    // Remove every other child, then verify that the RLOC16 index still
+    // agrees with a linear search of the table for every Child ID.
+
+    for (uint16_t i = 0; i < kMaxChildren; i += 2)
+    {
+        child = table->GetChildAtIndex(i);
+        child->SetState(Child::kStateInvalid);
+        table->UpdateRloc16Index(*child);
+    }
+
+    for (uint16_t childId = 1; childId <= kMaxChildren + 1; childId++)
+    {
+        uint16_t rloc16 = kRloc16Base + childId;
+
+        child = nullptr;
+
+        for (Child &entry : table->Iterate(Child::kInStateValid))
+        {
+            if (entry.GetRloc16() == rloc16)
+            {
+                child = &entry;
+            }
+        }
+
+        VerifyOrQuit(table->FindChild(rloc16, Child::kInStateValid) == child);
+    }
+
+    for (uint16_t i = 0; i < kMaxChildren; i += 2)
+    {
+        child = table->GetChildAtIndex(i);
+        child->SetState(Child::kStateValid);
+        table->UpdateRloc16Index(*child);
+    }
+
+    // Lookups through the invalid short address keep matching any child.
+
+    VerifyOrQuit(table->FindChild(Mac::kShortAddrInvalid, Child::kInStateValid) == first);
+
+    printf(" -- PASS\n");
+
+    // Measure lookup cost of the last entry, the worst case of a linear search.
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        child = table->FindChild(last->GetRloc16(), Child::kInStateValidOrRestoring);
+        VerifyOrQuit(child == last);
+    }
+
+    duration = otPlatAlarmMicroGetNow() - startTime;
+
+    printf("FindChild() with %u children: %u lookups in %u usec\n", kMaxChildren, kNumLookups, duration);
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableLookupHints();
     printf("\nAll tests passed.\n");
     return 0;
 }
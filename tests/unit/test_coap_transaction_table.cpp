@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "coap/coap_message.hpp"
+#include "coap/coap_transaction_table.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+enum : uint8_t
+{
+    kTableSize   = 12,
+    kNumMessages = kTableSize,
+};
+
+typedef Coap::TransactionTableArray<kTableSize> Table;
+
+static Coap::Message *NewMessage(Instance &aInstance, uint16_t aMessageId, uint8_t aToken)
+{
+    Coap::Message *message;
+
+    message = static_cast<Coap::Message *>(aInstance.Get<MessagePool>().New(Message::kTypeIp6, 0));
+    VerifyOrQuit(message != nullptr);
+
+    message->Init(Coap::kTypeConfirmable, Coap::kCodePost);
+    message->SetMessageId(aMessageId);
+    SuccessOrQuit(message->SetToken(&aToken, sizeof(aToken)));
+
+    return message;
+}
+
+static void VerifyHeap(Table &aTable, const bool *aInTable, const uint32_t *aTimes)
+{
+    // The earliest entry must match the smallest time among the
+    // scheduled entries (all entries in the table are scheduled).
+
+    Coap::TransactionTable::Entry *earliest = aTable.GetEarliest();
+    bool                           found    = false;
+    uint32_t                       minTime  = 0;
+
+    for (uint8_t i = 0; i < kNumMessages; i++)
+    {
+        if (aInTable[i] && (!found || aTimes[i] < minTime))
+        {
+            minTime = aTimes[i];
+            found   = true;
+        }
+    }
+
+    VerifyOrQuit(found == (earliest != nullptr), "GetEarliest() failed");
+    VerifyOrQuit(!found || earliest->GetTime().GetValue() == minTime, "GetEarliest() returned wrong entry");
+}
+
+void TestTransactionTable(void)
+{
+    Instance *     instance = testInitInstance();
+    Table          table;
+    Coap::Message *messages[kNumMessages];
+    bool           inTable[kNumMessages];
+    uint32_t       times[kNumMessages];
+
+    VerifyOrQuit(instance != nullptr);
+
+    // Use few distinct tokens and message IDs which collide in the
+    // buckets so that the chains are exercised.
+
+    for (uint8_t i = 0; i < kNumMessages; i++)
+    {
+        messages[i] = NewMessage(*instance, static_cast<uint16_t>(i * kTableSize), i % 3);
+        inTable[i]  = false;
+        times[i]    = 0;
+    }
+
+    VerifyOrQuit(table.GetEarliest() == nullptr);
+    VerifyOrQuit(table.FindWithMessageId(0) == nullptr);
+
+    for (uint8_t i = 0; i < kNumMessages; i++)
+    {
+        Coap::TransactionTable::Entry *entry = table.Add(*messages[i]);
+
+        VerifyOrQuit(entry != nullptr, "Add() failed");
+        VerifyOrQuit(&entry->GetMessage() == messages[i]);
+        VerifyOrQuit(!entry->IsScheduled());
+
+        times[i]   = 1000 + Random::NonCrypto::GetUint16();
+        inTable[i] = true;
+        table.Schedule(*entry, TimeMilli(times[i]));
+        VerifyHeap(table, inTable, times);
+    }
+
+    VerifyOrQuit(table.IsFull());
+    VerifyOrQuit(table.Add(*messages[0]) == nullptr, "Add() did not fail when table was full");
+
+    // Lookups by Message ID and Token, in the order the entries were added.
+
+    for (uint8_t i = 0; i < kNumMessages; i++)
+    {
+        Coap::TransactionTable::Entry *entry = table.FindWithMessageId(messages[i]->GetMessageId());
+        uint8_t                        next  = i % 3;
+
+        VerifyOrQuit(entry != nullptr && &entry->GetMessage() == messages[i], "FindWithMessageId() failed");
+        VerifyOrQuit(table.FindNextWithMessageId(*entry) == nullptr);
+        VerifyOrQuit(table.Find(*messages[i]) == entry, "Find() failed");
+
+        for (entry = table.FindWithToken(*messages[i]); entry != nullptr;
+             entry = table.FindNextWithToken(*entry, *messages[i]))
+        {
+            VerifyOrQuit(&entry->GetMessage() == messages[next], "FindWithToken() failed");
+            next += 3;
+        }
+
+        VerifyOrQuit(next >= kNumMessages, "FindNextWithToken() missed an entry");
+    }
+
+    // Reschedule, unschedule and remove entries and check the heap.
+
+    for (uint16_t iter = 0; iter < 1000; iter++)
+    {
+        uint8_t                        i     = static_cast<uint8_t>(Random::NonCrypto::GetUint8() % kNumMessages);
+        Coap::TransactionTable::Entry *entry = table.Find(*messages[i]);
+
+        VerifyOrQuit((entry != nullptr) == inTable[i]);
+
+        if (entry == nullptr)
+        {
+            entry = table.Add(*messages[i]);
+            VerifyOrQuit(entry != nullptr);
+            times[i] = 1000 + Random::NonCrypto::GetUint16();
+            table.Schedule(*entry, TimeMilli(times[i]));
+            inTable[i] = true;
+        }
+        else if (Random::NonCrypto::GetUint8() & 1)
+        {
+            times[i] = 1000 + Random::NonCrypto::GetUint16();
+            table.Schedule(*entry, TimeMilli(times[i]));
+        }
+        else
+        {
+            table.Remove(*entry);
+            inTable[i] = false;
+            VerifyOrQuit(table.Find(*messages[i]) == nullptr, "Remove() failed");
+        }
+
+        VerifyHeap(table, inTable, times);
+    }
+
+    // Unschedule the remaining entries.
+
+    for (uint8_t i = 0; i < kNumMessages; i++)
+    {
+        if (inTable[i])
+        {
+            table.Unschedule(*table.Find(*messages[i]));
+            inTable[i] = false;
+            VerifyHeap(table, inTable, times);
+        }
+    }
+
+    table.Clear();
+    VerifyOrQuit(!table.IsFull() && table.GetEarliest() == nullptr);
+
+    for (Coap::Message *message : messages)
+    {
+        VerifyOrQuit(table.Find(*message) == nullptr, "Clear() failed");
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestTransactionTable();
+    printf("All tests passed\n");
+    return 0;
+}
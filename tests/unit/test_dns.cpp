@@ -827,7 +827,7 @@ void TestHeaderAndResourceRecords(void)
         SuccessOrQuit(Dns::Name::AppendLabel(instanceLabel, *message));
         SuccessOrQuit(Dns::Name::AppendPointerLabel(serviceNameOffset, *message));
         ptrRecord.SetLength(message->GetLength() - offset - sizeof(Dns::ResourceRecord));
-        message->Write(offset, ptrRecord);
+        SuccessOrQuit(message->Write(offset, ptrRecord));
     }
 
     // Additional section
@@ -850,7 +850,7 @@ void TestHeaderAndResourceRecords(void)
         hostNameOffset = message->GetLength() - headerOffset;
         SuccessOrQuit(Dns::Name::AppendName(kHostName, *message));
         srvRecord.SetLength(message->GetLength() - offset - sizeof(Dns::ResourceRecord));
-        message->Write(offset, srvRecord);
+        SuccessOrQuit(message->Write(offset, srvRecord));
 
         // TXT record
         SuccessOrQuit(Dns::Name::AppendPointerLabel(instanceNameOffset, *message));
@@ -32,6 +32,7 @@
 #include "common/instance.hpp"
 #include "lib/hdlc/hdlc.hpp"
 
+#include "test_platform.h"
 #include "test_util.h"
 
 namespace ot {
@@ -43,6 +44,7 @@ enum
     kMaxFrameLength    = 500,   // Maximum allowed frame length (used when randomly generating frames)
     kFuzzTestIteration = 50000, // Number of iteration during fuzz test (randomly generating frames)
     kFrameHeaderSize   = 4,     // Frame header size
+    kBenchmarkFrames   = 20000, // Number of frames encoded and decoded in the throughput benchmark
 
     kFlagXOn        = 0x11,
     kFlagXOff       = 0x13,
@@ -596,6 +598,24 @@ uint32_t GetRandom(uint32_t max)
     return static_cast<uint32_t>(rand()) % max;
 }
 
+// Calculates the FCS of a frame bit by bit (independently of the lookup tables used by `Hdlc::Encoder`).
+uint16_t CalculateFcs(const uint8_t *aFrame, uint16_t aLength)
+{
+    uint16_t fcs = 0xffff;
+
+    while (aLength--)
+    {
+        fcs ^= *aFrame++;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            fcs = (fcs & 1) ? ((fcs >> 1) ^ 0x8408) : (fcs >> 1);
+        }
+    }
+
+    return fcs ^ 0xffff;
+}
+
 void TestFuzzEncoderDecoder(void)
 {
     uint16_t                       length;
@@ -630,8 +650,17 @@ void TestFuzzEncoderDecoder(void)
         VerifyOrQuit(!encoderBuffer.IsEmpty(), "Encoded frame is empty");
         VerifyOrQuit(encoderBuffer.GetLength() > length, "Encoded frame is too short");
 
+        // Feed the encoded frame to the decoder in randomly sized chunks.
         decoderContext.mWasCalled = false;
-        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+
+        for (uint16_t offset = 0; offset < encoderBuffer.GetLength();)
+        {
+            uint16_t chunkLength = static_cast<uint16_t>(GetRandom(encoderBuffer.GetLength() - offset) + 1);
+
+            decoder.Decode(encoderBuffer.GetFrame() + offset, chunkLength);
+            offset += chunkLength;
+        }
+
         VerifyOrQuit(decoderContext.mWasCalled);
         VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
 
@@ -644,6 +673,100 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void TestFcs(void)
+{
+    uint8_t                        frame[kMaxFrameLength];
+    uint16_t                       length;
+    uint16_t                       fcs;
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+
+    printf("Testing Hdlc::Encoder FCS");
+
+    for (uint16_t iter = 0; iter < 1000; iter++)
+    {
+        const uint8_t *encoded;
+
+        encoderBuffer.Clear();
+
+        length = static_cast<uint16_t>(GetRandom(kMaxFrameLength));
+
+        // Avoid bytes which need escape so that the FCS is found at a fixed position in the encoded frame.
+        for (uint16_t i = 0; i < length; i++)
+        {
+            frame[i] = static_cast<uint8_t>(0x20 + GetRandom(0x50));
+        }
+
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, length));
+        SuccessOrQuit(encoder.EndFrame());
+
+        fcs     = CalculateFcs(frame, length);
+        encoded = encoderBuffer.GetFrame() + 1 + length;
+
+        if (encoderBuffer.GetLength() == length + 4)
+        {
+            VerifyOrQuit(encoded[0] == (fcs & 0xff), "Encoded FCS is incorrect");
+            VerifyOrQuit(encoded[1] == (fcs >> 8), "Encoded FCS is incorrect");
+        }
+        else
+        {
+            VerifyOrQuit(encoded[0] == kEscapeSequence || encoded[1] == kEscapeSequence, "Encoded FCS is incorrect");
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncoderDecoderThroughput(void)
+{
+    static const uint8_t kSpecialRatios[] = {0, 2, 10}; // Percentage of bytes which need escape.
+
+    uint8_t                        frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Benchmarking Hdlc::Encoder and Hdlc::Decoder\n");
+
+    for (uint8_t ratio : kSpecialRatios)
+    {
+        uint32_t encodeTime = 0;
+        uint32_t decodeTime = 0;
+        uint32_t startTime;
+
+        for (uint16_t i = 0; i < kMaxFrameLength; i++)
+        {
+            frame[i] = (GetRandom(100) < ratio) ? kFlagSequence : static_cast<uint8_t>(GetRandom(0x60));
+        }
+
+        for (uint32_t iter = 0; iter < kBenchmarkFrames; iter++)
+        {
+            encoderBuffer.Clear();
+            decoderBuffer.Clear();
+
+            startTime = otPlatAlarmMicroGetNow();
+            SuccessOrQuit(encoder.BeginFrame());
+            SuccessOrQuit(encoder.Encode(frame, kMaxFrameLength));
+            SuccessOrQuit(encoder.EndFrame());
+            encodeTime += otPlatAlarmMicroGetNow() - startTime;
+
+            decoderContext.mWasCalled = false;
+            startTime                 = otPlatAlarmMicroGetNow();
+            decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+            decodeTime += otPlatAlarmMicroGetNow() - startTime;
+
+            VerifyOrQuit(decoderContext.mWasCalled && decoderContext.mError == OT_ERROR_NONE);
+            VerifyOrQuit(decoderBuffer.GetLength() == kMaxFrameLength);
+        }
+
+        printf("%2u%% escaped bytes: encode %5u usec, decode %5u usec for %u frames of %u bytes\n", ratio, encodeTime,
+               decodeTime, kBenchmarkFrames, kMaxFrameLength);
+    }
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -653,6 +776,8 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestFcs();
+    ot::Ncp::TestEncoderDecoderThroughput();
     printf("\nAll tests passed.\n");
     return 0;
 }
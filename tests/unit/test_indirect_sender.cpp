@@ -0,0 +1,356 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/tasklet.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/mle_router.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+enum : uint16_t
+{
+    kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+};
+
+class IndirectSenderTester
+{
+public:
+    static Message *FindIndirectMessage(Child &aChild)
+    {
+        return sInstance->Get<IndirectSender>().FindIndirectMessage(aChild);
+    }
+
+    // Finds the first message destined to the child by scanning the
+    // send queue.
+    static Message *FindIndirectMessageInQueue(Child &aChild)
+    {
+        uint16_t childIndex = sInstance->Get<ChildTable>().GetChildIndex(aChild);
+        Message *message;
+
+        for (message = sInstance->Get<MeshForwarder>().GetSendQueue().GetHead(); message; message = message->GetNext())
+        {
+            if (message->GetChildMask(childIndex))
+            {
+                break;
+            }
+        }
+
+        return message;
+    }
+
+    static uint16_t GetIndirectMessageCountInQueue(Child &aChild)
+    {
+        uint16_t childIndex = sInstance->Get<ChildTable>().GetChildIndex(aChild);
+        uint16_t count      = 0;
+
+        for (Message *message = sInstance->Get<MeshForwarder>().GetSendQueue().GetHead(); message;
+             message          = message->GetNext())
+        {
+            if (message->GetChildMask(childIndex))
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    static void VerifyIndirectMessages(void)
+    {
+        for (Child &child : sInstance->Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            VerifyOrQuit(FindIndirectMessage(child) == FindIndirectMessageInQueue(child),
+                         "First indirect message of child is incorrect");
+            VerifyOrQuit(child.GetIndirectMessageCount() == GetIndirectMessageCountInQueue(child),
+                         "Indirect message count of child is incorrect");
+        }
+    }
+};
+
+static Child *AddSleepyChild(uint16_t aIndex)
+{
+    Child *         child = sInstance->Get<ChildTable>().GetNewChild();
+    Mac::ExtAddress extAddress;
+
+    VerifyOrQuit(child != nullptr);
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[7] = static_cast<uint8_t>(aIndex);
+
+    child->SetState(Child::kStateValid);
+    child->SetRloc16(static_cast<uint16_t>(0x0401 + aIndex));
+    child->SetExtAddress(extAddress);
+    child->SetDeviceMode(Mle::DeviceMode(0));
+    sInstance->Get<ChildTable>().UpdateRloc16Index(*child);
+
+    return child;
+}
+
+// Sends an IPv6 message to `aDestination` through `MeshForwarder`.
+static Message *SendIp6Message(const Ip6::Address &aDestination, Message::Priority aPriority)
+{
+    Message *   message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0, aPriority);
+    Ip6::Header header;
+
+    VerifyOrQuit(message != nullptr);
+
+    header.Init();
+    header.SetPayloadLength(0);
+    header.SetNextHeader(Ip6::kProtoNone);
+    header.SetHopLimit(64);
+    header.GetSource().SetToLinkLocalAddress(sInstance->Get<Mac::Mac>().GetExtAddress());
+    header.SetDestination(aDestination);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(sInstance->Get<MeshForwarder>().SendMessage(*message));
+
+    return message;
+}
+
+// Sends a message to a single sleepy child. The message is queued
+// for direct tx to an unknown unicast destination and then added to
+// the child as done for a message to a sleepy child.
+static Message *SendMessageToChild(Child &aChild, Message::Priority aPriority)
+{
+    Ip6::Address destination;
+    Message *    message;
+
+    SuccessOrQuit(destination.FromString("fd00:1234::1"));
+
+    message = SendIp6Message(destination, aPriority);
+    sInstance->Get<IndirectSender>().AddMessageForSleepyChild(*message, aChild);
+
+    return message;
+}
+
+void TestIndirectSenderQueues(void)
+{
+    Child *  children[kMaxChildren];
+    Message *messages[4];
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        children[i] = AddSleepyChild(i);
+    }
+
+    // Messages with different priorities to the first child.
+
+    messages[0] = SendMessageToChild(*children[0], Message::kPriorityNormal);
+    IndirectSenderTester::VerifyIndirectMessages();
+
+    messages[1] = SendMessageToChild(*children[0], Message::kPriorityLow);
+    IndirectSenderTester::VerifyIndirectMessages();
+    VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*children[0]) == messages[0]);
+
+    messages[2] = SendMessageToChild(*children[0], Message::kPriorityHigh);
+    IndirectSenderTester::VerifyIndirectMessages();
+    VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*children[0]) == messages[2]);
+
+    // Multicast message to all sleepy children.
+
+    messages[3] = SendIp6Message(sInstance->Get<Mle::MleRouter>().GetRealmLocalAllThreadNodesAddress(),
+                                 Message::kPriorityNormal);
+    IndirectSenderTester::VerifyIndirectMessages();
+    VerifyOrQuit(children[0]->GetIndirectMessageCount() == 4);
+
+    for (uint16_t i = 1; i < kMaxChildren; i++)
+    {
+        VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*children[i]) == messages[3]);
+        SendMessageToChild(*children[i], static_cast<Message::Priority>(i % Message::kNumPriorities));
+        IndirectSenderTester::VerifyIndirectMessages();
+    }
+
+    // Remove the first message and a message from the middle.
+
+    SuccessOrQuit(sInstance->Get<IndirectSender>().RemoveMessageFromSleepyChild(*messages[2], *children[0]));
+    IndirectSenderTester::VerifyIndirectMessages();
+    VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*children[0]) == messages[0]);
+
+    SuccessOrQuit(sInstance->Get<IndirectSender>().RemoveMessageFromSleepyChild(*messages[3], *children[0]));
+    IndirectSenderTester::VerifyIndirectMessages();
+    VerifyOrQuit(children[0]->GetIndirectMessageCount() == 2);
+
+    VerifyOrQuit(sInstance->Get<IndirectSender>().RemoveMessageFromSleepyChild(*messages[3], *children[0]) ==
+                 kErrorNotFound);
+
+    // Clear all messages of a child, and switch a child to rx-on-when-idle.
+
+    sInstance->Get<IndirectSender>().ClearAllMessagesForSleepyChild(*children[0]);
+    IndirectSenderTester::VerifyIndirectMessages();
+    VerifyOrQuit(children[0]->GetIndirectMessageCount() == 0);
+    VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*children[0]) == nullptr);
+
+    if (kMaxChildren > 1)
+    {
+        Mle::DeviceMode oldMode = children[1]->GetDeviceMode();
+
+        children[1]->SetDeviceMode(Mle::DeviceMode(Mle::DeviceMode::kModeRxOnWhenIdle));
+        sInstance->Get<IndirectSender>().HandleChildModeChange(*children[1], oldMode);
+        IndirectSenderTester::VerifyIndirectMessages();
+        VerifyOrQuit(children[1]->GetIndirectMessageCount() == 0);
+    }
+
+    printf("TestIndirectSenderQueues() passed\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestIndirectSenderDroppedMessage(void)
+{
+    Child *  children[kMaxChildren];
+    Message *message;
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        children[i] = AddSleepyChild(i);
+    }
+
+    // A realm-local multicast is sent both directly and to all sleepy
+    // children. While detached, its direct tx is dropped, which frees
+    // the message.
+
+    message = SendIp6Message(sInstance->Get<Mle::MleRouter>().GetRealmLocalAllThreadNodesAddress(),
+                             Message::kPriorityNormal);
+    VerifyOrQuit(message->GetDirectTransmission());
+    IndirectSenderTester::VerifyIndirectMessages();
+
+    for (Child *child : children)
+    {
+        VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*child) == message);
+    }
+
+    otTaskletsProcess(sInstance);
+
+    VerifyOrQuit(sInstance->Get<MeshForwarder>().GetSendQueue().GetHead() == nullptr);
+
+    // A data poll from any of the children must find no message.
+
+    for (Child *child : children)
+    {
+        VerifyOrQuit(child->GetIndirectMessageCount() == 0);
+        VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*child) == nullptr);
+    }
+
+    IndirectSenderTester::VerifyIndirectMessages();
+
+    printf("TestIndirectSenderDroppedMessage() passed\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestIndirectSenderPollBenchmark(void)
+{
+    enum : uint16_t
+    {
+        kNumMessages   = 40,
+        kNumPollRounds = 1000,
+    };
+
+    Child *  children[kMaxChildren];
+    uint32_t startTime;
+    uint32_t indexedDuration;
+    uint32_t scanDuration;
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        children[i] = AddSleepyChild(i);
+    }
+
+    // Queue messages to children in turn, so that the first message of
+    // most of the children is further down in the send queue.
+
+    for (uint16_t i = 0; i < kNumMessages; i++)
+    {
+        SendMessageToChild(*children[(kMaxChildren - 1) - (i % kMaxChildren)], Message::kPriorityNormal);
+    }
+
+    IndirectSenderTester::VerifyIndirectMessages();
+
+    // Every data poll from a child looks up its first queued message.
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t round = 0; round < kNumPollRounds; round++)
+    {
+        for (Child *child : children)
+        {
+            VerifyOrQuit(IndirectSenderTester::FindIndirectMessage(*child) != nullptr);
+        }
+    }
+
+    indexedDuration = otPlatAlarmMicroGetNow() - startTime;
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t round = 0; round < kNumPollRounds; round++)
+    {
+        for (Child *child : children)
+        {
+            VerifyOrQuit(IndirectSenderTester::FindIndirectMessageInQueue(*child) != nullptr);
+        }
+    }
+
+    scanDuration = otPlatAlarmMicroGetNow() - startTime;
+
+    printf("TestIndirectSenderPollBenchmark() %u children, %u messages, %u polls: %u usec (send queue scan: %u usec)\n",
+           kMaxChildren, kNumMessages, kNumPollRounds * kMaxChildren, indexedDuration, scanDuration);
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestIndirectSenderQueues();
+    ot::TestIndirectSenderDroppedMessage();
+    ot::TestIndirectSenderPollBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}
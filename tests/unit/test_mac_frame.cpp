@@ -640,6 +640,244 @@ void TestMacFrameAckGeneration(void)
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 }
 
+bool AreAddressesEqual(const Mac::Address &aFirst, const Mac::Address &aSecond)
+{
+    bool isEqual = (aFirst.GetType() == aSecond.GetType());
+
+    if (isEqual && aFirst.IsShort())
+    {
+        isEqual = (aFirst.GetShort() == aSecond.GetShort());
+    }
+    else if (isEqual && aFirst.IsExtended())
+    {
+        isEqual = (aFirst.GetExtended() == aSecond.GetExtended());
+    }
+
+    return isEqual;
+}
+
+void VerifyHeaderDescriptor(Mac::Frame &aFrame, Mac::FrameHeaderDescriptor &aHeader)
+{
+    Mac::Address frameAddress;
+    Mac::Address address;
+    Mac::PanId   framePanId;
+    Mac::PanId   panId;
+    uint8_t      frameValue;
+    uint8_t      value;
+    uint32_t     frameCounter;
+    uint32_t     counter;
+
+    VerifyOrQuit(aHeader.GetHeaderLength() == aFrame.GetHeaderLength());
+    VerifyOrQuit(aHeader.GetFooterLength() == aFrame.GetFooterLength());
+    VerifyOrQuit(aHeader.GetPayload() == aFrame.GetPayload());
+    VerifyOrQuit(aHeader.GetPayloadLength() == aFrame.GetPayloadLength());
+    VerifyOrQuit(aHeader.GetFooter() == aFrame.GetFooter());
+
+    SuccessOrQuit(aFrame.GetDstAddr(frameAddress));
+    SuccessOrQuit(aHeader.GetDstAddr(address));
+    VerifyOrQuit(AreAddressesEqual(address, frameAddress));
+
+    SuccessOrQuit(aFrame.GetSrcAddr(frameAddress));
+    SuccessOrQuit(aHeader.GetSrcAddr(address));
+    VerifyOrQuit(AreAddressesEqual(address, frameAddress));
+
+    VerifyOrQuit((aHeader.GetDstPanId(panId) == kErrorNone) == (aFrame.GetDstPanId(framePanId) == kErrorNone));
+    VerifyOrQuit(!aFrame.IsDstPanIdPresent() || (panId == framePanId));
+
+    VerifyOrQuit((aHeader.GetSrcPanId(panId) == kErrorNone) == (aFrame.GetSrcPanId(framePanId) == kErrorNone));
+    VerifyOrQuit(!aFrame.IsSrcPanIdPresent() || (panId == framePanId));
+
+    if (aFrame.GetSecurityEnabled())
+    {
+        SuccessOrQuit(aFrame.GetSecurityLevel(frameValue));
+        SuccessOrQuit(aHeader.GetSecurityLevel(value));
+        VerifyOrQuit(value == frameValue);
+
+        SuccessOrQuit(aFrame.GetKeyIdMode(frameValue));
+        SuccessOrQuit(aHeader.GetKeyIdMode(value));
+        VerifyOrQuit(value == frameValue);
+
+        SuccessOrQuit(aFrame.GetKeyId(frameValue));
+        SuccessOrQuit(aHeader.GetKeyId(value));
+        VerifyOrQuit(value == frameValue);
+
+        SuccessOrQuit(aFrame.GetFrameCounter(frameCounter));
+        SuccessOrQuit(aHeader.GetFrameCounter(counter));
+        VerifyOrQuit(counter == frameCounter);
+    }
+    else
+    {
+        VerifyOrQuit(aHeader.GetSecurityLevel(value) == kErrorParse);
+        VerifyOrQuit(aHeader.GetKeyIdMode(value) == kErrorParse);
+        VerifyOrQuit(aHeader.GetFrameCounter(counter) == kErrorParse);
+    }
+}
+
+void TestMacFrameHeaderDescriptor(void)
+{
+    static const struct
+    {
+        uint16_t fcf;
+        uint8_t  secCtl;
+    } tests[] = {
+        {Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+             Mac::Frame::kFcfSrcAddrExt,
+         0},
+        {Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrExt |
+             Mac::Frame::kFcfSrcAddrExt | Mac::Frame::kFcfPanidCompression,
+         0},
+        {Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+             Mac::Frame::kFcfSrcAddrShort | Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfSecurityEnabled,
+         Mac::Frame::kSecEncMic32 | Mac::Frame::kKeyIdMode1},
+        {Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+             Mac::Frame::kFcfSrcAddrExt | Mac::Frame::kFcfSecurityEnabled,
+         Mac::Frame::kSecEncMic32 | Mac::Frame::kKeyIdMode2},
+    };
+
+    const uint8_t   kPayloadLength = 80;
+    const uint16_t  kIterations    = 20000;
+    Mac::ExtAddress extAddress;
+    uint8_t         psdu[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame    frame;
+    Mac::Address    srcAddr;
+    Mac::Address    dstAddr;
+    Mac::PanId      panId;
+    uint8_t         securityLevel;
+    uint8_t         keyIdMode;
+    uint8_t         keyId;
+    uint32_t        frameCounter;
+    uint32_t        startTime;
+    uint32_t        frameDuration;
+    uint32_t        headerDuration;
+    uint32_t        sum = 0;
+
+    for (uint8_t i = 0; i < sizeof(extAddress); i++)
+    {
+        extAddress.m8[i] = 0x10 + i;
+    }
+
+    frame.mPsdu      = psdu;
+    frame.mRadioType = 0;
+
+    for (const auto &test : tests)
+    {
+        Mac::FrameHeaderDescriptor header;
+
+        memset(psdu, 0, sizeof(psdu));
+        frame.mLength = 0;
+        frame.InitMacHeader(test.fcf, test.secCtl);
+        frame.SetPayloadLength(kPayloadLength);
+        frame.SetDstPanId(0xface);
+        IgnoreError(frame.SetSrcPanId(0xface));
+
+        if ((test.fcf & Mac::Frame::kFcfDstAddrMask) == Mac::Frame::kFcfDstAddrShort)
+        {
+            frame.SetDstAddr(static_cast<Mac::ShortAddress>(0x1234));
+        }
+        else
+        {
+            frame.SetDstAddr(extAddress);
+        }
+
+        if ((test.fcf & Mac::Frame::kFcfSrcAddrMask) == Mac::Frame::kFcfSrcAddrShort)
+        {
+            frame.SetSrcAddr(static_cast<Mac::ShortAddress>(0x5678));
+        }
+        else
+        {
+            frame.SetSrcAddr(extAddress);
+        }
+
+        if (frame.GetSecurityEnabled())
+        {
+            frame.SetFrameCounter(0x01020304);
+            frame.SetKeyId(7);
+        }
+
+        SuccessOrQuit(header.Parse(frame));
+        VerifyHeaderDescriptor(frame, header);
+
+        // Changing the frame length or the security control must be
+        // picked up by the descriptor.
+
+        frame.SetPayloadLength(kPayloadLength / 2);
+        VerifyHeaderDescriptor(frame, header);
+
+        if (frame.GetSecurityEnabled())
+        {
+            frame.SetSecurityControlField(Mac::Frame::kSecEncMic64 | Mac::Frame::kKeyIdMode1);
+            VerifyHeaderDescriptor(frame, header);
+        }
+
+        // A truncated frame must fail to parse.
+
+        frame.mLength = frame.GetHeaderLength();
+        VerifyOrQuit(header.Parse(frame) == kErrorParse);
+        VerifyOrQuit(frame.ValidatePsdu() == kErrorParse);
+        VerifyOrQuit(header.GetPayload() == nullptr);
+        VerifyOrQuit(header.GetSrcAddr(srcAddr) == kErrorParse);
+    }
+
+    // Compare extracting the fields used on the receive path through the
+    // `Frame` accessors against extracting them through the descriptor.
+
+    memset(psdu, 0, sizeof(psdu));
+    frame.mLength = 0;
+    frame.InitMacHeader(tests[2].fcf, tests[2].secCtl);
+    frame.SetPayloadLength(kPayloadLength);
+    frame.SetDstPanId(0xface);
+    frame.SetDstAddr(static_cast<Mac::ShortAddress>(0x1234));
+    frame.SetSrcAddr(static_cast<Mac::ShortAddress>(0x5678));
+    frame.SetFrameCounter(0x01020304);
+    frame.SetKeyId(7);
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t iter = 0; iter < kIterations; iter++)
+    {
+        SuccessOrQuit(frame.ValidatePsdu());
+        IgnoreError(frame.GetSrcAddr(srcAddr));
+        IgnoreError(frame.GetDstAddr(dstAddr));
+        IgnoreError(frame.GetDstPanId(panId));
+        IgnoreError(frame.GetSecurityLevel(securityLevel));
+        IgnoreError(frame.GetFrameCounter(frameCounter));
+        IgnoreError(frame.GetKeyIdMode(keyIdMode));
+        IgnoreError(frame.GetKeyId(keyId));
+        sum += frame.GetHeaderLength() + frame.GetPayloadLength() + frame.GetFooterLength();
+        sum += static_cast<uint32_t>(frame.GetFooter() - frame.GetPayload());
+        IgnoreError(frame.GetSrcPanId(panId));
+        sum += frame.GetPayloadLength() + *frame.GetPayload();
+    }
+
+    frameDuration = otPlatAlarmMicroGetNow() - startTime;
+    startTime     = otPlatAlarmMicroGetNow();
+
+    for (uint16_t iter = 0; iter < kIterations; iter++)
+    {
+        Mac::FrameHeaderDescriptor header;
+
+        SuccessOrQuit(header.Parse(frame));
+        IgnoreError(header.GetSrcAddr(srcAddr));
+        IgnoreError(header.GetDstAddr(dstAddr));
+        IgnoreError(header.GetDstPanId(panId));
+        IgnoreError(header.GetSecurityLevel(securityLevel));
+        IgnoreError(header.GetFrameCounter(frameCounter));
+        IgnoreError(header.GetKeyIdMode(keyIdMode));
+        IgnoreError(header.GetKeyId(keyId));
+        sum -= header.GetHeaderLength() + header.GetPayloadLength() + header.GetFooterLength();
+        sum -= static_cast<uint32_t>(header.GetFooter() - header.GetPayload());
+        IgnoreError(header.GetSrcPanId(panId));
+        sum -= header.GetPayloadLength() + *header.GetPayload();
+    }
+
+    headerDuration = otPlatAlarmMicroGetNow() - startTime;
+
+    VerifyOrQuit(sum == 0);
+
+    printf("RX header processing x %u: Frame accessors %u usec, FrameHeaderDescriptor %u usec\n", kIterations,
+           frameDuration, headerDuration);
+}
+
 } // namespace ot
 
 int main(void)
@@ -650,6 +888,7 @@ int main(void)
     ot::TestMacChannelMask();
     ot::TestMacFrameApi();
     ot::TestMacFrameAckGeneration();
+    ot::TestMacFrameHeaderDescriptor();
     printf("All tests passed\n");
     return 0;
 }
@@ -30,6 +30,7 @@
 #include "common/instance.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
+#include "common/tlvs.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -64,7 +65,7 @@ void TestMessage(void)
 
     VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr);
     SuccessOrQuit(message->SetLength(kMaxSize));
-    message->WriteBytes(0, writeBuffer, kMaxSize);
+    SuccessOrQuit(message->WriteBytes(0, writeBuffer, kMaxSize));
     SuccessOrQuit(message->Read(0, readBuffer, kMaxSize));
     VerifyOrQuit(memcmp(writeBuffer, readBuffer, kMaxSize) == 0);
     VerifyOrQuit(message->CompareBytes(0, readBuffer, kMaxSize));
@@ -80,7 +81,7 @@ void TestMessage(void)
                 writeBuffer[offset + i]++;
             }
 
-            message->WriteBytes(offset, &writeBuffer[offset], length);
+            SuccessOrQuit(message->WriteBytes(offset, &writeBuffer[offset], length));
 
             SuccessOrQuit(message->Read(0, readBuffer, kMaxSize));
             VerifyOrQuit(memcmp(writeBuffer, readBuffer, kMaxSize) == 0);
@@ -144,7 +145,7 @@ void TestMessage(void)
             {
                 uint16_t bytesCopied;
 
-                message2->WriteBytes(0, zeroBuffer, kMaxSize);
+                SuccessOrQuit(message2->WriteBytes(0, zeroBuffer, kMaxSize));
 
                 bytesCopied = message->CopyTo(srcOffset, dstOffset, length, *message2);
 
@@ -177,7 +178,7 @@ void TestMessage(void)
     {
         uint16_t bytesCopied;
 
-        message->WriteBytes(0, writeBuffer, kMaxSize);
+        SuccessOrQuit(message->WriteBytes(0, writeBuffer, kMaxSize));
 
         bytesCopied = message->CopyTo(srcOffset, 0, kMaxSize, *message);
         VerifyOrQuit(bytesCopied == kMaxSize - srcOffset, "CopyTo() failed");
@@ -192,7 +193,7 @@ void TestMessage(void)
 
     // Verify `AppendBytesFromMessage()` with two different messages as source and destination.
 
-    message->WriteBytes(0, writeBuffer, kMaxSize);
+    SuccessOrQuit(message->WriteBytes(0, writeBuffer, kMaxSize));
 
     for (uint16_t srcOffset = 0; srcOffset < kMaxSize; srcOffset += kOffsetStep)
     {
@@ -236,11 +237,251 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageSharing(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize    = (kBufferSize * 4 + 24),
+        kShortSize  = kBufferSize + 10,
+        kHeaderSize = 10,
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    Message *    copy;
+    Message *    shortCopy;
+    uint8_t      writeBuffer[kMaxSize];
+    uint8_t      readBuffer[kMaxSize];
+    uint8_t      header[kHeaderSize];
+    uint16_t     initialFreeBuffers;
+    uint16_t     freeBuffers;
+    uint8_t      byte;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+    Random::NonCrypto::FillBuffer(header, kHeaderSize);
+
+    initialFreeBuffers = messagePool->GetFreeBufferCount();
+    freeBuffers        = initialFreeBuffers;
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize));
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers - message->GetBufferCount());
+    VerifyOrQuit(messagePool->GetSavedBufferCount() == 0);
+
+    // The copy only allocates its first buffer (the buffers are copied
+    // when using the heap or platform message management).
+    VerifyOrQuit((copy = message->CloneShared()) != nullptr);
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers - message->GetBufferCount() - 1);
+    VerifyOrQuit(messagePool->GetSavedBufferCount() == message->GetBufferCount() - 1);
+#endif
+    VerifyOrQuit(copy->GetLength() == kMaxSize);
+    VerifyOrQuit(copy->GetBufferCount() == message->GetBufferCount());
+    VerifyOrQuit(copy->CompareBytes(0, *message, 0, kMaxSize));
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    // Writing to a shared buffer fails without changing the copy when
+    // no buffer is available.
+    Message *filler = messagePool->New(Message::kTypeIp6, 0);
+
+    VerifyOrQuit(filler != nullptr);
+    byte = 0;
+
+    while (filler->Append(byte) == kErrorNone)
+    {
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == 0);
+    VerifyOrQuit(copy->Write(kMaxSize / 2, byte) == kErrorNoBufs);
+    VerifyOrQuit(copy->CompareBytes(0, *message, 0, kMaxSize));
+    VerifyOrQuit(message->CopyTo(0, 0, kMaxSize, *copy) < kMaxSize);
+    VerifyOrQuit(copy->CompareBytes(0, *message, 0, kMaxSize));
+    filler->Free();
+#endif
+
+    // Writing to the copy does not change the original message and vice versa.
+    byte = writeBuffer[kMaxSize / 2] + 1;
+    SuccessOrQuit(copy->Write(kMaxSize / 2, byte));
+    VerifyOrQuit(copy->CompareBytes(0, writeBuffer, kMaxSize / 2));
+    VerifyOrQuit(copy->Compare(kMaxSize / 2, byte));
+    VerifyOrQuit(copy->CompareBytes(kMaxSize / 2 + 1, writeBuffer + kMaxSize / 2 + 1, kMaxSize / 2 - 1));
+    VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMaxSize));
+
+    SuccessOrQuit(message->Write(kMaxSize - 1, byte));
+    VerifyOrQuit(message->Compare(kMaxSize - 1, byte));
+    VerifyOrQuit(copy->CompareBytes(kMaxSize / 2 + 1, writeBuffer + kMaxSize / 2 + 1, kMaxSize / 2 - 1));
+    SuccessOrQuit(message->Write(kMaxSize - 1, writeBuffer[kMaxSize - 1]));
+
+    // Growing and prepending to the copy does not change the original message.
+    SuccessOrQuit(copy->AppendBytes(writeBuffer, kMaxSize / 2));
+    SuccessOrQuit(copy->PrependBytes(header, kHeaderSize));
+    VerifyOrQuit(copy->CompareBytes(0, header, kHeaderSize));
+    VerifyOrQuit(copy->CompareBytes(kHeaderSize + kMaxSize, writeBuffer, kMaxSize / 2));
+    VerifyOrQuit(message->GetLength() == kMaxSize);
+    VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMaxSize));
+
+    copy->Free();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers - message->GetBufferCount());
+    VerifyOrQuit(messagePool->GetSavedBufferCount() == 0);
+
+    // The original message writes in place past the end of a shorter copy.
+    VerifyOrQuit((shortCopy = message->CloneShared(kShortSize)) != nullptr);
+    freeBuffers = messagePool->GetFreeBufferCount();
+
+    SuccessOrQuit(message->Write(kShortSize, byte));
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers);
+    VerifyOrQuit(message->Compare(kShortSize, byte));
+    SuccessOrQuit(message->Write(kShortSize, writeBuffer[kShortSize]));
+
+    // Shrinking and growing the original message does not change the copy.
+    VerifyOrQuit((copy = message->CloneShared()) != nullptr);
+    freeBuffers = messagePool->GetFreeBufferCount();
+
+    SuccessOrQuit(message->SetLength(kMaxSize / 2));
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers);
+#endif
+    SuccessOrQuit(message->AppendBytes(header, kHeaderSize));
+    VerifyOrQuit(message->CompareBytes(kMaxSize / 2, header, kHeaderSize));
+    VerifyOrQuit(copy->CompareBytes(0, writeBuffer, kMaxSize));
+    VerifyOrQuit(shortCopy->GetLength() == kShortSize);
+    VerifyOrQuit(shortCopy->CompareBytes(0, writeBuffer, kShortSize));
+
+    // Freeing the original message first keeps the buffers of the copies.
+    message->Free();
+    SuccessOrQuit(copy->Read(0, readBuffer, kMaxSize));
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, kMaxSize) == 0);
+    VerifyOrQuit(shortCopy->CompareBytes(0, writeBuffer, kShortSize));
+
+    copy->Free();
+    shortCopy->Free();
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == initialFreeBuffers);
+    VerifyOrQuit(messagePool->GetSavedBufferCount() == 0);
+
+    testFreeInstance(instance);
+}
+
+void TestMessageCachedBuffer(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize    = (kBufferSize * 5 + 24),
+        kHeaderSize = 30,
+        kNumReads   = 2000,
+        kTlvSize    = 10,
+        kNumParses  = 200,
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    uint8_t      writeBuffer[kMaxSize];
+    uint8_t      readBuffer[kMaxSize];
+    uint8_t      header[kHeaderSize];
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+    Random::NonCrypto::FillBuffer(header, kHeaderSize);
+
+    // Reads and writes at random offsets, interleaved with changes to
+    // the buffer chain, always see the message content.
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize));
+
+    for (uint16_t i = 0; i < kNumReads; i++)
+    {
+        uint16_t offset = Random::NonCrypto::GetUint16InRange(0, message->GetLength());
+        uint16_t length = Random::NonCrypto::GetUint16InRange(0, message->GetLength() - offset + 1);
+
+        SuccessOrQuit(message->Read(offset, readBuffer, length));
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer + offset, length) == 0);
+
+        switch (i % 100)
+        {
+        case 10:
+            SuccessOrQuit(message->SetLength(kMaxSize / 3));
+            SuccessOrQuit(message->AppendBytes(writeBuffer + kMaxSize / 3, kMaxSize - kMaxSize / 3));
+            break;
+
+        case 20:
+            SuccessOrQuit(message->PrependBytes(header, kHeaderSize));
+            VerifyOrQuit(message->CompareBytes(0, header, kHeaderSize));
+            message->RemoveHeader(kHeaderSize);
+            break;
+
+        case 30:
+            SuccessOrQuit(message->WriteBytes(offset, writeBuffer + offset, length));
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMaxSize));
+    message->Free();
+
+    // Benchmark searching for a missing TLV (i.e., parsing all TLVs)
+    // in messages from 1 to 20 buffers long.
+
+    for (uint16_t numBuffers = 1; numBuffers <= 20; numBuffers++)
+    {
+        uint8_t  tlv[kTlvSize];
+        uint16_t offset;
+        uint32_t startTime;
+        uint32_t duration;
+
+        VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr);
+
+        memset(tlv, 0, sizeof(tlv));
+        tlv[1] = kTlvSize - sizeof(Tlv);
+
+        // Fill the message with TLVs up to `numBuffers` buffers.
+
+        while (message->GetBufferCount() <= numBuffers)
+        {
+            SuccessOrQuit(message->AppendBytes(tlv, kTlvSize));
+        }
+
+        SuccessOrQuit(message->SetLength(message->GetLength() - kTlvSize));
+        VerifyOrQuit(message->GetBufferCount() == numBuffers);
+
+        startTime = otPlatAlarmMicroGetNow();
+
+        for (uint16_t i = 0; i < kNumParses; i++)
+        {
+            VerifyOrQuit(Tlv::FindTlvOffset(*message, /* aType */ 1, offset) == kErrorNotFound);
+        }
+
+        duration = otPlatAlarmMicroGetNow() - startTime;
+
+        printf("Parsing %3u TLVs in %2u buffers x %u: %6u usec\n", message->GetLength() / kTlvSize, numBuffers,
+               kNumParses, duration);
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+    ot::TestMessageSharing();
+    ot::TestMessageCachedBuffer();
     printf("All tests passed\n");
     return 0;
 }
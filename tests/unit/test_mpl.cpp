@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "net/ip6_mpl.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+static Instance *sInstance;
+
+enum : uint16_t
+{
+    kNumSeedEntries      = OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES,
+    kNumBufferedMessages = OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_ENTRIES,
+};
+
+// Processes an MPL option received from another device and returns the result.
+Error ProcessMplOption(uint16_t aSeedId, uint8_t aSequence, uint8_t aHopLimit = 64)
+{
+    Error          error;
+    Message *      message;
+    Ip6::Header    header;
+    Ip6::OptionMpl option;
+    Ip6::Address   source;
+    bool           receive = true;
+
+    message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr);
+
+    header.Init();
+    header.SetHopLimit(aHopLimit);
+    SuccessOrQuit(message->Append(header));
+    message->SetOffset(sizeof(header));
+
+    option.Init();
+    option.SetSeedIdLength(Ip6::OptionMpl::kSeedIdLength2);
+    option.SetSeedId(aSeedId);
+    option.SetSequence(aSequence);
+    SuccessOrQuit(message->Append(option));
+
+    source.Clear();
+    error = sInstance->Get<Ip6::Mpl>().ProcessOption(*message, source, /* aIsOutbound */ false, receive);
+    VerifyOrQuit(receive, "ProcessOption() cleared aReceive for a received message");
+
+    message->Free();
+
+    return error;
+}
+
+void TestMplSeedSetDuplicates(void)
+{
+    const Ip6::Mpl::Counters &counters = sInstance->Get<Ip6::Mpl>().GetCounters();
+
+    sInstance->Get<Ip6::Mpl>().ResetCounters();
+
+    SuccessOrQuit(ProcessMplOption(0x0400, 5));
+    SuccessOrQuit(ProcessMplOption(0x0400, 7));
+    SuccessOrQuit(ProcessMplOption(0x0400, 6));
+    SuccessOrQuit(ProcessMplOption(0x0800, 5));
+
+    // Seed Ids 0x0400 and 0x0c00 map to different buckets, 0x0001 shares one with 0x0400.
+    SuccessOrQuit(ProcessMplOption(0x0001, 5));
+    SuccessOrQuit(ProcessMplOption(0x0c00, 5));
+
+    VerifyOrQuit(ProcessMplOption(0x0400, 5) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0400, 6) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0400, 7) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0800, 5) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0001, 5) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0c00, 5) == kErrorDrop);
+
+    VerifyOrQuit(counters.mDuplicates == 6);
+    VerifyOrQuit(counters.mSeedSetFull == 0);
+
+    // Sequence numbers wrap around.
+    SuccessOrQuit(ProcessMplOption(0x0800, 255));
+    SuccessOrQuit(ProcessMplOption(0x0800, 0));
+    VerifyOrQuit(ProcessMplOption(0x0800, 255) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0800, 0) == kErrorDrop);
+
+    VerifyOrQuit(counters.mDuplicates == 8);
+
+    sInstance->Get<Ip6::Mpl>().ResetCounters();
+    VerifyOrQuit(counters.mDuplicates == 0);
+
+    printf("TestMplSeedSetDuplicates() passed\n");
+}
+
+void TestMplSeedSetFull(void)
+{
+    const Ip6::Mpl::Counters &counters = sInstance->Get<Ip6::Mpl>().GetCounters();
+
+    sInstance->Get<Ip6::Mpl>().ResetCounters();
+
+    // Fill the Seed Set with one entry per Seed Id.
+    for (uint16_t seedId = 1; seedId <= kNumSeedEntries; seedId++)
+    {
+        SuccessOrQuit(ProcessMplOption(seedId, 10));
+    }
+
+    // A new Seed Id cannot evict a group with a single entry.
+    VerifyOrQuit(ProcessMplOption(kNumSeedEntries + 1, 10) == kErrorDrop);
+    VerifyOrQuit(counters.mSeedSetFull == 1);
+
+    // A newer Sequence evicts the oldest entry of its own group.
+    SuccessOrQuit(ProcessMplOption(1, 11));
+    VerifyOrQuit(ProcessMplOption(1, 11) == kErrorDrop);
+    VerifyOrQuit(counters.mDuplicates == 1);
+
+    // Sequence older than the oldest stored one in the group is dropped.
+    VerifyOrQuit(ProcessMplOption(1, 10) == kErrorDrop);
+    VerifyOrQuit(counters.mSeedSetFull == 2);
+
+    // The other groups are left unchanged.
+    for (uint16_t seedId = 2; seedId <= kNumSeedEntries; seedId++)
+    {
+        VerifyOrQuit(ProcessMplOption(seedId, 10) == kErrorDrop);
+    }
+
+    VerifyOrQuit(counters.mDuplicates == kNumSeedEntries);
+
+    printf("TestMplSeedSetFull() passed\n");
+}
+
+void TestMplSeedSetEvictLargestGroup(void)
+{
+    const Ip6::Mpl::Counters &counters = sInstance->Get<Ip6::Mpl>().GetCounters();
+
+    sInstance->Get<Ip6::Mpl>().ResetCounters();
+
+    // Fill the Seed Set with a group of three entries and single entry groups.
+    SuccessOrQuit(ProcessMplOption(0x0400, 1));
+    SuccessOrQuit(ProcessMplOption(0x0400, 2));
+    SuccessOrQuit(ProcessMplOption(0x0400, 3));
+
+    for (uint16_t seedId = 1; seedId <= kNumSeedEntries - 3; seedId++)
+    {
+        SuccessOrQuit(ProcessMplOption(seedId, 10));
+    }
+
+    // New Seed Ids evict from the largest group, down to two entries each.
+    SuccessOrQuit(ProcessMplOption(0x0800, 1));
+    SuccessOrQuit(ProcessMplOption(0x0c00, 1));
+    VerifyOrQuit(ProcessMplOption(0x1000, 1) == kErrorDrop);
+    VerifyOrQuit(counters.mSeedSetFull == 1);
+
+    VerifyOrQuit(ProcessMplOption(0x0400, 3) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0800, 1) == kErrorDrop);
+    VerifyOrQuit(ProcessMplOption(0x0c00, 1) == kErrorDrop);
+    VerifyOrQuit(counters.mDuplicates == 3);
+
+    printf("TestMplSeedSetEvictLargestGroup() passed\n");
+}
+
+#if OPENTHREAD_FTD
+uint16_t GetNumBufferedMessages(void)
+{
+    uint16_t messageCount;
+    uint16_t bufferCount;
+
+    sInstance->Get<Ip6::Mpl>().GetBufferedMessageSet().GetInfo(messageCount, bufferCount);
+
+    return messageCount;
+}
+
+void TestMplBufferedMessageEviction(void)
+{
+    Ip6::Mpl &                mpl      = sInstance->Get<Ip6::Mpl>();
+    const Ip6::Mpl::Counters &counters = mpl.GetCounters();
+
+    mpl.ResetCounters();
+    mpl.SetTimerExpirations(3);
+
+    // Fill all the buffered message entries.
+    for (uint8_t sequence = 1; sequence <= kNumBufferedMessages; sequence++)
+    {
+        SuccessOrQuit(ProcessMplOption(0x0400, sequence));
+    }
+
+    VerifyOrQuit(GetNumBufferedMessages() == kNumBufferedMessages);
+    VerifyOrQuit(counters.mBufferedEvicted == 0);
+
+    // New messages evict buffered ones instead of not being forwarded.
+    SuccessOrQuit(ProcessMplOption(0x0400, kNumBufferedMessages + 1));
+    SuccessOrQuit(ProcessMplOption(0x0800, 1));
+
+    VerifyOrQuit(GetNumBufferedMessages() == kNumBufferedMessages);
+    VerifyOrQuit(counters.mBufferedEvicted == 2);
+    VerifyOrQuit(counters.mNotBuffered == 0);
+
+    // A message at the end of its hop limit is not forwarded, nor counted.
+    SuccessOrQuit(ProcessMplOption(0x0c00, 1, /* aHopLimit */ 1));
+
+    VerifyOrQuit(GetNumBufferedMessages() == kNumBufferedMessages);
+    VerifyOrQuit(counters.mBufferedEvicted == 2);
+    VerifyOrQuit(counters.mNotBuffered == 0);
+
+    printf("TestMplBufferedMessageEviction() passed\n");
+}
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+    ot::sInstance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(ot::sInstance != nullptr);
+    ot::TestMplSeedSetDuplicates();
+    testFreeInstance(ot::sInstance);
+
+    ot::sInstance = static_cast<ot::Instance *>(testInitInstance());
+    ot::TestMplSeedSetFull();
+    testFreeInstance(ot::sInstance);
+
+    ot::sInstance = static_cast<ot::Instance *>(testInitInstance());
+    ot::TestMplSeedSetEvictLargestGroup();
+    testFreeInstance(ot::sInstance);
+
+#if OPENTHREAD_FTD
+    ot::sInstance = static_cast<ot::Instance *>(testInitInstance());
+    ot::TestMplBufferedMessageEviction();
+    testFreeInstance(ot::sInstance);
+#endif
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -446,6 +446,144 @@ void TestNetworkDataDsnSrpServices(void)
     testFreeInstance(instance);
 }
 
+
+void TestNetworkDataLookups(void)
+{
+    static constexpr uint8_t  kNumPrefixes     = 10;
+    static constexpr uint16_t kNumLookupRounds = 20000;
+
+    ot::Instance *  instance;
+    Message *       message;
+    uint8_t         tlvs[2 + NetworkData::kMaxSize];
+    uint8_t         length = 2;
+    Ip6::Address    source;
+    Ip6::Address    destination;
+    Ip6::Address    other;
+    Lowpan::Context context;
+    uint16_t        rloc16;
+    uint8_t         prefixMatchLength;
+    uint32_t        startTime;
+    uint32_t        duration;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataLookups()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    // Prefix TLVs for 2001:db8:0:<i>::/64, each with a Border Router TLV
+    // (on-mesh, default route) and a 6LoWPAN Context TLV (ID i + 1).
+    // The first prefix has a second border router with high preference.
+
+    for (uint8_t i = 0; i < kNumPrefixes; i++)
+    {
+        const uint8_t prefix[]   = {0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, i};
+        uint8_t       brTlvSize  = (i == 0) ? 10 : 6;
+        uint8_t       rloc16High = static_cast<uint8_t>((i + 1) << 2);
+
+        tlvs[length++] = 0x03; // Prefix TLV (stable)
+        tlvs[length++] = static_cast<uint8_t>(2 + sizeof(prefix) + brTlvSize + 4);
+        tlvs[length++] = 0x00; // Domain ID
+        tlvs[length++] = 64;   // Prefix length
+        memcpy(&tlvs[length], prefix, sizeof(prefix));
+        length += sizeof(prefix);
+
+        tlvs[length++] = 0x05; // Border Router TLV (stable)
+        tlvs[length++] = static_cast<uint8_t>(brTlvSize - 2);
+        tlvs[length++] = rloc16High;
+        tlvs[length++] = 0x00;
+        tlvs[length++] = 0x03; // R and O flags, medium preference
+        tlvs[length++] = 0x00;
+
+        if (i == 0)
+        {
+            tlvs[length++] = 0xfc;
+            tlvs[length++] = 0x00;
+            tlvs[length++] = 0x43; // R and O flags, high preference
+            tlvs[length++] = 0x00;
+        }
+
+        tlvs[length++] = 0x07; // 6LoWPAN Context TLV (stable)
+        tlvs[length++] = 0x02;
+        tlvs[length++] = static_cast<uint8_t>(0x10 | (i + 1)); // Compress flag and Context ID
+        tlvs[length++] = 64;
+    }
+
+    {
+        // External route 2001:4860::/32 with a low and a high preference entry.
+        const uint8_t kExternalRoute[] = {0x03, 0x0e, 0x00, 0x20, 0x20, 0x01, 0x48, 0x60, 0x01,
+                                          0x06, 0x50, 0x00, 0xc0, 0x54, 0x00, 0x40};
+
+        memcpy(&tlvs[length], kExternalRoute, sizeof(kExternalRoute));
+        length += sizeof(kExternalRoute);
+    }
+
+    tlvs[0] = 0x0c; // MLE Network Data TLV
+    tlvs[1] = static_cast<uint8_t>(length - 2);
+
+    printf("Network Data length: %u\n", tlvs[1]);
+
+    message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(tlvs, length));
+    SuccessOrQuit(instance->Get<Leader>().SetNetworkData(0, 0, /* aStableOnly */ false, *message, 0));
+    message->Free();
+
+    SuccessOrQuit(source.FromString("2001:db8:0:3::1234"));
+    SuccessOrQuit(destination.FromString("2001:4860::8888"));
+    SuccessOrQuit(other.FromString("2001:db9::1"));
+
+    for (uint8_t i = 0; i < kNumPrefixes; i++)
+    {
+        Ip6::Address address;
+
+        address               = source;
+        address.mFields.m8[7] = i;
+
+        SuccessOrQuit(instance->Get<Leader>().GetContext(address, context));
+        VerifyOrQuit(context.mContextId == i + 1);
+        VerifyOrQuit(context.mCompressFlag);
+        VerifyOrQuit(context.mPrefix.GetLength() == 64);
+
+        SuccessOrQuit(instance->Get<Leader>().GetContext(i + 1, context));
+        VerifyOrQuit(address.MatchesPrefix(context.mPrefix));
+
+        VerifyOrQuit(instance->Get<Leader>().IsOnMesh(address));
+
+        // No external route for the destination, the default route of
+        // the source prefix is used (the high preference one for prefix 0).
+
+        SuccessOrQuit(instance->Get<Leader>().RouteLookup(address, address, &prefixMatchLength, &rloc16));
+        VerifyOrQuit(prefixMatchLength == 0);
+        VerifyOrQuit(rloc16 == ((i == 0) ? 0xfc00 : ((i + 1) << 10)));
+    }
+
+    SuccessOrQuit(instance->Get<Leader>().RouteLookup(source, destination, &prefixMatchLength, &rloc16));
+    VerifyOrQuit(prefixMatchLength == 32);
+    VerifyOrQuit(rloc16 == 0x5400);
+
+    VerifyOrQuit(instance->Get<Leader>().GetContext(kNumPrefixes + 1, context) == kErrorNotFound);
+    VerifyOrQuit(instance->Get<Leader>().GetContext(destination, context) == kErrorNotFound);
+    VerifyOrQuit(!instance->Get<Leader>().IsOnMesh(destination));
+    VerifyOrQuit(instance->Get<Leader>().RouteLookup(other, destination, nullptr, nullptr) == kErrorNoRoute);
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t round = 0; round < kNumLookupRounds; round++)
+    {
+        SuccessOrQuit(instance->Get<Leader>().GetContext(source, context));
+        SuccessOrQuit(instance->Get<Leader>().GetContext(context.mContextId, context));
+        VerifyOrQuit(!instance->Get<Leader>().IsOnMesh(destination));
+        SuccessOrQuit(instance->Get<Leader>().RouteLookup(source, destination, nullptr, &rloc16));
+    }
+
+    duration = otPlatAlarmMicroGetNow() - startTime;
+
+    printf("%u rounds of context, on-mesh and route lookups in %u usec\n", kNumLookupRounds, duration);
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -456,6 +594,7 @@ int main(void)
     ot::NetworkData::TestNetworkDataFindNextService();
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
+    ot::NetworkData::TestNetworkDataLookups();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "common/pairing_heap.hpp"
+
+#include "test_util.h"
+
+class Entry;
+
+class KeyCompare
+{
+public:
+    explicit KeyCompare(bool aReversed = false)
+        : mReversed(aReversed)
+    {
+    }
+
+    bool operator()(const Entry &aFirst, const Entry &aSecond) const;
+
+private:
+    bool mReversed;
+};
+
+class Entry
+{
+    template <typename, typename> friend class ot::PairingHeap;
+
+public:
+    Entry(void)
+        : mKey(0)
+        , mHeapChild(nullptr)
+        , mHeapNext(nullptr)
+        , mHeapPrev(nullptr)
+    {
+    }
+
+    uint16_t GetKey(void) const { return mKey; }
+    void     SetKey(uint16_t aKey) { mKey = aKey; }
+
+private:
+    uint16_t mKey;
+    Entry *  mHeapChild;
+    Entry *  mHeapNext;
+    Entry *  mHeapPrev;
+};
+
+bool KeyCompare::operator()(const Entry &aFirst, const Entry &aSecond) const
+{
+    return mReversed ? (aFirst.GetKey() > aSecond.GetKey()) : (aFirst.GetKey() < aSecond.GetKey());
+}
+
+typedef ot::PairingHeap<Entry, KeyCompare> Heap;
+
+// This function removes all entries from the top of the heap and verifies they come out in order.
+void VerifyHeapOrder(Heap &aHeap, uint16_t aNumEntries, const KeyCompare &aCompare)
+{
+    Entry *prev = nullptr;
+
+    for (uint16_t num = 0; num < aNumEntries; num++)
+    {
+        Entry *top = aHeap.GetTop();
+
+        VerifyOrQuit(top != nullptr, "heap has fewer entries than expected");
+        VerifyOrQuit(aHeap.Contains(*top));
+        VerifyOrQuit(prev == nullptr || !aCompare(*top, *prev), "entries are out of order");
+
+        aHeap.Remove(*top, aCompare);
+        VerifyOrQuit(!aHeap.Contains(*top));
+        prev = top;
+    }
+
+    VerifyOrQuit(aHeap.IsEmpty(), "heap has more entries than expected");
+    VerifyOrQuit(aHeap.GetTop() == nullptr);
+}
+
+void TestPairingHeap(void)
+{
+    static constexpr uint16_t kNumEntries = 8;
+
+    Heap  heap;
+    Entry entries[kNumEntries];
+
+    printf("TestPairingHeap");
+
+    VerifyOrQuit(heap.IsEmpty());
+    VerifyOrQuit(heap.GetTop() == nullptr);
+
+    // Add entries in ascending, descending and interleaved key order.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        entries[i].SetKey(i);
+        VerifyOrQuit(!heap.Contains(entries[i]));
+        heap.Add(entries[i]);
+        VerifyOrQuit(heap.Contains(entries[i]));
+        VerifyOrQuit(heap.GetTop() == &entries[0]);
+    }
+
+    VerifyHeapOrder(heap, kNumEntries, KeyCompare());
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        entries[i].SetKey(kNumEntries - i);
+        heap.Add(entries[i]);
+        VerifyOrQuit(heap.GetTop() == &entries[i]);
+    }
+
+    VerifyHeapOrder(heap, kNumEntries, KeyCompare());
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        entries[i].SetKey((i % 2 == 0) ? i : kNumEntries + i);
+        heap.Add(entries[i]);
+    }
+
+    VerifyHeapOrder(heap, kNumEntries, KeyCompare());
+
+    // Remove entries which are not at the top: a first child, a later
+    // sibling, and an entry with children of its own.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        entries[i].SetKey(i);
+        heap.Add(entries[i]);
+    }
+
+    heap.Remove(entries[0]);
+    VerifyOrQuit(heap.GetTop() == &entries[1]);
+
+    heap.Remove(entries[5]);
+    heap.Remove(entries[2]);
+    VerifyOrQuit(!heap.Contains(entries[5]));
+    VerifyOrQuit(!heap.Contains(entries[2]));
+
+    heap.Remove(entries[1]);
+    VerifyOrQuit(heap.GetTop() == &entries[3]);
+
+    VerifyHeapOrder(heap, kNumEntries - 4, KeyCompare());
+
+    // Entries with equal keys.
+
+    for (Entry &entry : entries)
+    {
+        entry.SetKey(7);
+        heap.Add(entry);
+    }
+
+    VerifyHeapOrder(heap, kNumEntries, KeyCompare());
+
+    // The comparator given to each call defines the order.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        entries[i].SetKey(i);
+        heap.Add(entries[i], KeyCompare(/* aReversed */ true));
+    }
+
+    VerifyOrQuit(heap.GetTop() == &entries[kNumEntries - 1]);
+    VerifyHeapOrder(heap, kNumEntries, KeyCompare(/* aReversed */ true));
+
+    printf(" -- PASS\n");
+}
+
+void TestPairingHeapRandom(void)
+{
+    static constexpr uint16_t kNumEntries    = 200;
+    static constexpr uint32_t kNumOperations = 20000;
+    static constexpr uint16_t kMaxKey        = 1000;
+
+    Heap     heap;
+    Entry    entries[kNumEntries];
+    uint16_t numInHeap = 0;
+
+    printf("TestPairingHeapRandom");
+
+    srand(0);
+
+    // Randomly add, remove and re-key entries and check the top of the
+    // heap against a linear search after every operation.
+
+    for (uint32_t op = 0; op < kNumOperations; op++)
+    {
+        Entry &entry    = entries[static_cast<uint16_t>(rand()) % kNumEntries];
+        Entry *minEntry = nullptr;
+
+        if (heap.Contains(entry))
+        {
+            heap.Remove(entry);
+            numInHeap--;
+        }
+
+        if ((rand() % 3) != 0)
+        {
+            entry.SetKey(static_cast<uint16_t>(rand()) % kMaxKey);
+            heap.Add(entry);
+            numInHeap++;
+        }
+
+        for (Entry &candidate : entries)
+        {
+            if (heap.Contains(candidate) && (minEntry == nullptr || candidate.GetKey() < minEntry->GetKey()))
+            {
+                minEntry = &candidate;
+            }
+        }
+
+        VerifyOrQuit(heap.GetTop() != nullptr || minEntry == nullptr);
+        VerifyOrQuit(minEntry == nullptr || heap.GetTop()->GetKey() == minEntry->GetKey(), "top is not the minimum");
+    }
+
+    VerifyHeapOrder(heap, numInHeap, KeyCompare());
+
+    for (Entry &entry : entries)
+    {
+        VerifyOrQuit(!heap.Contains(entry));
+    }
+
+    printf(" -- PASS\n");
+}
+
+int main(void)
+{
+    TestPairingHeap();
+    TestPairingHeapRandom();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,342 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "posix/platform/mainloop.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+namespace Posix {
+
+using Mainloop::Descriptor;
+using Mainloop::Manager;
+
+enum : uint16_t
+{
+    kNumPipes            = 200,   // Number of pipes watched in the benchmark
+    kBenchmarkIterations = 20000, // Number of mainloop iterations in the benchmark
+};
+
+struct Pipe
+{
+    int         mFds[2];
+    uint32_t    mNumEvents;
+    Descriptor *mDescriptorToUnregister; // Unregistered by the handler when not `nullptr`.
+};
+
+static Pipe        sPipes[kNumPipes];
+static Descriptor *sDescriptors[kNumPipes];
+
+void HandleDescriptor(Descriptor &aDescriptor, uint8_t aEvents)
+{
+    Pipe &  pipe = *static_cast<Pipe *>(aDescriptor.GetContext());
+    uint8_t byte;
+
+    pipe.mNumEvents++;
+
+    if (aEvents & Descriptor::kEventRead)
+    {
+        VerifyOrQuit(read(pipe.mFds[0], &byte, sizeof(byte)) == sizeof(byte));
+    }
+
+    if (pipe.mDescriptorToUnregister != nullptr)
+    {
+        Manager::Get().Unregister(*pipe.mDescriptorToUnregister);
+    }
+}
+
+// Watches the read ends of the pipes by adding them to the mainloop context on every iteration.
+class PipeSource : public Mainloop::Source
+{
+public:
+    void Update(otSysMainloopContext &aContext) override
+    {
+        for (Pipe &pipe : sPipes)
+        {
+            FD_SET(pipe.mFds[0], &aContext.mReadFdSet);
+
+            if (aContext.mMaxFd < pipe.mFds[0])
+            {
+                aContext.mMaxFd = pipe.mFds[0];
+            }
+        }
+    }
+
+    void Process(const otSysMainloopContext &aContext) override
+    {
+        uint8_t byte;
+
+        for (Pipe &pipe : sPipes)
+        {
+            if (FD_ISSET(pipe.mFds[0], &aContext.mReadFdSet))
+            {
+                pipe.mNumEvents++;
+                VerifyOrQuit(read(pipe.mFds[0], &byte, sizeof(byte)) == sizeof(byte));
+            }
+        }
+    }
+};
+
+void RunMainloopIteration(void)
+{
+    otSysMainloopContext context;
+
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 0;
+    context.mTimeout.tv_usec = 0;
+
+    Manager::Get().Update(context);
+    VerifyOrQuit(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                        &context.mTimeout) >= 0);
+    Manager::Get().Process(context);
+}
+
+void WriteToPipe(uint16_t aIndex)
+{
+    uint8_t byte = 0;
+
+    VerifyOrQuit(write(sPipes[aIndex].mFds[1], &byte, sizeof(byte)) == sizeof(byte));
+}
+
+void ResetEventCounts(void)
+{
+    for (Pipe &pipe : sPipes)
+    {
+        pipe.mNumEvents = 0;
+    }
+}
+
+void TestDescriptors(void)
+{
+    Descriptor writeDescriptor(sPipes[0].mFds[1], HandleDescriptor, &sPipes[0]);
+
+    for (uint16_t i = 0; i < kNumPipes; i++)
+    {
+        Manager::Get().Register(*sDescriptors[i], Descriptor::kEventRead);
+        VerifyOrQuit(sDescriptors[i]->IsRegistered());
+    }
+
+    ResetEventCounts();
+    RunMainloopIteration();
+
+    for (Pipe &pipe : sPipes)
+    {
+        VerifyOrQuit(pipe.mNumEvents == 0, "Handler called for an idle descriptor");
+    }
+
+    // Only the ready descriptors are dispatched.
+    WriteToPipe(3);
+    WriteToPipe(kNumPipes - 1);
+    RunMainloopIteration();
+
+    for (uint16_t i = 0; i < kNumPipes; i++)
+    {
+        VerifyOrQuit(sPipes[i].mNumEvents == ((i == 3 || i == kNumPipes - 1) ? 1 : 0));
+    }
+
+    // A descriptor unregistered by the handler of another ready descriptor is not dispatched.
+    ResetEventCounts();
+    sPipes[5].mDescriptorToUnregister = sDescriptors[6];
+    sPipes[6].mDescriptorToUnregister = sDescriptors[5];
+    WriteToPipe(5);
+    WriteToPipe(6);
+    RunMainloopIteration();
+    RunMainloopIteration();
+
+    VerifyOrQuit(sPipes[5].mNumEvents + sPipes[6].mNumEvents == 1);
+    VerifyOrQuit(sDescriptors[5]->IsRegistered() != sDescriptors[6]->IsRegistered());
+
+    // Drain the pipe of the unregistered descriptor and register it again.
+    for (uint16_t i = 5; i <= 6; i++)
+    {
+        sPipes[i].mDescriptorToUnregister = nullptr;
+
+        if (!sDescriptors[i]->IsRegistered())
+        {
+            uint8_t byte;
+
+            VerifyOrQuit(read(sPipes[i].mFds[0], &byte, sizeof(byte)) == sizeof(byte));
+            Manager::Get().Register(*sDescriptors[i], Descriptor::kEventRead);
+        }
+    }
+
+    // Write events.
+    ResetEventCounts();
+    Manager::Get().Register(writeDescriptor, Descriptor::kEventWrite);
+    RunMainloopIteration();
+    VerifyOrQuit(sPipes[0].mNumEvents == 1);
+    Manager::Get().Unregister(writeDescriptor);
+    RunMainloopIteration();
+    VerifyOrQuit(sPipes[0].mNumEvents == 1);
+
+    for (uint16_t i = 0; i < kNumPipes; i++)
+    {
+        VerifyOrQuit(sPipes[i].mNumEvents == ((i == 0) ? 1 : 0));
+        Manager::Get().Unregister(*sDescriptors[i]);
+    }
+
+    printf("TestDescriptors() passed\n");
+}
+
+static uint8_t sHangUpEvents;
+
+void HandleHangUpDescriptor(Descriptor &aDescriptor, uint8_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aDescriptor);
+
+    sHangUpEvents |= aEvents;
+}
+
+void TestHangUp(void)
+{
+    int     fds[2];
+    uint8_t byte = 0;
+
+    VerifyOrQuit(pipe(fds) == 0);
+
+    Descriptor descriptor(fds[1], HandleHangUpDescriptor, nullptr);
+
+    // Fill the pipe so that its write end is not writable.
+    VerifyOrQuit(fcntl(fds[1], F_SETFL, O_NONBLOCK) == 0);
+
+    while (write(fds[1], &byte, sizeof(byte)) == sizeof(byte))
+    {
+    }
+
+    Manager::Get().Register(descriptor, Descriptor::kEventWrite);
+
+    sHangUpEvents = 0;
+    RunMainloopIteration();
+    VerifyOrQuit(sHangUpEvents == 0);
+
+    // Closing the read end is reported only as a registered event.
+    VerifyOrQuit(close(fds[0]) == 0);
+    RunMainloopIteration();
+    VerifyOrQuit(sHangUpEvents == Descriptor::kEventWrite, "Unregistered event reported on hang-up");
+
+    Manager::Get().Unregister(descriptor);
+    VerifyOrQuit(close(fds[1]) == 0);
+
+    printf("TestHangUp() passed\n");
+}
+
+uint32_t RunBenchmark(bool aLoaded)
+{
+    uint32_t startTime = otPlatAlarmMicroGetNow();
+
+    ResetEventCounts();
+
+    for (uint32_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        if (aLoaded)
+        {
+            WriteToPipe(i % kNumPipes);
+        }
+
+        RunMainloopIteration();
+    }
+
+    if (aLoaded)
+    {
+        for (Pipe &pipe : sPipes)
+        {
+            VerifyOrQuit(pipe.mNumEvents == kBenchmarkIterations / kNumPipes);
+        }
+    }
+
+    return otPlatAlarmMicroGetNow() - startTime;
+}
+
+void TestMainloopWakeupBenchmark(void)
+{
+    PipeSource source;
+    uint32_t   idleTime;
+    uint32_t   loadedTime;
+
+    Manager::Get().Add(source);
+    idleTime   = RunBenchmark(/* aLoaded */ false);
+    loadedTime = RunBenchmark(/* aLoaded */ true);
+    Manager::Get().Remove(source);
+
+    printf("Source (fd_set per iteration): idle %6u usec, loaded %6u usec for %u iterations with %u fds\n", idleTime,
+           loadedTime, kBenchmarkIterations, kNumPipes);
+
+    for (Descriptor *descriptor : sDescriptors)
+    {
+        Manager::Get().Register(*descriptor, Descriptor::kEventRead);
+    }
+
+    idleTime   = RunBenchmark(/* aLoaded */ false);
+    loadedTime = RunBenchmark(/* aLoaded */ true);
+
+    for (Descriptor *descriptor : sDescriptors)
+    {
+        Manager::Get().Unregister(*descriptor);
+    }
+
+    printf("Registered descriptors:        idle %6u usec, loaded %6u usec for %u iterations with %u fds\n", idleTime,
+           loadedTime, kBenchmarkIterations, kNumPipes);
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    for (uint16_t i = 0; i < ot::Posix::kNumPipes; i++)
+    {
+        VerifyOrQuit(pipe(ot::Posix::sPipes[i].mFds) == 0);
+        ot::Posix::sDescriptors[i] =
+            new ot::Posix::Descriptor(ot::Posix::sPipes[i].mFds[0], ot::Posix::HandleDescriptor, &ot::Posix::sPipes[i]);
+    }
+
+    printf("Mainloop backend: %s\n", OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE ? "epoll" : "select");
+
+    ot::Posix::TestDescriptors();
+    ot::Posix::TestHangUp();
+    ot::Posix::TestMainloopWakeupBenchmark();
+
+    for (uint16_t i = 0; i < ot::Posix::kNumPipes; i++)
+    {
+        delete ot::Posix::sDescriptors[i];
+        close(ot::Posix::sPipes[i].mFds[0]);
+        close(ot::Posix::sPipes[i].mFds[1]);
+    }
+
+    printf("All tests passed\n");
+    return 0;
+}
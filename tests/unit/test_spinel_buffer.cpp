@@ -179,7 +179,7 @@ void WriteTestFrame1(Spinel::Buffer &aNcpBuffer, Spinel::Buffer::Priority aPrior
     message = sMessagePool->New(Message::kTypeIp6, 0);
     VerifyOrQuit(message != nullptr, "Null Message");
     SuccessOrQuit(message->SetLength(sizeof(sMottoText)));
-    message->Write(0, sMottoText);
+    SuccessOrQuit(message->Write(0, sMottoText));
 
     oldContext = sContext;
     aNcpBuffer.InFrameBegin(aPriority);
@@ -223,12 +223,12 @@ void WriteTestFrame2(Spinel::Buffer &aNcpBuffer, Spinel::Buffer::Priority aPrior
     message1 = sMessagePool->New(Message::kTypeIp6, 0);
     VerifyOrQuit(message1 != nullptr, "Null Message");
     SuccessOrQuit(message1->SetLength(sizeof(sMysteryText)));
-    message1->Write(0, sMysteryText);
+    SuccessOrQuit(message1->Write(0, sMysteryText));
 
     message2 = sMessagePool->New(Message::kTypeIp6, 0);
     VerifyOrQuit(message2 != nullptr, "Null Message");
     SuccessOrQuit(message2->SetLength(sizeof(sHelloText)));
-    message2->Write(0, sHelloText);
+    SuccessOrQuit(message2->Write(0, sHelloText));
 
     aNcpBuffer.InFrameBegin(aPriority);
     SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message1));
@@ -529,7 +529,7 @@ void TestBuffer(void)
         message = sMessagePool->New(Message::kTypeIp6, 0);
         VerifyOrQuit(message != nullptr, "Null Message");
         SuccessOrQuit(message->SetLength(sizeof(sMysteryText)));
-        message->Write(0, sMysteryText);
+        SuccessOrQuit(message->Write(0, sMysteryText));
 
         SuccessOrQuit(ncpBuffer.InFrameFeedMessage(message));
 
@@ -734,7 +734,7 @@ void TestBuffer(void)
     message = sMessagePool->New(Message::kTypeIp6, 0);
     VerifyOrQuit(message != nullptr, "Null Message");
     SuccessOrQuit(message->SetLength(sizeof(sMysteryText)));
-    message->Write(0, sMysteryText);
+    SuccessOrQuit(message->Write(0, sMysteryText));
     VerifyOrQuit(ncpBuffer.InFrameFeedMessage(message) == OT_ERROR_INVALID_STATE);
     message->Free();
     VerifyOrQuit(ncpBuffer.InFrameEnd() == OT_ERROR_INVALID_STATE);
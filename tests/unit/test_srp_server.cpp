@@ -0,0 +1,447 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/srp_server.hpp"
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+
+namespace ot {
+namespace Srp {
+
+enum : uint16_t
+{
+    kNumHosts           = 16,
+    kNumIndexHosts      = 56, // With 3 services each, about what the default 63 KB heap can hold.
+    kServicesPerHost    = 3,
+    kNumServiceTypes    = 8,
+    kNumLookupRounds    = 200,
+    kMaxTestNameSize    = 64,
+    kRemovedHostsModulo = 4,
+};
+
+static uint32_t sNow;
+
+static uint32_t TestTimerGetNow(void)
+{
+    return sNow;
+}
+
+static void GetHostName(char *aName, uint16_t aHostIndex)
+{
+    snprintf(aName, kMaxTestNameSize, "host%u.default.service.arpa.", aHostIndex);
+}
+
+static uint16_t GetServiceType(uint16_t aHostIndex, uint16_t aServiceIndex)
+{
+    // The first two services of a host have the same service type.
+    return (aHostIndex + aServiceIndex / 2) % kNumServiceTypes;
+}
+
+static void GetServiceName(char *aName, uint16_t aServiceType)
+{
+    snprintf(aName, kMaxTestNameSize, "_srv%u._udp.default.service.arpa.", aServiceType);
+}
+
+static void GetInstanceName(char *aName, uint16_t aHostIndex, uint16_t aServiceIndex)
+{
+    snprintf(aName, kMaxTestNameSize, "ins%u-%u._srv%u._udp.default.service.arpa.", aHostIndex, aServiceIndex,
+             GetServiceType(aHostIndex, aServiceIndex));
+}
+
+class SrpServerTester
+{
+public:
+    static Server::Host *AddHost(Server & aServer,
+                                 uint16_t aHostIndex,
+                                 uint32_t aLease           = 7200,
+                                 uint32_t aKeyLease        = 7200,
+                                 uint32_t aServiceLease    = 7200,
+                                 uint32_t aServiceKeyLease = 7200)
+    {
+        char          name[kMaxTestNameSize];
+        Server::Host *host = Server::Host::New(aServer.GetInstance());
+
+        VerifyOrQuit(host != nullptr, "Host::New() failed");
+
+        GetHostName(name, aHostIndex);
+        SuccessOrQuit(host->SetFullName(name));
+        host->SetLease(aLease);
+        host->SetKeyLease(aKeyLease);
+
+        for (uint16_t i = 0; i < kServicesPerHost; i++)
+        {
+            char             instanceName[kMaxTestNameSize];
+            Server::Service *service;
+
+            GetServiceName(name, GetServiceType(aHostIndex, i));
+            GetInstanceName(instanceName, aHostIndex, i);
+            service = host->AddNewService(name, instanceName, /* aIsSubType */ false);
+            VerifyOrQuit(service != nullptr);
+
+            service->mDescription.mLease    = aServiceLease;
+            service->mDescription.mKeyLease = aServiceKeyLease;
+        }
+
+        aServer.AddHost(*host);
+
+        return host;
+    }
+
+    static void HandleLeaseTimer(Server &aServer) { aServer.HandleLeaseTimer(); }
+
+    static uint32_t GetLeaseTimerFireTime(Server &aServer)
+    {
+        return aServer.mLeaseTimer.IsRunning() ? aServer.mLeaseTimer.GetFireTime().GetValue() : 0;
+    }
+
+    static void RemoveHost(Server &aServer, uint16_t aHostIndex)
+    {
+        char name[kMaxTestNameSize];
+
+        GetHostName(name, aHostIndex);
+        aServer.RemoveHost(aServer.FindHost(name), /* aRetainName */ false, /* aNotifyServiceHandler */ false);
+    }
+
+    static void RemoveService(Server &aServer, uint16_t aHostIndex, uint16_t aServiceIndex)
+    {
+        char          name[kMaxTestNameSize];
+        char          instanceName[kMaxTestNameSize];
+        Server::Host *host;
+
+        GetHostName(name, aHostIndex);
+        host = aServer.FindHost(name);
+        VerifyOrQuit(host != nullptr);
+
+        GetServiceName(name, GetServiceType(aHostIndex, aServiceIndex));
+        GetInstanceName(instanceName, aHostIndex, aServiceIndex);
+        host->RemoveService(host->FindService(name, instanceName), /* aRetainName */ false,
+                            /* aNotifyServiceHandler */ false);
+    }
+
+    static const Server::Host *FindHostLinear(Server &aServer, const char *aFullName)
+    {
+        return aServer.mHosts.FindMatching(aFullName);
+    }
+
+    static uint16_t CountServicesLinear(Server &aServer, const char *aServiceName, const char *aInstanceName)
+    {
+        uint16_t count = 0;
+
+        for (const Server::Host *host = aServer.mHosts.GetHead(); host != nullptr; host = host->GetNext())
+        {
+            const Server::Service *service = nullptr;
+
+            while ((service = host->FindNextService(service, Server::kFlagsAnyService, aServiceName,
+                                                    aInstanceName)) != nullptr)
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    static uint16_t GetNumNameIndexBuckets(Server &aServer) { return aServer.mNumNameIndexBuckets; }
+
+    static uint16_t CountHostsLinear(Server &aServer, const char *aServiceName)
+    {
+        uint16_t count = 0;
+
+        for (const Server::Host *host = aServer.mHosts.GetHead(); host != nullptr; host = host->GetNext())
+        {
+            if (host->FindNextService(nullptr, Server::kFlagsAnyService, aServiceName, nullptr) != nullptr)
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    static void VerifyIndex(Server &aServer, uint16_t aNumHosts = kNumHosts)
+    {
+        // Verify that every host and service reachable through the
+        // name indexes is registered, and vice versa.
+
+        char     name[kMaxTestNameSize];
+        uint16_t numIndexed = 0;
+
+        for (uint16_t i = 0; i < aNumHosts; i++)
+        {
+            GetHostName(name, i);
+            VerifyOrQuit(aServer.FindHost(name) == FindHostLinear(aServer, name), "Host index is out of sync");
+
+            for (uint16_t j = 0; j < kServicesPerHost; j++)
+            {
+                const Server::Service *service = nullptr;
+                uint16_t               count   = 0;
+
+                GetInstanceName(name, i, j);
+
+                while ((service = aServer.FindNextServiceWithInstanceName(name, service)) != nullptr)
+                {
+                    VerifyOrQuit(service->MatchesInstanceName(name));
+                    count++;
+                }
+
+                VerifyOrQuit(count == CountServicesLinear(aServer, nullptr, name), "Instance index is out of sync");
+            }
+        }
+
+        for (uint16_t type = 0; type < kNumServiceTypes; type++)
+        {
+            const Server::Service *service  = nullptr;
+            const Server::Host *   lastHost = nullptr;
+            uint16_t               count    = 0;
+            uint16_t               numRuns  = 0;
+
+            GetServiceName(name, type);
+
+            while ((service = aServer.FindNextServiceWithServiceName(name, service)) != nullptr)
+            {
+                VerifyOrQuit(service->MatchesServiceName(name));
+                VerifyOrQuit(FindHostLinear(aServer, service->GetHost().GetFullName()) == &service->GetHost());
+                count++;
+
+                if (&service->GetHost() != lastHost)
+                {
+                    lastHost = &service->GetHost();
+                    numRuns++;
+                }
+            }
+
+            VerifyOrQuit(count == CountServicesLinear(aServer, name, nullptr), "Service index is out of sync");
+
+            // The services of a host with the same service name are next to each other.
+            VerifyOrQuit(numRuns == CountHostsLinear(aServer, name), "Services of a host are not grouped");
+            numIndexed += count;
+        }
+
+        VerifyOrQuit(numIndexed == CountServicesLinear(aServer, nullptr, nullptr));
+    }
+};
+
+void TestSrpServerNameIndex(void)
+{
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+    char      name[kMaxTestNameSize];
+    uint32_t  startTime;
+    uint32_t  indexDuration;
+    uint32_t  linearDuration;
+
+    VerifyOrQuit(instance != nullptr);
+
+    Server &server = instance->Get<Server>();
+
+    printf("TestSrpServerNameIndex() with %u hosts, %u services", kNumIndexHosts, kNumIndexHosts * kServicesPerHost);
+
+    for (uint16_t i = 0; i < kNumIndexHosts; i++)
+    {
+        SrpServerTester::AddHost(server, i);
+    }
+
+    SrpServerTester::VerifyIndex(server, kNumIndexHosts);
+
+    // The indexes grow with the number of registered services.
+    VerifyOrQuit(SrpServerTester::GetNumNameIndexBuckets(server) * 2 >= kNumIndexHosts * kServicesPerHost);
+
+    // Remove some services and hosts and verify the indexes.
+
+    for (uint16_t i = 0; i < kNumIndexHosts; i += kRemovedHostsModulo)
+    {
+        SrpServerTester::RemoveService(server, i, 0);
+        SrpServerTester::VerifyIndex(server, kNumIndexHosts);
+    }
+
+    for (uint16_t i = 1; i < kNumIndexHosts; i += kRemovedHostsModulo)
+    {
+        SrpServerTester::RemoveHost(server, i);
+        SrpServerTester::VerifyIndex(server, kNumIndexHosts);
+        GetHostName(name, i);
+        VerifyOrQuit(server.FindHost(name) == nullptr);
+    }
+
+    for (uint16_t i = 1; i < kNumIndexHosts; i += kRemovedHostsModulo)
+    {
+        SrpServerTester::AddHost(server, i);
+    }
+
+    SrpServerTester::VerifyIndex(server, kNumIndexHosts);
+
+    // Measure the host lookup time, indexed vs a linear scan of the hosts.
+
+    startTime = otPlatAlarmMicroGetNow();
+
+    for (uint16_t round = 0; round < kNumLookupRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumIndexHosts; i++)
+        {
+            GetHostName(name, i);
+            VerifyOrQuit(server.FindHost(name) != nullptr);
+        }
+    }
+
+    indexDuration = otPlatAlarmMicroGetNow() - startTime;
+    startTime     = otPlatAlarmMicroGetNow();
+
+    for (uint16_t round = 0; round < kNumLookupRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumIndexHosts; i++)
+        {
+            GetHostName(name, i);
+            VerifyOrQuit(SrpServerTester::FindHostLinear(server, name) != nullptr);
+        }
+    }
+
+    linearDuration = otPlatAlarmMicroGetNow() - startTime;
+
+    printf(" - %u lookups in %u usec (linear scan %u usec) -- PASS\n", kNumLookupRounds * kNumIndexHosts, indexDuration,
+           linearDuration);
+
+    for (uint16_t i = 0; i < kNumIndexHosts; i++)
+    {
+        SrpServerTester::RemoveHost(server, i);
+    }
+
+    SrpServerTester::VerifyIndex(server, kNumIndexHosts);
+    VerifyOrQuit(SrpServerTester::GetNumNameIndexBuckets(server) == OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS);
+
+    testFreeInstance(instance);
+}
+
+void TestSrpServerLeaseExpiry(void)
+{
+    // Host `i` has LEASE of `20 * (i + 1)` seconds and KEY-LEASE of
+    // `40 * (i + 1)` seconds. Its services have LEASE of `10 * (i + 1)`
+    // and KEY-LEASE of `30 * (i + 1)` seconds. The time is advanced in
+    // steps of 10 seconds, so at step `k` the services of hosts with
+    // `i + 1 <= k` have expired, the hosts with `i + 1 <= k / 2` have
+    // expired, and so on.
+
+    enum : uint16_t
+    {
+        kNumSteps = 4 * kNumHosts + 1,
+        kStep     = 10,
+    };
+
+    Instance *instance;
+    uint32_t  startTime;
+
+    g_testPlatAlarmGetNow = TestTimerGetNow;
+    sNow                  = 10000;
+    startTime             = sNow;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    Server &server = instance->Get<Server>();
+
+    printf("TestSrpServerLeaseExpiry()");
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        uint32_t unit = kStep * (i + 1);
+
+        SrpServerTester::AddHost(server, i, 2 * unit, 4 * unit, unit, 3 * unit);
+    }
+
+    SrpServerTester::HandleLeaseTimer(server);
+    VerifyOrQuit(SrpServerTester::GetLeaseTimerFireTime(server) == startTime + Time::SecToMsec(kStep));
+
+    for (uint16_t step = 1; step <= kNumSteps; step++)
+    {
+        const Server::LeaseCounters &leaseCounters = server.GetLeaseCounters();
+
+        sNow = startTime + Time::SecToMsec(kStep * step);
+        SrpServerTester::HandleLeaseTimer(server);
+
+        VerifyOrQuit(leaseCounters.mServiceLeaseExpirations == kServicesPerHost * OT_MIN(step, kNumHosts));
+        VerifyOrQuit(leaseCounters.mHostLeaseExpirations == OT_MIN(step / 2, kNumHosts));
+        VerifyOrQuit(leaseCounters.mServiceKeyLeaseExpirations == kServicesPerHost * OT_MIN(step / 3, kNumHosts));
+        VerifyOrQuit(leaseCounters.mHostKeyLeaseExpirations == OT_MIN(step / 4, kNumHosts));
+
+        for (uint16_t i = 0; i < kNumHosts; i++)
+        {
+            char                name[kMaxTestNameSize];
+            const Server::Host *host;
+
+            GetHostName(name, i);
+            host = server.FindHost(name);
+
+            VerifyOrQuit((host != nullptr) == (4 * (i + 1) > step), "Host was not removed on KEY-LEASE expiry");
+            VerifyOrQuit(host == nullptr || host->IsDeleted() == (2 * (i + 1) <= step));
+        }
+
+        SrpServerTester::VerifyIndex(server);
+
+        // The lease timer must be running (for a later time) until all
+        // the hosts are removed.
+
+        if (step < 4 * kNumHosts)
+        {
+            VerifyOrQuit(SrpServerTester::GetLeaseTimerFireTime(server) > sNow);
+        }
+        else
+        {
+            VerifyOrQuit(SrpServerTester::GetLeaseTimerFireTime(server) == 0);
+        }
+    }
+
+    server.ResetLeaseCounters();
+    VerifyOrQuit(server.GetLeaseCounters().mHostLeaseExpirations == 0);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+}
+
+} // namespace Srp
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+    ot::Srp::TestSrpServerNameIndex();
+    ot::Srp::TestSrpServerLeaseExpiry();
+    printf("\nAll tests passed.\n");
+#else
+    printf("SRP_SERVER feature is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -28,9 +28,14 @@
 
 #include "test_platform.h"
 
+#include <stdlib.h>
+#include <sys/time.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "common/new.hpp"
+#include "common/random.hpp"
 #include "common/timer.hpp"
 
 enum
@@ -338,21 +343,14 @@ template <typename TimerType> int TestTwoTimers(void)
     VerifyOrQuit(timer2.IsRunning() == true, "Timer running Failed.");
     VerifyOrQuit(sTimerOn, "Platform Timer State Failed.");
 
-    AlarmFired<TimerType>(instance);
-
-    VerifyOrQuit(sCallCount[kCallCountIndexAlarmStop] == 0, "Stop CallCount Failed.");
-    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == 1, "Handler CallCount Failed.");
-    VerifyOrQuit(timer2.GetFiredCounter() == 1, "Fire Counter failed.");
-    VerifyOrQuit(sPlatT0 == sNow && sPlatDt == 0, "Start params Failed.");
-    VerifyOrQuit(timer1.IsRunning() == true, "Timer running Failed.");
-    VerifyOrQuit(timer2.IsRunning() == false, "Timer running Failed.");
-    VerifyOrQuit(sTimerOn == true, "Platform Timer State Failed.");
+    // Both timers are expired and should be fired in a single pass.
 
     AlarmFired<TimerType>(instance);
 
     VerifyOrQuit(sCallCount[kCallCountIndexAlarmStop] == 1, "Stop CallCount Failed.");
     VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == 2, "Handler CallCount Failed.");
     VerifyOrQuit(timer1.GetFiredCounter() == 1, "Fire Counter failed.");
+    VerifyOrQuit(timer2.GetFiredCounter() == 1, "Fire Counter failed.");
     VerifyOrQuit(timer1.IsRunning() == false, "Timer running Failed.");
     VerifyOrQuit(timer2.IsRunning() == false, "Timer running Failed.");
     VerifyOrQuit(sTimerOn == false, "Platform Timer State Failed.");
@@ -469,7 +467,7 @@ template <typename TimerType> static void TenTimers(uint32_t aTimeShift)
 
     const uint32_t kTimerStopCountAfterTrigger[kNumTriggers] = {0, 0, 0, 0, 0, 0, 1};
 
-    const uint32_t kTimerStartCountAfterTrigger[kNumTriggers] = {3, 4, 5, 7, 9, 11, 11};
+    const uint32_t kTimerStartCountAfterTrigger[kNumTriggers] = {3, 4, 5, 6, 7, 8, 8};
 
     ot::Instance *instance = testInitInstance();
 
@@ -520,16 +518,9 @@ template <typename TimerType> static void TenTimers(uint32_t aTimeShift)
     {
         sNow = kTriggerTimes[trigger] + aTimeShift;
 
-        do
-        {
-            // By design, each call to AlarmFired<TimerType>() can result in 0 or 1 calls to a timer handler.
-            // For some combinations of sNow and Timers queued, it is necessary to call AlarmFired<TimerType>()
-            // multiple times in order to handle all the expired timers.  It can be determined that another
-            // timer is ready to be triggered by examining the aDt arg passed into otPlatAlarmMilliStartAt().  If
-            // that value is 0, then AlarmFired should be fired immediately. This loop calls
-            // AlarmFired<TimerType>() the requisite number of times based on the aDt argument.
-            AlarmFired<TimerType>(instance);
-        } while (sPlatDt == 0);
+        // Each call to AlarmFired<TimerType>() fires all the expired timers in a single pass.
+        AlarmFired<TimerType>(instance);
+        VerifyOrQuit(!sTimerOn || sPlatDt != 0, "TestTenTimer: Expired timer not fired.");
 
         VerifyOrQuit(sCallCount[kCallCountIndexAlarmStart] == kTimerStartCountAfterTrigger[trigger],
                      "TestTenTimer: Start CallCount Failed.");
@@ -573,6 +564,152 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * `ChurnTimer` is used by `TestTimerChurn()` to verify the fire order and re-starting a timer from its handler.
+ */
+template <typename TimerType> class ChurnTimer : public TimerType
+{
+public:
+    explicit ChurnTimer(ot::Instance &aInstance)
+        : TimerType(aInstance, ChurnTimer::HandleTimerFired)
+        , mRestart(false)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer) { static_cast<ChurnTimer &>(aTimer).HandleTimerFired(); }
+
+    void HandleTimerFired(void)
+    {
+        // Timers must fire in order of their fire times.
+        VerifyOrQuit(sNumFired == 0 || !(this->GetFireTime() < sLastFireTime), "TestTimerChurn: Fire order Failed.");
+
+        sLastFireTime = this->GetFireTime();
+        sNumFired++;
+
+        if (mRestart)
+        {
+            mRestart = false;
+            this->Start(0);
+        }
+    }
+
+    bool mRestart;
+
+    static ot::Time sLastFireTime;
+    static uint32_t sNumFired;
+};
+
+template <typename TimerType> ot::Time ChurnTimer<TimerType>::sLastFireTime;
+template <typename TimerType> uint32_t ChurnTimer<TimerType>::sNumFired;
+
+static uint32_t GetWallClockUsec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, nullptr);
+
+    return static_cast<uint32_t>(tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+/**
+ * Test the TimerScheduler with a large number of running timers being randomly re-started and stopped (timer churn),
+ * and report the time it takes.
+ */
+template <typename TimerType> int TestTimerChurn(void)
+{
+    const uint32_t kTimeT0        = 1000;
+    const uint16_t kNumTimers     = 500;
+    const uint32_t kNumOperations = 50000;
+    const uint32_t kMaxInterval   = 100000;
+
+    ot::Instance *        instance = testInitInstance();
+    ChurnTimer<TimerType> *timers;
+    uint32_t               startTime;
+    uint32_t duration;
+    uint16_t numRunning = 0;
+
+    printf("TestTimerChurn() ");
+
+    timers = static_cast<ChurnTimer<TimerType> *>(malloc(sizeof(ChurnTimer<TimerType>) * kNumTimers));
+    VerifyOrQuit(timers != nullptr, "TestTimerChurn: malloc() failed.");
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        new (&timers[i]) ChurnTimer<TimerType>(*instance);
+    }
+
+    InitTestTimer();
+    InitCounters();
+
+    sNow = kTimeT0;
+
+    startTime = GetWallClockUsec();
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i].Start(ot::Random::NonCrypto::GetUint32InRange(0, kMaxInterval));
+    }
+
+    for (uint32_t i = 0; i < kNumOperations; i++)
+    {
+        ChurnTimer<TimerType> &timer = timers[ot::Random::NonCrypto::GetUint16InRange(0, kNumTimers)];
+
+        if (ot::Random::NonCrypto::GetUint8InRange(0, 4) == 0)
+        {
+            timer.Stop();
+        }
+        else
+        {
+            timer.Start(ot::Random::NonCrypto::GetUint32InRange(0, kMaxInterval));
+        }
+
+        sNow += ot::Random::NonCrypto::GetUint8InRange(0, 2);
+    }
+
+    duration = GetWallClockUsec() - startTime;
+
+    // Fire all the timers in a single pass, with one timer re-starting
+    // itself from its handler. The re-started timer must not be fired
+    // again in the same pass.
+
+    timers[0].Start(0);
+    timers[0].mRestart = true;
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        if (timers[i].IsRunning())
+        {
+            numRunning++;
+        }
+    }
+
+    ChurnTimer<TimerType>::sNumFired = 0;
+    sNow += kMaxInterval;
+    AlarmFired<TimerType>(instance);
+
+    VerifyOrQuit(ChurnTimer<TimerType>::sNumFired == numRunning, "TestTimerChurn: Handler CallCount Failed.");
+    VerifyOrQuit(timers[0].IsRunning(), "TestTimerChurn: Timer running Failed.");
+    VerifyOrQuit(sTimerOn && sPlatDt == 0, "TestTimerChurn: Platform Timer State Failed.");
+
+    for (uint16_t i = 1; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i].IsRunning(), "TestTimerChurn: Timer running Failed.");
+    }
+
+    AlarmFired<TimerType>(instance);
+
+    VerifyOrQuit(ChurnTimer<TimerType>::sNumFired == numRunning + 1, "TestTimerChurn: Handler CallCount Failed.");
+    VerifyOrQuit(!timers[0].IsRunning(), "TestTimerChurn: Timer running Failed.");
+    VerifyOrQuit(!sTimerOn, "TestTimerChurn: Platform Timer State Failed.");
+
+    printf("(%u timers, %u start/stop operations in %u usec) --> PASSED\n", kNumTimers, kNumOperations, duration);
+
+    free(timers);
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -665,6 +802,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestTimerChurn<TimerType>();
 }
 
 int main(void)